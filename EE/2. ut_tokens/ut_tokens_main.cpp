@@ -1,8 +1,8 @@
 /**	@file: ut_tokens_main.cpp
 	@author Garth Santor/Trinh Han
 	@author http://www.gats.ca/
-	@version 1.1.0
-	@date 2017-11-23
+	@version 1.3.0
+	@date 2026-10-18
 	@note Compiles under Visual C++ 15.4.4
 
 	@brief Token unit test.
@@ -26,7 +26,11 @@
 
 #include <boost/lexical_cast.hpp>
 using boost::lexical_cast;
+#include <condition_variable>
+#include <mutex>
 #include <string>
+#include <thread>
+#include <vector>
 using namespace std;
 
 #include "../phase_list/ut_test_phase.hpp"
@@ -40,6 +44,67 @@ BOOST_AUTO_TEST_CASE(token_test) {
 	BOOST_CHECK_EQUAL(tkn->to_string(), "<Token>");
 }
 
+// Test the token pool: released blocks are reused, large requests bypass the pool.
+BOOST_AUTO_TEST_CASE(token_pool_test) {
+	void* block = token_pool::allocate(40);
+	token_pool::deallocate(block, 40);
+	BOOST_CHECK(token_pool::allocate(48) == block);
+	token_pool::deallocate(block, 48);
+
+	void* large = token_pool::allocate(token_pool::MAX_POOLED_SIZE + 1);
+	BOOST_CHECK(large != nullptr);
+	token_pool::deallocate(large, token_pool::MAX_POOLED_SIZE + 1);
+
+	Token* first = make<Integer>(Integer::value_type(1)).get();
+	BOOST_CHECK(make<Integer>(Integer::value_type(2)).get() == first);
+}
+
+// Test the token pool across threads: blocks allocated on one thread and released on another are reused,
+// so the pool stops growing once it holds what is in flight.
+BOOST_AUTO_TEST_CASE(token_pool_thread_test) {
+	size_t const BLOCKS = 10000, ROUNDS = 100, WARM = 10;
+	mutex handoff;
+	condition_variable changed;
+	vector<void*> handed;
+	bool done = false;
+
+	thread consumer([&] {
+		unique_lock<mutex> lock(handoff);
+		for (;;) {
+			changed.wait(lock, [&] { return done || !handed.empty(); });
+			if (handed.empty())
+				return;
+			for (void* block : handed)
+				token_pool::deallocate(block, 32);
+			handed.clear();
+			changed.notify_all();
+		}
+	});
+
+	size_t warmChunks = 0;
+	for (size_t round = 0; round < ROUNDS; ++round) {
+		if (round == WARM)
+			warmChunks = token_pool::chunks_allocated();
+		vector<void*> blocks;
+		for (size_t i = 0; i < BLOCKS; ++i)
+			blocks.push_back(token_pool::allocate(32));
+		unique_lock<mutex> lock(handoff);
+		changed.wait(lock, [&] { return handed.empty(); });
+		handed.swap(blocks);
+		changed.notify_all();
+	}
+	{
+		unique_lock<mutex> lock(handoff);
+		changed.wait(lock, [&] { return handed.empty(); });
+		done = true;
+		changed.notify_all();
+	}
+	consumer.join();
+
+	// each round is 5 chunks of 32 byte blocks: a leak would take about 450 more
+	BOOST_CHECK_LE(token_pool::chunks_allocated() - warmChunks, 10u);
+}
+
 
 // Test the PseudoOperation types
 // ==============================
@@ -451,6 +516,12 @@ BOOST_AUTO_TEST_CASE_TEMPLATE(Double_arg_function_test, T, double_arg_function_t
 
 Revision History
 
+Version 1.3.0: 2026-10-18
+Added token pool thread test.
+
+Version 1.2.0: 2026-10-18
+Added token pool test.
+
 Version 1.1.0: 2017-11-23
 Updated to Visual C++ 15.4.4
 New hierarchy tests.
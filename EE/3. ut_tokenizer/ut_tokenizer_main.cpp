@@ -1,8 +1,8 @@
 /** @file: ut_tokenizer_main.cpp
 	@author Garth Santor/Trinh Han
 	@author http://www.gats.ca/
-	@version 2.1.0
-	@date 2017-11-23
+	@version 2.4.0
+	@date 2026-10-18
 	@note Compiles under Visual C++ 15.4.4
 
 	@brief Tokenizer Unit Test for Expression Evaluator Project
@@ -21,6 +21,7 @@
 #include "../ee_common/inc/boolean.hpp"
 #include "../ee_common/inc/function.hpp"
 #include "../ee_common/inc/integer.hpp"
+#include "../ee_common/inc/keyword_table.hpp"
 #include "../ee_common/inc/operator.hpp"
 #include "../ee_common/inc/pseudo_operation.hpp"
 #include "../ee_common/inc/real.hpp"
@@ -105,6 +106,13 @@ BOOST_AUTO_TEST_CASE( unknown_token ) {
 		BOOST_CHECK(test("1234567890123456789012345678901234567890", TokenList({ make<Integer>(Integer::value_type("1234567890123456789012345678901234567890")) })));
 	}
 
+	BOOST_AUTO_TEST_CASE(lexer_single_integer_chunks) {
+		for (string digits : { "9223372036854775807", "9223372036854775808",
+				"12345678901234567890123456789012345678", "100000000000000000000000000000000000000000000000000000000001" })
+			BOOST_CHECK(test(digits, TokenList({ make<Integer>(Integer::value_type(digits)) })));
+		BOOST_CHECK(test("00000000000000000000042", TokenList({ make<Integer>(42) })));
+	}
+
 	BOOST_AUTO_TEST_CASE(lexer_two_integers) {
 		BOOST_CHECK(test("23 42", TokenList({ make<Integer>(23), make<Integer>(42) })));
 	}
@@ -280,6 +288,26 @@ BOOST_AUTO_TEST_CASE( unknown_token ) {
 			TokenList({ make<Real>(Real::value_type("1234567890123456789012345678901234567890.1234567890123456789012345678901234567890")) })));
 	}
 
+	BOOST_AUTO_TEST_CASE(lexer_single_real_exponent) {
+		BOOST_CHECK(test("1.5e-300", TokenList({ make<Real>(Real::value_type("1.5e-300")) })));
+		BOOST_CHECK(test("2E+3", TokenList({ make<Real>(Real::value_type("2000")) })));
+		BOOST_CHECK(test("12.25e2", TokenList({ make<Real>(Real::value_type("1225")) })));
+	}
+
+	BOOST_AUTO_TEST_CASE(lexer_single_real_no_exponent) {
+		BOOST_CHECK(test("2e", TokenList({ make<Integer>(2), make<E>() })));
+	}
+
+	BOOST_AUTO_TEST_CASE(lexer_single_real_bad_fraction) {
+		try {
+			Tokenizer().tokenize("1.x");
+			BOOST_FAIL("XBadCharacter exception not thrown");
+		}
+		catch (Tokenizer::XBadCharacter& e) {
+			BOOST_CHECK(e.get_location() == 2);
+		}
+	}
+
 
 	BOOST_AUTO_TEST_CASE(lexer_single_pi) { BOOST_CHECK(test("pi", TokenList({ make<Pi>() }))); }
 	BOOST_AUTO_TEST_CASE(lexer_single_Pi) { BOOST_CHECK(test("Pi", TokenList({ make<Pi>() }))); }
@@ -517,6 +545,60 @@ BOOST_AUTO_TEST_CASE( unknown_token ) {
 	#endif // TEST_FUNCTION && TEST_SINGLE_ARG
 #endif // TEST_VARIABLE
 
+#if TEST_FUNCTION && TEST_SINGLE_ARG && TEST_INTEGER
+	// ==============================================================================
+	// Keyword table Test Cases
+	// ==============================================================================
+	BOOST_AUTO_TEST_CASE(lexer_keyword_any_case) {
+		BOOST_CHECK(test("aBs(42)", TokenList({ make<Abs>(), make<LeftParenthesis>(), make<Integer>(42), make<RightParenthesis>() })));
+		BOOST_CHECK(test("SqRt(42)", TokenList({ make<Sqrt>(), make<LeftParenthesis>(), make<Integer>(42), make<RightParenthesis>() })));
+	}
+
+	BOOST_AUTO_TEST_CASE(lexer_keyword_shared) {
+		Tokenizer t1, t2;
+		BOOST_CHECK(t1.tokenize("abs")[0].get() == t2.tokenize("ABS")[0].get());
+		BOOST_CHECK(KeywordTable::instance().find("mod", 3) == KeywordTable::instance().find("%", 1));
+		BOOST_CHECK(!KeywordTable::instance().find("absx", 4));
+		BOOST_CHECK(!KeywordTable::instance().find("ab", 2));
+	}
+#endif // TEST_FUNCTION && TEST_SINGLE_ARG && TEST_INTEGER
+
+#if TEST_VARIABLE && TEST_INTEGER && TEST_BINARY_OPERATOR
+	// ==============================================================================
+	// Lexeme Test Cases
+	// ==============================================================================
+	BOOST_AUTO_TEST_CASE(lexer_lexemes) {
+		Tokenizer tkn;
+		LexemeList list = tkn.lex("x = 12 + abs(-1.5)!");
+		std::vector<lexeme_kind> const kinds = {
+			lexeme_kind::VARIABLE, lexeme_kind::ASSIGNMENT, lexeme_kind::INTEGER, lexeme_kind::ADDITION, lexeme_kind::KEYWORD,
+			lexeme_kind::LEFT_PARENTHESIS, lexeme_kind::NEGATION, lexeme_kind::REAL, lexeme_kind::RIGHT_PARENTHESIS, lexeme_kind::FACTORIAL };
+		BOOST_REQUIRE_EQUAL(list.lexemes.size(), kinds.size());
+		for (size_t i = 0; i < kinds.size(); ++i)
+			BOOST_CHECK(list.lexemes[i].kind == kinds[i]);
+
+		BOOST_CHECK_EQUAL(list.lexemes[2].offset, 4u);
+		BOOST_CHECK_EQUAL(list.lexemes[2].length, 2u);
+		BOOST_REQUIRE_EQUAL(list.integers.size(), 1u);
+		BOOST_CHECK_EQUAL(list.integers[list.lexemes[2].index], 12);
+		BOOST_CHECK_EQUAL(list.lexemes[4].offset, 9u);
+		BOOST_CHECK_EQUAL(list.lexemes[4].length, 3u);
+		BOOST_CHECK_EQUAL(list.lexemes[7].offset, 14u);
+		BOOST_CHECK_EQUAL(list.lexemes[7].length, 3u);
+		BOOST_CHECK(list.lexemes[7].index == Lexeme::NO_INDEX);
+	}
+
+	BOOST_AUTO_TEST_CASE(lexer_lexemes_to_tokens) {
+		Tokenizer tkn;
+		std::string const expression = "x = 12345678901234567890 * x";
+		TokenList tokens = tkn.to_tokens(tkn.lex(expression), expression);
+		BOOST_REQUIRE_EQUAL(tokens.size(), 5u);
+		BOOST_CHECK(tokens[0].get() == tokens[4].get());
+		BOOST_CHECK(tokens[0].get() == tkn.get_variable("x").get());
+		BOOST_CHECK_EQUAL(tokens[2]->to_string(), make<Integer>(Integer::value_type("12345678901234567890"))->to_string());
+		BOOST_CHECK(is<Multiplication>(tokens[3]));
+	}
+#endif // TEST_VARIABLE && TEST_INTEGER && TEST_BINARY_OPERATOR
 
 #endif // TEST_TOKENIZER
 
@@ -526,6 +608,15 @@ BOOST_AUTO_TEST_CASE( unknown_token ) {
 
 Revision History
 
+Version 2.4.0: 2026-10-18
+Added lexeme (kind, offset, literal pool) tests.
+
+Version 2.3.0: 2026-10-18
+Added exponent literal tests.
+
+Version 2.2.0: 2026-10-18
+Added keyword table tests (case-insensitive, shared across Tokenizers).
+
 Version 2.1.0: 2017-11-23
 Added Python-style power operator '**'.
 
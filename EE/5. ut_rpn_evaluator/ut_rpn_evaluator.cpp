@@ -1,8 +1,8 @@
 /** @file: ut_rpn_evaluator.cpp
 	@author Garth Santor/Trinh Han
 	@author http://www.gats.ca/
-	@version 1.0.1
-	@date 2012-11-16
+	@version 1.8.0
+	@date 2026-10-18
 	@note Compiles under Visual C++ v120
 
 	@brief RPN evaluator unit test.
@@ -23,8 +23,11 @@
 #include "../ee_common/inc/operator.hpp"
 #include "../ee_common/inc/real.hpp"
 #include "../ee_common/inc/variable.hpp"
+#include "../ee_common/inc/factorial.hpp"
+#include "../ee_common/inc/numeric_conversion.hpp"
 
 #include <boost/math/constants/constants.hpp>
+#include <thread>
 
 #include "../phase_list/ut_test_phase.hpp"
 
@@ -145,6 +148,46 @@ BOOST_AUTO_TEST_CASE(no_operand) {
 			auto result = RPNEvaluator().evaluate({ make<Integer>(5), make<Factorial>() });
 			BOOST_CHECK(get_value<Integer>(result) == Integer::value_type(120));
 		}
+		BOOST_AUTO_TEST_CASE(factorial_test_running_product) {
+			RPNEvaluator rpn;
+			Integer::value_type expected = 1;
+			for (int n = 0; n <= 500; ++n) {
+				if (n >= 2)
+					expected *= n;
+				BOOST_CHECK(get_value<Integer>(rpn.evaluate({ make<Integer>(n), make<Factorial>() })) == expected);
+			}
+			BOOST_CHECK(get_value<Integer>(rpn.evaluate({ make<Integer>(-5), make<Factorial>() })) == 1);
+		}
+		BOOST_AUTO_TEST_CASE(factorial_test_large) {
+			// 30000! is past the parallel threshold; two at once, so one of them runs on the calling thread
+			Integer::value_type f1, f2;
+			std::thread other([&] { f1 = factorial(30000); });
+			f2 = factorial(30000);
+			other.join();
+			BOOST_CHECK(f1 == f2);
+			BOOST_CHECK(msb(f1) == 402908);
+			BOOST_CHECK(f1 % 1000000007 == 548996970);
+			Integer::value_type tens = boost::multiprecision::pow(Integer::value_type(10), 7498);
+			BOOST_CHECK(f1 % tens == 0 && f1 / tens % 10 != 0);		// 7498 trailing zeros
+		}
+		#if TEST_REAL
+			BOOST_AUTO_TEST_CASE(factorial_test_Real) {
+				auto result = RPNEvaluator().evaluate({ make<Real>(Real::value_type("4.5")), make<Factorial>() });
+				BOOST_CHECK(get_value<Real>(result) == Real::value_type("24.0"));
+				result = RPNEvaluator().evaluate({ make<Real>(Real::value_type("30.0")), make<Factorial>() });
+				BOOST_CHECK(get_value<Real>(result) == Real::value_type("265252859812191058636308480000000"));
+
+				RPNEvaluator rpn;
+				rpn.set_precision(precision_type::DOUBLE);
+				double expected = 1;
+				for (int i = 2; i <= 25; ++i)
+					expected *= i;
+				result = rpn.evaluate({ make<Real>(Real::value_type("25.0")), make<Factorial>() });
+				BOOST_CHECK(convert<Real>(result)->get_value_as<double>() == expected);
+				result = rpn.evaluate({ make<Real>(Real::value_type("1000000.0")), make<Factorial>() });
+				BOOST_CHECK(convert<Real>(result)->get_value_as<double>() == std::numeric_limits<double>::infinity());
+			}
+		#endif // TEST_REAL
 	#endif
 
 
@@ -553,6 +596,52 @@ BOOST_AUTO_TEST_CASE(no_operand) {
 				auto result = RPNEvaluator().evaluate({ make<Integer>(4), make<Syl>() });
 				BOOST_CHECK(get_value<Integer>(result) == 1807);
 			}
+			BOOST_AUTO_TEST_CASE(test_fib_pel_syl_sequence) {
+				// against the recurrences, term by term
+				RPNEvaluator rpn;
+				Integer::value_type f0 = 0, f1 = 1, p0 = 0, p1 = 1, s = 2;
+				for (int n = 0; n <= 300; ++n) {
+					Integer::value_type fib = n <= 1 ? Integer::value_type(n) : f1;		// fib(n) is F(n+1)
+					BOOST_CHECK(get_value<Integer>(rpn.evaluate({ make<Integer>(n), make<Fib>() })) == fib);
+					BOOST_CHECK(get_value<Integer>(rpn.evaluate({ make<Integer>(n), make<Pel>() })) == p0);
+					if (n <= 10) {
+						BOOST_CHECK(get_value<Integer>(rpn.evaluate({ make<Integer>(n), make<Syl>() })) == s);
+						s = s * s - s + 1;
+					}
+
+					Integer::value_type f2 = f0 + f1, p2 = 2 * p1 + p0;
+					f0 = f1; f1 = f2;
+					p0 = p1; p1 = p2;
+				}
+				BOOST_CHECK(get_value<Integer>(rpn.evaluate({ make<Integer>(-3), make<Fib>() })) == -3);
+				BOOST_CHECK(get_value<Integer>(rpn.evaluate({ make<Integer>(-3), make<Pel>() })) == 0);
+				BOOST_CHECK(get_value<Integer>(rpn.evaluate({ make<Integer>(-3), make<Syl>() })) == 2);
+			}
+			BOOST_AUTO_TEST_CASE(test_fib_large) {
+				auto result = RPNEvaluator().evaluate({ make<Integer>(100000), make<Fib>() });
+				Integer::value_type fib = get_value<Integer>(result);
+				BOOST_CHECK(fib % 1000000 == 537501);		// F(100001) ends in ...537501
+				BOOST_CHECK(msb(fib) == 69423);
+			}
+			BOOST_AUTO_TEST_CASE(test_sequence_index_too_large) {
+				try {
+					RPNEvaluator().evaluate({ make<Integer>(Integer::value_type("10000000000")), make<Fib>() });
+					BOOST_FAIL("Failed to throw exception");
+				}
+				catch (std::exception& e) {
+					BOOST_CHECK(strcmp(e.what(), "Error: sequence index too large.") == 0);
+				}
+			}
+			#if TEST_REAL
+				BOOST_AUTO_TEST_CASE(test_fib_pel_syl_Real) {
+					auto result = RPNEvaluator().evaluate({ make<Real>(Real::value_type("10.7")), make<Fib>() });
+					BOOST_CHECK(get_value<Real>(result) == Real::value_type("89.0"));
+					result = RPNEvaluator().evaluate({ make<Real>(Real::value_type("10.0")), make<Pel>() });
+					BOOST_CHECK(get_value<Real>(result) == Real::value_type("2378.0"));
+					result = RPNEvaluator().evaluate({ make<Real>(Real::value_type("4.0")), make<Syl>() });
+					BOOST_CHECK(get_value<Real>(result) == Real::value_type("1807.0"));
+				}
+			#endif // TEST_REAL
 #endif
 		#if TEST_REAL
 			BOOST_AUTO_TEST_CASE(test_abs_Real) {
@@ -607,6 +696,14 @@ BOOST_AUTO_TEST_CASE(no_operand) {
 				auto result = RPNEvaluator().evaluate({ make<Real>(Real::value_type("1.0")), make<Ln>() });
 				BOOST_CHECK(round(get_value<Real>(result)) == boost::multiprecision::log(Real::value_type("1.0")));
 			}
+			BOOST_AUTO_TEST_CASE(test_ln_natural) {
+				auto result = RPNEvaluator().evaluate({ make<E>(), make<Ln>() });
+				BOOST_CHECK(round(get_value<Real>(result)) == round(Real::value_type("1.0")));
+			}
+			BOOST_AUTO_TEST_CASE(test_log) {
+				auto result = RPNEvaluator().evaluate({ make<Real>(Real::value_type("100.0")), make<Log>() });
+				BOOST_CHECK(round(get_value<Real>(result)) == round(Real::value_type("2.0")));
+			}
 			BOOST_AUTO_TEST_CASE(test_sin) {
 				auto result = RPNEvaluator().evaluate({ make<Real>(Real::value_type("0.0")), make<Sin>() });
 				BOOST_CHECK(round(get_value<Real>(result)) == Real::value_type("0.0"));
@@ -722,6 +819,252 @@ BOOST_AUTO_TEST_CASE(no_operand) {
 #endif // TEST_FUNCTION
 
 
+#if TEST_BOOLEAN && TEST_INTEGER && TEST_BINARY_OPERATOR
+	BOOST_AUTO_TEST_CASE(test_operand_kinds) {
+		BOOST_CHECK(make_operand<Integer>(Integer::value_type(1))->get_kind() == operand_kind::INTEGER);
+		BOOST_CHECK(convert<Operand>(make<Pi>())->get_kind() == operand_kind::REAL);
+		BOOST_CHECK(convert<Operand>(make<True>())->get_kind() == operand_kind::BOOLEAN);
+		BOOST_CHECK(make_operand<Variable>(nullptr)->get_kind() == operand_kind::VARIABLE);
+	}
+	BOOST_AUTO_TEST_CASE(test_type_mismatch) {
+		try {
+			auto t = RPNEvaluator().evaluate({ make<True>(), make<Integer>(4), make<Addition>() });
+			BOOST_FAIL("Failed to throw exception");
+		}
+		catch (std::exception& e) {
+			BOOST_CHECK(std::string(e.what()).find("Error: cannot perform") == 0);
+		}
+	}
+	#if TEST_VARIABLE
+		BOOST_AUTO_TEST_CASE(test_variable_operands) {
+			auto x = make<Variable>(make_operand<Integer>(Integer::value_type(6)));
+			auto y = make<Variable>(make_operand<Real>(Real::value_type("1.5")));
+			auto result = RPNEvaluator().evaluate({ x, y, make<Multiplication>() });
+			BOOST_CHECK(get_value<Real>(result) == Real::value_type("9.0"));
+		}
+	#endif // TEST_VARIABLE
+#endif
+
+#if TEST_COMPILE && TEST_INTEGER && TEST_BINARY_OPERATOR
+	BOOST_AUTO_TEST_CASE(test_compile_execute) {
+		RPNEvaluator rpn;
+		auto program = rpn.compile({ make<Integer>(3), make<Integer>(4), make<Addition>(), make<Integer>(2), make<Multiplication>() });
+		BOOST_CHECK(program.size() == 5);
+		BOOST_CHECK(program[2].opcode == opcode_type::ADDITION);
+		BOOST_CHECK(get_value<Integer>(rpn.execute(program)) == Integer::value_type(14));
+		BOOST_CHECK(get_value<Integer>(rpn.execute(program)) == Integer::value_type(14));
+		BOOST_CHECK(rpn.get_results().size() == 2);
+	}
+	BOOST_AUTO_TEST_CASE(test_unsupported_operation) {
+		try {
+			auto t = RPNEvaluator().evaluate({ make<Integer>(3), make<Integer>(4), make<BitAnd>() });
+			BOOST_FAIL("Failed to throw exception");
+		}
+		catch (std::exception& e) {
+			BOOST_CHECK(std::string(e.what()).find("Error: cannot perform") == 0);
+		}
+	}
+	#if TEST_FUNCTION
+		BOOST_AUTO_TEST_CASE(test_result) {
+			RPNEvaluator rpn;
+			rpn.evaluate({ make<Integer>(7) });
+			rpn.evaluate({ make<Integer>(9) });
+			auto result = rpn.evaluate({ make<Integer>(1), make<Result>(), make<Integer>(2), make<Result>(), make<Subtraction>() });
+			BOOST_CHECK(get_value<Integer>(result) == Integer::value_type(-2));
+		}
+		BOOST_AUTO_TEST_CASE(test_result_history_limit) {
+			RPNEvaluator rpn;
+			rpn.set_history_limit(2);
+			for (int i = 1; i <= 100; ++i)
+				rpn.evaluate({ make<Integer>(i) });
+			BOOST_CHECK(rpn.get_results().size() == 2);
+			BOOST_CHECK(rpn.get_forgotten() == 98);
+			auto result = rpn.evaluate({ make<Integer>(100), make<Result>() });
+			BOOST_CHECK(get_value<Integer>(result) == Integer::value_type(100));
+			try {
+				rpn.evaluate({ make<Integer>(99), make<Result>() });
+				BOOST_FAIL("Failed to throw exception");
+			}
+			catch (std::exception& e) {
+				BOOST_CHECK(std::string(e.what()) == "Error: result no longer kept.");
+			}
+			BOOST_CHECK(rpn.get_results().size() == 2);
+		}
+	#endif // TEST_FUNCTION
+#endif // TEST_COMPILE
+
+#if TEST_INTEGER && TEST_BINARY_OPERATOR
+	BOOST_AUTO_TEST_CASE(test_integer_small) {
+		auto result = RPNEvaluator().evaluate({ make<Integer>(40), make<Integer>(2), make<Addition>() });
+		BOOST_CHECK(convert<Integer>(result)->is_small());
+		BOOST_CHECK(get_value<Integer>(result) == Integer::value_type(42));
+	}
+	BOOST_AUTO_TEST_CASE(test_integer_overflow_add) {
+		auto result = RPNEvaluator().evaluate({ make<Integer>(Integer::value_type("9223372036854775807")), make<Integer>(1), make<Addition>() });
+		BOOST_CHECK(!convert<Integer>(result)->is_small());
+		BOOST_CHECK(get_value<Integer>(result) == Integer::value_type("9223372036854775808"));
+	}
+	BOOST_AUTO_TEST_CASE(test_integer_overflow_subtract) {
+		auto result = RPNEvaluator().evaluate({ make<Integer>(Integer::value_type("-9223372036854775808")), make<Integer>(1), make<Subtraction>() });
+		BOOST_CHECK(get_value<Integer>(result) == Integer::value_type("-9223372036854775809"));
+	}
+	BOOST_AUTO_TEST_CASE(test_integer_overflow_multiply) {
+		auto result = RPNEvaluator().evaluate({ make<Integer>(Integer::value_type("4294967296")), make<Integer>(Integer::value_type("4294967296")), make<Multiplication>() });
+		BOOST_CHECK(get_value<Integer>(result) == Integer::value_type("18446744073709551616"));
+		result = RPNEvaluator().evaluate({ make<Integer>(Integer::value_type("-9223372036854775808")), make<Integer>(-1), make<Division>() });
+		BOOST_CHECK(get_value<Integer>(result) == Integer::value_type("9223372036854775808"));
+	}
+	BOOST_AUTO_TEST_CASE(test_integer_demotion) {
+		auto result = RPNEvaluator().evaluate({ make<Integer>(Integer::value_type("9223372036854775808")), make<Integer>(1), make<Subtraction>() });
+		BOOST_CHECK(convert<Integer>(result)->is_small());
+		BOOST_CHECK(get_value<Integer>(result) == Integer::value_type("9223372036854775807"));
+	}
+	#if TEST_RELATIONAL_OPERATOR
+		BOOST_AUTO_TEST_CASE(test_integer_compare_large) {
+			auto result = RPNEvaluator().evaluate({ make<Integer>(Integer::value_type("9223372036854775808")), make<Integer>(Integer::value_type("9223372036854775807")), make<Greater>() });
+			BOOST_CHECK(get_value<Boolean>(result) == true);
+		}
+	#endif // TEST_RELATIONAL_OPERATOR
+#endif // TEST_INTEGER
+
+#if TEST_FOLD && TEST_VARIABLE && TEST_FUNCTION && TEST_MIXED
+	BOOST_AUTO_TEST_CASE(test_fold_constants) {
+		// x * (2 ** 10) / sqrt(2.0)
+		RPNEvaluator rpn;
+		auto x = make<Variable>(make_operand<Integer>(Integer::value_type(3)));
+		auto program = rpn.compile({ x, make<Integer>(2), make<Integer>(10), make<Power>(), make<Multiplication>(), make<Real>(Real::value_type("2.0")), make<Sqrt>(), make<Division>() });
+		auto folded = rpn.fold(program);
+		BOOST_CHECK(folded.size() == 5);
+		BOOST_CHECK(folded[0].token == x);
+		BOOST_CHECK(get_value<Integer>(folded[1].token) == Integer::value_type(1024));
+		BOOST_CHECK(folded[3].opcode == opcode_type::OPERAND);
+		BOOST_CHECK(rpn.execute(folded)->to_string() == rpn.execute(program)->to_string());
+	}
+
+	BOOST_AUTO_TEST_CASE(test_fold_precision) {
+		for (auto precision : { precision_type::DOUBLE, precision_type::DIGITS_50, precision_type::DIGITS_100, precision_type::DIGITS_1000 }) {
+			RPNEvaluator rpn;
+			rpn.set_precision(precision);
+			auto program = rpn.compile({ make<Pi>(), make<Integer>(3), make<Division>(), make<Sin>(), make<Real>(Real::value_type("2.0")), make<Sqrt>(), make<Multiplication>(), make<Integer>(7), make<Max>() });
+			auto folded = rpn.fold(program);
+			BOOST_CHECK(folded.size() == 1);
+			BOOST_CHECK(convert<Real>(folded[0].token)->get_precision() == precision);
+			BOOST_CHECK(rpn.execute(folded)->to_string() == rpn.execute(program)->to_string());
+		}
+	}
+
+	BOOST_AUTO_TEST_CASE(test_fold_impure) {
+		RPNEvaluator rpn;
+		rpn.evaluate({ make<Integer>(5) });
+
+		// result(n) depends on the history, assignment on the variable
+		auto program = rpn.fold(rpn.compile({ make<Integer>(1), make<Result>(), make<Integer>(2), make<Integer>(3), make<Addition>(), make<Multiplication>() }));
+		BOOST_CHECK(program.size() == 4);
+		BOOST_CHECK(program[1].opcode == opcode_type::RESULT);
+		BOOST_CHECK(get_value<Integer>(rpn.execute(program)) == Integer::value_type(25));
+
+		auto x = make<Variable>();
+		program = rpn.fold(rpn.compile({ x, make<Integer>(4), make<Integer>(1), make<Addition>(), make<Assignment>() }));
+		BOOST_CHECK(program.size() == 3);
+		BOOST_CHECK(program[2].opcode == opcode_type::ASSIGNMENT);
+	}
+
+	BOOST_AUTO_TEST_CASE(test_fold_error_deferred) {
+		RPNEvaluator rpn;
+		auto program = rpn.fold(rpn.compile({ make<Integer>(1), make<Integer>(0), make<Division>() }));
+		BOOST_CHECK(program.size() == 3);
+		try {
+			rpn.execute(program);
+			BOOST_FAIL("Failed to throw exception");
+		}
+		catch (std::exception&) {
+		}
+	}
+#endif // TEST_FOLD
+
+#if TEST_SHARE && TEST_VARIABLE && TEST_FUNCTION && TEST_MIXED
+	BOOST_AUTO_TEST_CASE(test_share_common) {
+		// (a - b) ** 2 / (a - b)
+		RPNEvaluator rpn;
+		auto a = make<Variable>(make_operand<Real>(Real::value_type("7.5")));
+		auto b = make<Variable>(make_operand<Integer>(Integer::value_type(2)));
+		auto program = rpn.compile({ a, b, make<Subtraction>(), make<Integer>(2), make<Power>(), a, b, make<Subtraction>(), make<Division>() });
+		size_t deduplicated = 0;
+		auto shared = rpn.share(program, deduplicated);
+		BOOST_CHECK(deduplicated == 1);
+		BOOST_CHECK(shared.size() == 8);
+		BOOST_CHECK(shared[3].opcode == opcode_type::STORE);
+		BOOST_CHECK(shared[6].opcode == opcode_type::LOAD);
+		BOOST_CHECK(rpn.execute(shared)->to_string() == rpn.execute(program)->to_string());
+	}
+
+	BOOST_AUTO_TEST_CASE(test_share_nested) {
+		// ln(x) + ln(x) * ln(x): the inner x is not stored, only ln(x)
+		RPNEvaluator rpn;
+		auto x = make<Variable>(make_operand<Real>(Real::value_type("3.0")));
+		auto program = rpn.compile({ x, make<Ln>(), x, make<Ln>(), x, make<Ln>(), make<Multiplication>(), make<Addition>() });
+		size_t deduplicated = 0;
+		auto shared = rpn.share(program, deduplicated);
+		BOOST_CHECK(deduplicated == 2);
+		BOOST_CHECK(shared.size() == 7);
+		BOOST_CHECK(rpn.execute(shared)->to_string() == rpn.execute(program)->to_string());
+	}
+
+	BOOST_AUTO_TEST_CASE(test_share_impure) {
+		RPNEvaluator rpn;
+		rpn.evaluate({ make<Integer>(5) });
+		size_t deduplicated = 0;
+		auto program = rpn.compile({ make<Integer>(1), make<Result>(), make<Integer>(1), make<Result>(), make<Addition>() });
+		rpn.share(program, deduplicated);
+		BOOST_CHECK(deduplicated == 0);
+
+		// the second x + 1 reads the assigned x
+		auto x = make<Variable>(make_operand<Integer>(Integer::value_type(1)));
+		program = rpn.compile({ x, make<Integer>(1), make<Addition>(), x, x, make<Integer>(1), make<Addition>(), make<Assignment>(), make<Multiplication>() });
+		auto shared = rpn.share(program, deduplicated);
+		BOOST_CHECK(deduplicated == 0);
+		BOOST_CHECK(get_value<Integer>(rpn.execute(shared)) == Integer::value_type(4));
+	}
+#endif // TEST_SHARE
+
+#if TEST_PRECISION && TEST_MIXED
+	BOOST_AUTO_TEST_CASE(test_conversion_real) {
+		// a double converts to its exact decimal expansion, and back
+		Real::value_type tenth = numeric_conversion::convert<Real::value_type>(0.1);
+		BOOST_CHECK(tenth == Real::value_type("0.1000000000000000055511151231257827021181583404541015625"));
+		BOOST_CHECK(numeric_conversion::convert<double>(tenth) == 0.1);
+		BOOST_CHECK(numeric_conversion::convert<double>(Real::value_type(-1) / 3) == -1.0 / 3);
+		BOOST_CHECK(numeric_conversion::convert<double>(Real::value_type("1e400")) == std::numeric_limits<double>::infinity());
+		BOOST_CHECK(abs(numeric_conversion::convert<Real::digits50_type>(Real::value_type(2) / 3) - Real::digits50_type(2) / 3) < Real::digits50_type("1e-50"));
+
+		RPNEvaluator rpn;
+		rpn.set_precision(precision_type::DOUBLE);
+		auto result = rpn.evaluate({ make_operand<Real>(Real::value_type(1) / 3), make<Integer>(3), make<Multiplication>() });
+		BOOST_CHECK(convert<Real>(result)->get_value_as<double>() == 1.0);
+	}
+
+	BOOST_AUTO_TEST_CASE(test_conversion_integer) {
+		Integer::value_type large = pow(Integer::value_type(3), 300);
+		BOOST_CHECK(numeric_conversion::convert<Real::value_type>(large) == Real::value_type(large.str()));
+		BOOST_CHECK(numeric_conversion::convert<Real::value_type>(Integer::value_type(-large)) == Real::value_type("-" + large.str()));
+		BOOST_CHECK(numeric_conversion::convert<Real::value_type>(Integer::value_type("100000000000000000000")) == Real::value_type("1e20"));
+
+		auto result = RPNEvaluator().evaluate({ make<Integer>(large), make<Real>(Real::value_type("0.5")), make<Addition>() });
+		BOOST_CHECK(get_value<Real>(result) == Real::value_type(large.str() + ".5"));
+	}
+
+	BOOST_AUTO_TEST_CASE(test_conversion_range) {
+		BOOST_CHECK(numeric_conversion::narrow<int>(Integer::value_type(-5), "") == -5);
+		BOOST_CHECK_THROW(numeric_conversion::narrow<int>(Integer::value_type("4294967296"), ""), std::exception);
+		BOOST_CHECK_THROW(numeric_conversion::narrow<std::size_t>(std::int64_t(-1), ""), std::exception);
+
+		// exponents and result indices out of range are errors, not truncated
+		BOOST_CHECK_THROW(RPNEvaluator().evaluate({ make<Integer>(2), make<Integer>(Integer::value_type("4294967296")), make<Power>() }), std::exception);
+		BOOST_CHECK_THROW(RPNEvaluator().evaluate({ make<Real>(Real::value_type("1.5")), make<Integer>(Integer::value_type("-4294967296")), make<Power>() }), std::exception);
+		BOOST_CHECK_THROW(RPNEvaluator().evaluate({ make<Integer>(Integer::value_type("18446744073709551617")), make<Result>() }), std::exception);
+	}
+#endif // TEST_PRECISION
+
 #endif // TEST_RPN_EVALUATOR
 
 
@@ -730,6 +1073,31 @@ BOOST_AUTO_TEST_CASE(no_operand) {
 /*=============================================================
 
 Revision History
+Version 1.8.0: 2026-10-18
+Added test_result_history_limit.
+
+Version 1.7.0: 2026-10-18
+Added numeric conversion and range tests.
+
+Version 1.6.0: 2026-10-18
+Added product tree factorial tests.
+
+Version 1.5.0: 2026-10-18
+Added fib/pel/syl sequence, large index and Real argument tests.
+
+Version 1.4.0: 2026-10-18
+Added common subexpression sharing tests.
+
+Version 1.3.0: 2026-10-18
+Added constant folding tests.
+
+Version 1.2.0: 2026-10-18
+Added 64-bit Integer overflow and promotion tests.
+
+Version 1.1.0: 2026-10-18
+Added tests for Log, natural Ln, result(n) and compile()/execute().
+Added operand kind and type mismatch tests.
+
 Version 1.0.1: 2014-11-21
 Improved round() - reduced float point conversion errors.
 
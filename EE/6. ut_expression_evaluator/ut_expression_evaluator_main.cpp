@@ -1,23 +1,38 @@
 /** @file: ut_expression_evaluator.cpp
 	@author Garth Santor/Trinh Han
 	@author http://www.gats.ca/
-	@version 1.1.0
-	@date 2017-11-23
+	@version 1.21.0
+	@date 2026-10-18
 	@note Compiles under Visual C++ 15.4.4
 
 	@brief Expression Evaluator unit test.
 	*/
 #include "../ee_common/inc/expression_evaluator.hpp"
+#include "../ee_common/inc/batch_evaluator.hpp"
+#include "../ee_common/inc/parallel_evaluator.hpp"
+#include "../ee_common/inc/stream_evaluator.hpp"
+#include "../ee_common/inc/line_scanner.hpp"
+#include "../ee_common/inc/mapped_file.hpp"
 #include "../ee_common/inc/integer.hpp"
 #include "../ee_common/inc/real.hpp"
 #include "../ee_common/inc/variable.hpp"
 #include "../ee_common/inc/boolean.hpp"
+#include "../ee_common/inc/allocation_hooks.hpp"
+#include "../ee_common/inc/token_allocator.hpp"
 
 
 //#define _CRT_SECURE_NO_WARNINGS
 #define BOOST_TEST_MODULE ExpressionEvaluatorUnitTest
 #include <boost/test/auto_unit_test.hpp>
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <fstream>
+#include <limits>
+#include <sstream>
 #include <string>
+#include <thread>
+#include <vector>
 
 #include "../phase_list/ut_test_phase.hpp"
 
@@ -572,6 +587,18 @@ BOOST_AUTO_TEST_CASE( empty_expression ) {
 		#endif // TEST_BOOLEAN && TEST_NAMED_OPERATOR && TEST_RELATIONAL_OPERATOR
 	}
 
+	// the 'variable' keyword is a Variable of each evaluator's own
+	BOOST_AUTO_TEST_CASE(EE_variable_keyword) {
+		ExpressionEvaluator a, b;
+		a.evaluate("variable = 5");
+		b.evaluate("variable = 7");
+		BOOST_CHECK(get_value<Integer>(a.evaluate("variable + 1")) == Integer::value_type(6));
+		BOOST_CHECK(get_value<Integer>(b.evaluate("VaRiAbLe * 2")) == Integer::value_type(14));
+
+		ExpressionEvaluator c;
+		BOOST_CHECK(!get_value<Variable>(c.evaluate("variable")));
+	}
+
 	#if TEST_MIXED
 		BOOST_AUTO_TEST_CASE(EE_variable_mixed) {
 			ExpressionEvaluator ee;
@@ -599,12 +626,961 @@ BOOST_AUTO_TEST_CASE( empty_expression ) {
 	#endif // TEST_RESULT
 #endif // TEST_VARIABLE
 
+
+#if TEST_COMPILE && TEST_INTEGER && TEST_BINARY_OPERATOR
+	BOOST_AUTO_TEST_CASE(EE_compile_evaluate_many) {
+		ExpressionEvaluator ee;
+		auto compiled = ee.compile("2*3+4");
+		BOOST_CHECK(!compiled.empty());
+		for (int i = 0; i < 3; ++i) {
+			auto result = ee.evaluate(compiled);
+			BOOST_CHECK(get_value<Integer>(result) == Integer::value_type("10"));
+		}
+	}
+
+	BOOST_AUTO_TEST_CASE(EE_compile_empty) {
+		ExpressionEvaluator ee;
+		auto compiled = ee.compile("");
+		BOOST_CHECK(compiled.empty());
+	}
+
+	#if TEST_VARIABLE
+		BOOST_AUTO_TEST_CASE(EE_compile_variable_rebinding) {
+			ExpressionEvaluator ee;
+			auto compiled = ee.compile("x*3+y");
+			BOOST_CHECK(compiled.get_bindings().size() == 2);
+
+			ee.evaluate("x=3");
+			ee.evaluate("y=1");
+			auto result = ee.evaluate(compiled);
+			BOOST_CHECK(get_value<Integer>(result) == Integer::value_type("10"));
+
+			ee.evaluate("x=5");
+			result = ee.evaluate(compiled);
+			BOOST_CHECK(get_value<Integer>(result) == Integer::value_type("16"));
+		}
+
+		BOOST_AUTO_TEST_CASE(EE_compile_other_evaluator) {
+			ExpressionEvaluator ee1, ee2;
+			auto compiled = ee1.compile("y*2");
+			ee1.evaluate("y=4");
+			ee2.evaluate("y=21");
+			BOOST_CHECK(get_value<Integer>(ee1.evaluate(compiled)) == Integer::value_type("8"));
+			BOOST_CHECK(get_value<Integer>(ee2.evaluate(compiled)) == Integer::value_type("42"));
+			BOOST_CHECK(get_value<Integer>(ee1.evaluate(compiled)) == Integer::value_type("8"));
+		}
+	#endif // TEST_VARIABLE
+#endif // TEST_COMPILE
+
+#if TEST_PRECISION && TEST_REAL
+	BOOST_AUTO_TEST_CASE(EE_precision_default) {
+		ExpressionEvaluator ee;
+		BOOST_CHECK(ee.get_precision() == precision_type::DIGITS_1000);
+		auto result = ee.evaluate("0.5+0.25");
+		BOOST_CHECK(convert<Real>(result)->get_precision() == precision_type::DIGITS_1000);
+	}
+
+	BOOST_AUTO_TEST_CASE(EE_precision_double) {
+		ExpressionEvaluator ee;
+		ee.set_precision(precision_type::DOUBLE);
+		auto result = ee.evaluate("0.5+0.25");
+		BOOST_CHECK(convert<Real>(result)->get_precision() == precision_type::DOUBLE);
+		BOOST_CHECK(convert<Real>(result)->get_value_as<double>() == 0.75);
+
+		result = ee.evaluate("pi");
+		BOOST_CHECK(convert<Real>(result)->get_precision() == precision_type::DOUBLE);
+		BOOST_CHECK(convert<Real>(result)->get_value_as<double>() == boost::math::constants::pi<double>());
+	}
+
+	BOOST_AUTO_TEST_CASE(EE_precision_50) {
+		ExpressionEvaluator ee;
+		ee.set_precision(precision_for_digits(50));
+		BOOST_CHECK(ee.get_precision() == precision_type::DIGITS_50);
+		auto result = ee.evaluate("sqrt(2.0)");
+		BOOST_CHECK(convert<Real>(result)->get_precision() == precision_type::DIGITS_50);
+		BOOST_CHECK(convert<Real>(result)->get_value_as<Real::digits50_type>() == sqrt(Real::digits50_type(2)));
+	}
+
+	BOOST_AUTO_TEST_CASE(EE_precision_shared_constants) {
+		BOOST_CHECK(Pi::instance() == Pi::instance());
+		BOOST_CHECK(Pi::instance(precision_type::DOUBLE).get() == Pi::instance(precision_type::DOUBLE).get());
+		BOOST_CHECK(E::instance(precision_type::DIGITS_50)->get_precision() == precision_type::DIGITS_50);
+
+		ExpressionEvaluator ee1, ee2;
+		ee1.set_precision(precision_type::DOUBLE);
+		ee2.set_precision(precision_type::DOUBLE);
+		BOOST_CHECK(ee1.evaluate("pi").get() == ee2.evaluate("pi").get());
+		BOOST_CHECK(ee1.evaluate("pi").get() == Pi::instance(precision_type::DOUBLE).get());
+	}
+
+	BOOST_AUTO_TEST_CASE(EE_precision_for_digits) {
+		BOOST_CHECK(precision_for_digits(10) == precision_type::DOUBLE);
+		BOOST_CHECK(precision_for_digits(40) == precision_type::DIGITS_50);
+		BOOST_CHECK(precision_for_digits(100) == precision_type::DIGITS_100);
+		BOOST_CHECK(precision_for_digits(500) == precision_type::DIGITS_1000);
+	}
+#endif // TEST_PRECISION
+
+#if TEST_BATCH && TEST_VARIABLE && TEST_MIXED && TEST_BOOLEAN && TEST_RELATIONAL_OPERATOR
+	BOOST_AUTO_TEST_CASE(EE_batch_arithmetic) {
+		// more than two blocks, the last one partial
+		size_t const ROWS = 2 * BatchEvaluator::BLOCK_SIZE + 7;
+		std::vector<column_integer_type> x(ROWS);
+		std::vector<column_real_type> y(ROWS);
+		for (size_t i = 0; i < ROWS; ++i) {
+			x[i] = column_integer_type(i);
+			y[i] = i * 0.5;
+		}
+
+		ExpressionEvaluator ee;
+		BatchEvaluator batch(ee.compile("x * 2 - -y / 4"));
+		batch.bind("x", x);
+		batch.bind("y", y);
+		BOOST_CHECK(batch.result_kind() == column_kind::REAL);
+
+		Column out;
+		batch.evaluate(out);
+		BOOST_REQUIRE_EQUAL(out.size(), ROWS);
+		for (size_t i = 0; i < ROWS; ++i)
+			BOOST_CHECK_EQUAL(out.reals()[i], x[i] * 2 + y[i] / 4);
+	}
+
+	BOOST_AUTO_TEST_CASE(EE_batch_integer_broadcast) {
+		std::vector<column_integer_type> x = { 1, 2, 3, -4 };
+		ExpressionEvaluator ee;
+		ee.evaluate("k = 10");
+		BatchEvaluator batch(ee.compile("x * k % 7"));
+		batch.bind("x", x);
+
+		Column out;
+		batch.evaluate(out);
+		BOOST_CHECK(out.get_kind() == column_kind::INTEGER);
+		BOOST_CHECK(out.integers() == std::vector<column_integer_type>({ 3, 6, 2, -5 }));
+	}
+
+	BOOST_AUTO_TEST_CASE(EE_batch_relational_logical) {
+		std::vector<column_integer_type> x = { 5, 15, 25, 35 };
+		std::vector<column_real_type> y = { 1.0, 20.0, 20.0, 40.0 };
+		std::vector<column_boolean_type> b = { 1, 1, 0, 1 };
+		ExpressionEvaluator ee;
+		BatchEvaluator batch(ee.compile("(x > 10 and b) or not (x < y)"));
+		batch.bind("x", x);
+		batch.bind("y", y);
+		batch.bind("b", b);
+
+		Column out;
+		batch.evaluate(out);
+		BOOST_CHECK(out.get_kind() == column_kind::BOOLEAN);
+		BOOST_CHECK(out.booleans() == std::vector<column_boolean_type>({ 1, 1, 1, 1 }));
+	}
+
+	BOOST_AUTO_TEST_CASE(EE_batch_range) {
+		std::vector<column_integer_type> x(3000, 2);
+		ExpressionEvaluator ee;
+		BatchEvaluator batch(ee.compile("x + 1"));
+		batch.bind("x", x);
+
+		Column out;
+		out.reset(batch.result_kind(), batch.rows());
+		batch.evaluate(1000, 2500, out);
+		BOOST_CHECK_EQUAL(out.integers()[999], 0);
+		BOOST_CHECK_EQUAL(out.integers()[1000], 3);
+		BOOST_CHECK_EQUAL(out.integers()[2499], 3);
+		BOOST_CHECK_EQUAL(out.integers()[2500], 0);
+	}
+
+	BOOST_AUTO_TEST_CASE(EE_batch_errors) {
+		std::vector<column_integer_type> x = { 1, (std::numeric_limits<column_integer_type>::max)() };
+		std::vector<column_integer_type> shorter = { 1 };
+		ExpressionEvaluator ee;
+
+		BatchEvaluator overflow(ee.compile("x + 1"));
+		overflow.bind("x", x);
+		Column out;
+		BOOST_CHECK_THROW(overflow.evaluate(out), std::exception);
+		BOOST_CHECK_THROW(overflow.bind("y", shorter), std::exception);
+
+		BatchEvaluator unsupported(ee.compile("sin(x)"));
+		unsupported.bind("x", x);
+		BOOST_CHECK_THROW(unsupported.evaluate(out), std::exception);
+
+		BatchEvaluator uninitialized(ee.compile("x + z"));
+		uninitialized.bind("x", x);
+		BOOST_CHECK_THROW(uninitialized.evaluate(out), std::exception);
+	}
+#endif // TEST_BATCH
+
+#if TEST_PARALLEL && TEST_BATCH && TEST_VARIABLE && TEST_INTEGER && TEST_BINARY_OPERATOR
+	BOOST_AUTO_TEST_CASE(EE_work_stealing_pool_each_task_once) {
+		WorkStealingPool pool(4);
+		BOOST_CHECK_EQUAL(pool.size(), 4u);
+
+		// uneven task costs, so that workers run out early and steal
+		// (Boost.Test assertions are not thread-safe, so the tasks only count)
+		size_t const TASKS = 1000;
+		std::vector<std::atomic<int>> runs(TASKS);
+		std::atomic<size_t> badWorkers(0);
+		for (int pass = 0; pass < 3; ++pass)
+			pool.run(TASKS, [&](size_t task, size_t worker) {
+				if (worker >= 4)
+					++badWorkers;
+				if (task < 50)
+					std::this_thread::sleep_for(std::chrono::microseconds(200));
+				++runs[task];
+			});
+		BOOST_CHECK_EQUAL(badWorkers.load(), 0u);
+		for (auto const& count : runs)
+			BOOST_CHECK_EQUAL(count.load(), 3);
+	}
+
+	BOOST_AUTO_TEST_CASE(EE_parallel_jobs) {
+		ParallelEvaluator parallel(4);
+		ParallelEvaluator::job_list_type jobs;
+		for (int i = 0; i < 200; ++i) {
+			ParallelEvaluator::Job job{ "x * x + 1", {} };
+			job.bindings.push_back({ "x", make_operand<Integer>(Integer::small_type(i)) });
+			jobs.push_back(job);
+		}
+		jobs.push_back({ "2 ** 100", {} });
+
+		ParallelEvaluator::result_list_type results = parallel.evaluate(jobs);
+		BOOST_REQUIRE_EQUAL(results.size(), jobs.size());
+		for (int i = 0; i < 200; ++i)
+			BOOST_CHECK(get_value<Integer>(results[i]) == Integer::value_type(i * i + 1));
+		BOOST_CHECK(get_value<Integer>(results[200]) == Integer::value_type("1267650600228229401496703205376"));
+	}
+
+	BOOST_AUTO_TEST_CASE(EE_parallel_jobs_error) {
+		ParallelEvaluator parallel(4);
+		ParallelEvaluator::job_list_type jobs(100, ParallelEvaluator::Job{ "1 + 1", {} });
+		jobs[70].expression = "1 + undefined";
+		jobs[30].expression = "1 +";
+		try {
+			parallel.evaluate(jobs);
+			BOOST_FAIL("exception not thrown");
+		}
+		catch (std::exception& e) {
+			// job 30's error, whichever job failed first
+			BOOST_CHECK_EQUAL(e.what(), std::string("Insufficient number of operands for operation"));
+		}
+	}
+
+	BOOST_AUTO_TEST_CASE(EE_parallel_jobs_isolated) {
+		// one worker runs every job with the same evaluator: no job sees another's variables
+		ParallelEvaluator parallel(1);
+		ParallelEvaluator::job_list_type jobs = {
+			{ "y = 5", {} },
+			{ "x * 2", { { "x", make_operand<Integer>(Integer::small_type(3)) } } },
+			{ "y", {} },
+			{ "x", {} },
+			{ "x", { { "x", make_operand<Integer>(Integer::small_type(4)) } } },
+		};
+		for (int pass = 0; pass < 2; ++pass) {
+			ParallelEvaluator::result_list_type results = parallel.evaluate(jobs);
+			BOOST_CHECK(get_value<Integer>(results[0]) == Integer::value_type(5));
+			BOOST_CHECK(get_value<Integer>(results[1]) == Integer::value_type(6));
+			BOOST_CHECK(is<Variable>(results[2]) && !get_value<Variable>(results[2]));
+			BOOST_CHECK(is<Variable>(results[3]) && !get_value<Variable>(results[3]));
+			BOOST_CHECK(get_value<Integer>(results[4]) == Integer::value_type(4));
+		}
+	}
+
+	BOOST_AUTO_TEST_CASE(EE_parallel_batch) {
+		size_t const ROWS = 5 * ParallelEvaluator::CHUNK_ROWS + 123;
+		std::vector<column_integer_type> x(ROWS);
+		for (size_t i = 0; i < ROWS; ++i)
+			x[i] = column_integer_type(i);
+
+		ExpressionEvaluator ee;
+		BatchEvaluator batch(ee.compile("x * 3 - 1"));
+		batch.bind("x", x);
+
+		Column serial, parallel;
+		batch.evaluate(serial);
+		ParallelEvaluator(3).evaluate(batch, parallel);
+		BOOST_CHECK(parallel.get_kind() == column_kind::INTEGER);
+		BOOST_CHECK(parallel.integers() == serial.integers());
+	}
+#endif // TEST_PARALLEL
+
+#if TEST_ENVIRONMENT && TEST_VARIABLE && TEST_INTEGER && TEST_BINARY_OPERATOR
+	BOOST_AUTO_TEST_CASE(EE_environment_shared) {
+		auto environment = std::make_shared<Environment>();
+		ExpressionEvaluator writer(environment), reader(environment);
+		writer.evaluate("x = 5");
+		BOOST_CHECK(get_value<Integer>(reader.evaluate("x * 2")) == Integer::value_type(10));
+
+		// a program compiled by one evaluator is bound to the other's variables too
+		auto compiled = reader.compile("x + 1");
+		writer.evaluate("x = 7");
+		BOOST_CHECK(get_value<Integer>(writer.evaluate(compiled)) == Integer::value_type(8));
+	}
+
+	BOOST_AUTO_TEST_CASE(EE_environment_snapshot) {
+		Environment environment;
+		auto x = environment.get_variable("x");
+		auto before = environment.snapshot();
+
+		environment.publish({ { "x", make_operand<Integer>(Integer::small_type(1)) }, { "y", make_operand<Integer>(Integer::small_type(2)) } });
+		auto after = environment.snapshot();
+		BOOST_CHECK_EQUAL(after->version, before->version + 1);
+		BOOST_CHECK(!before->value(convert<Variable>(x)->get_slot()));
+		BOOST_CHECK(get_value<Integer>(after->value(convert<Variable>(x)->get_slot())) == Integer::value_type(1));
+		BOOST_CHECK(get_value<Integer>(get_value<Variable>(environment.get_variable("y"))) == Integer::value_type(2));
+	}
+
+	BOOST_AUTO_TEST_CASE(EE_environment_names) {
+		Environment environment, other;
+		auto x = environment.get_variable("x");
+		auto y = environment.get_variable("y");
+		BOOST_CHECK_EQUAL(environment.find_variable_name(y), "y");
+		BOOST_CHECK_EQUAL(environment.find_variable_name(x), "x");
+		BOOST_CHECK(environment.get_variable("x").get() == x.get());
+		BOOST_CHECK_EQUAL(environment.find_variable_name(other.get_variable("x")), "");
+		BOOST_CHECK_EQUAL(environment.find_variable_name(make<Variable>()), "");
+		BOOST_CHECK_EQUAL(environment.find_variable_name(make<Integer>()), "");
+	}
+
+	BOOST_AUTO_TEST_CASE(EE_environment_reader) {
+		Environment environment, other;
+		environment.publish({ { "x", make_operand<Integer>(Integer::small_type(1)) } });
+		other.publish({ { "x", make_operand<Integer>(Integer::small_type(2)) } });
+
+		VariableStore::Reader reader;
+		auto first = reader.snapshot(environment.get_store());
+		BOOST_CHECK(reader.snapshot(environment.get_store()) == first);		// unchanged: the cached snapshot
+		BOOST_CHECK_EQUAL(environment.get_store().version(), first->version);
+
+		environment.publish({ { "x", make_operand<Integer>(Integer::small_type(3)) } });
+		auto second = reader.snapshot(environment.get_store());
+		BOOST_CHECK(second != first);
+		BOOST_CHECK_EQUAL(second->version, first->version + 1);
+		BOOST_CHECK(reader.snapshot(other.get_store()) != second);		// a different store
+	}
+
+	BOOST_AUTO_TEST_CASE(EE_environment_concurrent_snapshots) {
+		// y is always published together with x, as 2x: every evaluation must see a matching pair
+		auto environment = std::make_shared<Environment>();
+		environment->publish({ { "x", make_operand<Integer>(Integer::small_type(0)) }, { "y", make_operand<Integer>(Integer::small_type(0)) } });
+
+		std::atomic<bool> done(false);
+		std::atomic<int> mismatches(0);
+		std::vector<std::thread> readers;
+		for (int i = 0; i < 3; ++i)
+			readers.emplace_back([&] {
+				ExpressionEvaluator ee(environment);
+				auto compiled = ee.compile("y - x * 2");
+				while (!done)
+					if (get_value<Integer>(ee.evaluate(compiled)) != 0)
+						++mismatches;
+			});
+
+		for (Integer::small_type n = 1; n <= 2000; ++n)
+			environment->publish({ { "x", make_operand<Integer>(n) }, { "y", make_operand<Integer>(2 * n) } });
+		done = true;
+		for (auto& reader : readers)
+			reader.join();
+
+		BOOST_CHECK_EQUAL(mismatches.load(), 0);
+	}
+#endif // TEST_ENVIRONMENT
+
+#if TEST_FOLD && TEST_VARIABLE && TEST_FUNCTION && TEST_MIXED
+	BOOST_AUTO_TEST_CASE(EE_fold_compiled) {
+		ExpressionEvaluator ee;
+		auto compiled = ee.compile("x * (2 ** 10) / sqrt(2.0)");
+		BOOST_CHECK(compiled.get_program().size() == 5);
+		BOOST_REQUIRE(compiled.get_bindings().size() == 1);
+		BOOST_CHECK(compiled.get_bindings()[0].position == 0);
+
+		// re-bound by another evaluator through the folded positions
+		ExpressionEvaluator other;
+		other.evaluate("x = 2");
+		ExpressionEvaluator reference;
+		BOOST_CHECK(other.evaluate(compiled)->to_string() == reference.evaluate("2 * 1024 / sqrt(2.0)")->to_string());
+	}
+#endif // TEST_FOLD
+
+#if TEST_SHARE && TEST_VARIABLE && TEST_FUNCTION && TEST_MIXED
+	BOOST_AUTO_TEST_CASE(EE_share_compiled) {
+		ExpressionEvaluator ee;
+		ee.evaluate("a = 7.5");
+		ee.evaluate("b = 2");
+		auto compiled = ee.compile("(a - b) ** 2 / (a - b) + ln(a) * ln(a)");
+		BOOST_CHECK_EQUAL(compiled.get_deduplicated(), 2u);
+		BOOST_CHECK(ee.compile("a - b").get_deduplicated() == 0);
+		BOOST_CHECK(ee.evaluate(compiled)->to_string() == ee.evaluate("5.5 ** 2 / 5.5 + ln(7.5) * ln(7.5)")->to_string());
+
+		// re-bound by another evaluator
+		ExpressionEvaluator other;
+		other.evaluate("a = 4");
+		other.evaluate("b = 1");
+		BOOST_CHECK(other.evaluate(compiled)->to_string() == other.evaluate("3 ** 2 / 3 + ln(4) * ln(4)")->to_string());
+	}
+
+	BOOST_AUTO_TEST_CASE(EE_share_deep) {
+		// 100k terms nest 100k deep, and the repeated a * 2 is shared
+		std::size_t const TERMS = 100000;
+		std::string expression = "1";
+		for (std::size_t i = 1; i < TERMS; ++i)
+			expression += " + a * 2";
+
+		ExpressionEvaluator ee;
+		ee.evaluate("a = 3");
+		auto compiled = ee.compile(expression);
+		BOOST_CHECK_EQUAL(compiled.get_deduplicated(), TERMS - 2);
+		BOOST_CHECK(get_value<Integer>(ee.evaluate(compiled)) == Integer::value_type(1 + 6 * (TERMS - 1)));
+	}
+
+	#if TEST_BATCH
+		BOOST_AUTO_TEST_CASE(EE_share_batch) {
+			size_t const ROWS = BatchEvaluator::BLOCK_SIZE + 3;
+			std::vector<column_real_type> x(ROWS);
+			for (size_t i = 0; i < ROWS; ++i)
+				x[i] = i * 0.25;
+
+			ExpressionEvaluator ee;
+			auto compiled = ee.compile("(x * 3 - 1) * (x * 3 - 1) + (x * 3 - 1)");
+			BOOST_CHECK_EQUAL(compiled.get_deduplicated(), 4u);
+			BatchEvaluator batch(compiled);
+			batch.bind("x", x);
+
+			Column out;
+			batch.evaluate(out);
+			BOOST_REQUIRE_EQUAL(out.size(), ROWS);
+			for (size_t i = 0; i < ROWS; ++i)
+				BOOST_CHECK_EQUAL(out.reals()[i], (x[i] * 3 - 1) * (x[i] * 3 - 1) + (x[i] * 3 - 1));
+		}
+	#endif // TEST_BATCH
+#endif // TEST_SHARE
+
+#if TEST_DEPENDENCY
+	BOOST_AUTO_TEST_CASE(EE_dependency_graph_order) {
+		// a -> b -> d, a -> c -> d
+		DependencyGraph graph;
+		BOOST_CHECK(graph.define("b", { "a" }));
+		BOOST_CHECK(graph.define("c", { "a" }));
+		BOOST_CHECK(graph.define("d", { "b", "c" }));
+		auto order = graph.dependents("a");
+		BOOST_REQUIRE_EQUAL(order.size(), 3u);
+		BOOST_CHECK(order.back() == "d");
+		BOOST_CHECK(graph.dependents("d").empty());
+
+		graph.undefine("d");
+		BOOST_CHECK(!graph.is_defined("d"));
+		BOOST_CHECK_EQUAL(graph.dependents("a").size(), 2u);
+	}
+
+	BOOST_AUTO_TEST_CASE(EE_dependency_graph_cycle) {
+		DependencyGraph graph;
+		BOOST_CHECK(graph.define("b", { "a" }));
+		BOOST_CHECK(graph.define("c", { "b" }));
+		BOOST_CHECK(!graph.define("a", { "c" }));
+		BOOST_CHECK(!graph.define("x", { "x" }));
+		BOOST_CHECK(!graph.is_defined("a"));
+		BOOST_CHECK_EQUAL(graph.dependents("a").size(), 2u);
+	}
+
+	#if TEST_VARIABLE && TEST_INTEGER && TEST_BINARY_OPERATOR
+		BOOST_AUTO_TEST_CASE(EE_dependency_refresh) {
+			ExpressionEvaluator ee;
+			ee.evaluate("a = 2");
+			ee.evaluate("price = 3");
+			ee.evaluate("fee = 1");
+			ee.evaluate("total = a * price + fee");
+			ee.evaluate("doubled = total * 2");
+			BOOST_CHECK(get_value<Integer>(get_value<Variable>(ee.evaluate("doubled"))) == Integer::value_type(14));
+
+			ee.evaluate("a = 5");
+			BOOST_CHECK(ee.get_refreshed() == std::vector<std::string>({ "total", "doubled" }));
+			BOOST_CHECK(get_value<Integer>(get_value<Variable>(ee.evaluate("total"))) == Integer::value_type(16));
+			BOOST_CHECK(get_value<Integer>(get_value<Variable>(ee.evaluate("doubled"))) == Integer::value_type(32));
+			BOOST_CHECK(ee.get_refreshed().empty());
+
+			// only the dependents of the changed variable
+			ee.evaluate("unrelated = fee + 100");
+			ee.evaluate("price = 10");
+			BOOST_CHECK(ee.get_refreshed() == std::vector<std::string>({ "total", "doubled" }));
+			ee.set_variable("fee", make_operand<Integer>(Integer::small_type(0)));
+			BOOST_CHECK(ee.get_refreshed() == std::vector<std::string>({ "unrelated", "total", "doubled" }));
+			BOOST_CHECK(get_value<Integer>(get_value<Variable>(ee.evaluate("doubled"))) == Integer::value_type(100));
+
+			// a constant makes total a plain value again
+			ee.evaluate("total = 1");
+			BOOST_CHECK(ee.get_refreshed() == std::vector<std::string>({ "doubled" }));
+			ee.evaluate("a = 1");
+			BOOST_CHECK(ee.get_refreshed().empty());
+			BOOST_CHECK(get_value<Integer>(get_value<Variable>(ee.evaluate("doubled"))) == Integer::value_type(2));
+		}
+
+		BOOST_AUTO_TEST_CASE(EE_dependency_cycle) {
+			ExpressionEvaluator ee;
+			ee.evaluate("x = 1");
+			ee.evaluate("x = x + 1");
+			ee.evaluate("x = x + 1");
+			BOOST_CHECK(get_value<Integer>(get_value<Variable>(ee.evaluate("x"))) == Integer::value_type(3));
+
+			// a = y + 1 would close y -> a -> y: a is assigned once and y is recomputed
+			ee.evaluate("y = x * 2");
+			ee.evaluate("x = y + 1");
+			BOOST_CHECK(ee.get_refreshed() == std::vector<std::string>({ "y" }));
+			BOOST_CHECK(get_value<Integer>(get_value<Variable>(ee.evaluate("x"))) == Integer::value_type(7));
+			BOOST_CHECK(get_value<Integer>(get_value<Variable>(ee.evaluate("y"))) == Integer::value_type(14));
+		}
+
+		BOOST_AUTO_TEST_CASE(EE_dependency_result_history) {
+			// recomputed formulas are not results
+			ExpressionEvaluator ee;
+			ee.evaluate("a = 1");
+			ee.evaluate("b = a + 1");
+			ee.evaluate("a = 10");
+			BOOST_CHECK(get_value<Integer>(ee.evaluate("result(3) + 0")) == Integer::value_type(10));
+		}
+	#endif // TEST_VARIABLE
+#endif // TEST_DEPENDENCY
+
+#if TEST_STATS && TEST_VARIABLE && TEST_MIXED && TEST_BINARY_OPERATOR
+	BOOST_AUTO_TEST_CASE(EE_stats_off) {
+		ExpressionEvaluator ee;
+		BOOST_CHECK(!ee.stats_enabled());
+		ee.evaluate("x = 3");
+		ee.evaluate("x * x");
+		BOOST_CHECK_EQUAL(ee.stats().expressions, 0u);
+		BOOST_CHECK_EQUAL(ee.stats().peak_stack_depth, 0u);
+	}
+
+	BOOST_AUTO_TEST_CASE(EE_stats_counters) {
+		ExpressionEvaluator ee;
+		ee.evaluate("x = 3");
+		ee.evaluate("big = 2 ** 100");
+		ee.evaluate("r = 1.5");
+
+		ee.enable_stats(true);
+		BOOST_CHECK(ee.stats_enabled());
+		ee.evaluate("x + x * x");
+		BOOST_CHECK_EQUAL(ee.stats().expressions, 1u);
+		BOOST_CHECK_EQUAL(ee.stats().evaluations, 1u);
+		BOOST_CHECK_EQUAL(ee.stats().tokens, 5u);
+		BOOST_CHECK_EQUAL(ee.stats().instructions, 5u);
+		BOOST_CHECK_EQUAL(ee.stats().peak_stack_depth, 3u);
+		BOOST_CHECK_EQUAL(ee.stats().big_integer_operations, 0u);
+		BOOST_CHECK_EQUAL(ee.stats().real_operations, 0u);
+
+		ee.evaluate("big * x");
+		ee.evaluate("r * x - x");
+		BOOST_CHECK_EQUAL(ee.stats().expressions, 3u);
+		BOOST_CHECK_EQUAL(ee.stats().big_integer_operations, 1u);
+		BOOST_CHECK_EQUAL(ee.stats().real_operations, 2u);
+
+		// a compiled expression counts only as an evaluation
+		auto compiled = ee.compile("x * 2");
+		ee.evaluate(compiled);
+		ee.evaluate(compiled);
+		BOOST_CHECK_EQUAL(ee.stats().expressions, 4u);
+		BOOST_CHECK_EQUAL(ee.stats().evaluations, 5u);
+
+		ee.enable_stats(false);
+		ee.evaluate("x * x * x * x");
+		BOOST_CHECK_EQUAL(ee.stats().expressions, 4u);
+		BOOST_CHECK_EQUAL(ee.stats().peak_stack_depth, 3u);
+
+		ee.reset_stats();
+		BOOST_CHECK_EQUAL(ee.stats().evaluations, 0u);
+		BOOST_CHECK_EQUAL(ee.stats().nanoseconds[index_of(phase_type::EVALUATE)], 0u);
+	}
+
+	BOOST_AUTO_TEST_CASE(EE_stats_prometheus) {
+		ExpressionEvaluator ee;
+		ee.enable_stats(true);
+		ee.evaluate("1.5 * 2");
+		std::string const text = ee.stats().to_prometheus();
+		BOOST_CHECK(text.find("# TYPE ee_expressions_total counter\nee_expressions_total 1\n") != std::string::npos);
+		BOOST_CHECK(text.find("ee_phase_seconds_total{phase=\"tokenize\"} ") != std::string::npos);
+		BOOST_CHECK(text.find("ee_phase_seconds_total{phase=\"evaluate\"} ") != std::string::npos);
+		BOOST_CHECK(text.find("ee_operand_stack_peak 1\n") != std::string::npos);
+	}
+#endif // TEST_STATS
+
+#if TEST_ALLOCATION && TEST_VARIABLE && TEST_MIXED && TEST_BINARY_OPERATOR
+	// Counts allocations for the life of the test
+	struct AllocationCounting {
+		AllocationCounting() { allocation_tracking::reset(); allocation_tracking::enable(true); }
+		~AllocationCounting() { allocation_tracking::enable(false); allocation_tracking::reset(); }
+	};
+
+	// Gets the token pool allocations of the token type 'name'
+	uint64_t token_allocations(std::string const& name) {
+		for (auto const& type : allocation_tracking::by_token_type())
+			if (type.name == name)
+				return type.counts.allocations;
+		return 0;
+	}
+
+	BOOST_AUTO_TEST_CASE(EE_allocation_off) {
+		allocation_tracking::reset();
+		ExpressionEvaluator ee;
+		ee.evaluate("1 + 2 * 3");
+		BOOST_CHECK(!allocation_tracking::enabled());
+		BOOST_CHECK_EQUAL(allocation_tracking::by_phase().tokens_total().allocations, 0u);
+		BOOST_CHECK_EQUAL(allocation_tracking::by_phase().heap_total().allocations, 0u);
+	}
+
+	BOOST_AUTO_TEST_CASE(EE_allocation_tokens) {
+		ExpressionEvaluator ee;
+		ee.evaluate("x = 3");
+		ee.evaluate("r = 1.5");
+
+		AllocationCounting counting;
+		auto result = ee.evaluate("x * 2 + 1");
+		auto counts = allocation_tracking::by_phase();
+		// the literals and operators; the variable is already bound
+		BOOST_CHECK_EQUAL(counts.tokens[index_of(allocation_phase::TOKENIZE)].allocations, 4u);
+		BOOST_CHECK_EQUAL(counts.tokens[index_of(allocation_phase::PARSE)].allocations, 0u);
+		BOOST_CHECK_EQUAL(counts.tokens[index_of(allocation_phase::COMPILE)].allocations, 0u);
+		// one Integer per operation
+		BOOST_CHECK_EQUAL(counts.tokens[index_of(allocation_phase::EVALUATE)].allocations, 2u);
+		BOOST_CHECK_EQUAL(counts.tokens[index_of(allocation_phase::OTHER)].allocations, 0u);
+		BOOST_CHECK_EQUAL(token_allocations("Integer"), 4u);
+		BOOST_CHECK_EQUAL(token_allocations("Multiplication"), 1u);
+		BOOST_CHECK_EQUAL(token_allocations("Addition"), 1u);
+		BOOST_CHECK(allocation_tracking::hooks_linked());
+		BOOST_CHECK_GT(counts.heap[index_of(allocation_phase::TOKENIZE)].allocations, 0u);
+
+		{
+			allocation_tracking::PhaseScope format(allocation_phase::FORMAT);
+			BOOST_CHECK(result->to_string() == "Integer: 7");
+		}
+		BOOST_CHECK_EQUAL(allocation_tracking::by_phase().tokens[index_of(allocation_phase::FORMAT)].allocations, 0u);
+		BOOST_CHECK(allocation_tracking::current_phase() == allocation_phase::OTHER);
+
+		// constant subexpressions are folded once, at compile time
+		allocation_tracking::reset();
+		ee.evaluate("r * (2 ** 3) - r");
+		counts = allocation_tracking::by_phase();
+		BOOST_CHECK_EQUAL(counts.tokens[index_of(allocation_phase::COMPILE)].allocations, 1u);
+		BOOST_CHECK_EQUAL(counts.tokens[index_of(allocation_phase::EVALUATE)].allocations, 2u);
+		BOOST_CHECK_EQUAL(token_allocations("Real"), 2u);
+
+		// a compiled expression allocates only its results
+		auto compiled = ee.compile("x * x");
+		allocation_tracking::reset();
+		for (int i = 0; i < 10; ++i)
+			ee.evaluate(compiled);
+		counts = allocation_tracking::by_phase();
+		BOOST_CHECK_EQUAL(counts.tokens_total().allocations, 10u);
+		BOOST_CHECK_EQUAL(counts.tokens[index_of(allocation_phase::EVALUATE)].allocations, 10u);
+	}
+#endif // TEST_ALLOCATION
+
+#if TEST_STREAM && TEST_VARIABLE && TEST_RESULT && TEST_INTEGER && TEST_BINARY_OPERATOR
+	BOOST_AUTO_TEST_CASE(EE_stream_lines) {
+		ExpressionEvaluator ee;
+		StreamEvaluator stream(ee);
+		std::istringstream in("x = 3\n\n   \nx * 2\n1 +\r\nresult(2) + 1\ny\nx = 10\n");
+		std::ostringstream out, errors;
+		auto summary = stream.run(in, out, errors);
+		BOOST_CHECK_EQUAL(out.str(), "[1] = Integer: 3\n[4] = Integer: 6\n[6] = Integer: 7\n[8] = Integer: 10\n");
+		BOOST_CHECK(errors.str().find("[5] ") == 0);
+		BOOST_CHECK(errors.str().find("\n[7] ") != std::string::npos);
+		BOOST_CHECK_EQUAL(summary.lines, 6u);
+		BOOST_CHECK_EQUAL(summary.errors, 2u);
+		BOOST_CHECK(summary.maxLatency >= summary.medianLatency);
+		BOOST_CHECK(get_value<Integer>(get_value<Variable>(ee.evaluate("x"))) == Integer::value_type(10));
+	}
+
+	BOOST_AUTO_TEST_CASE(EE_stream_order) {
+		// enough chunks that the compilers overtake each other
+		std::size_t const LINES = 40 * StreamEvaluator::CHUNK_LINES;
+		std::ostringstream in, expected;
+		in << "n = 0\n";
+		expected << "[1] 0\n";
+		for (std::size_t i = 2; i <= LINES; ++i) {
+			in << "n = n + " << i << "\n";
+			expected << "[" << i << "] " << i * (i + 1) / 2 - 1 << "\n";
+		}
+
+		ExpressionEvaluator ee;
+		StreamEvaluator stream(ee, [](Token::pointer_type const& result) { return result->to_string().substr(9); }, 4);
+		BOOST_CHECK_EQUAL(stream.compilers(), 4u);
+		std::istringstream input(in.str());
+		std::ostringstream out, errors;
+		auto summary = stream.run(input, out, errors);
+		std::string text = out.str();
+		for (std::size_t at = text.find("] = "); at != std::string::npos; at = text.find("] = ", at))
+			text.replace(at, 4, "] ");
+		BOOST_CHECK(text == expected.str());
+		BOOST_CHECK(errors.str().empty());
+		BOOST_CHECK_EQUAL(summary.lines, LINES);
+		BOOST_CHECK(summary.throughput() > 0);
+	}
+
+	BOOST_AUTO_TEST_CASE(EE_stream_history) {
+		// result(n) reaches the last HISTORY_RESULTS results; the tokens of each line are made and released on
+		// different threads, and the token pool must not grow with the number of lines
+		std::size_t const HISTORY = StreamEvaluator::HISTORY_RESULTS;
+		ExpressionEvaluator ee;
+		StreamEvaluator stream(ee);
+		std::size_t total = 0, warmChunks = 0;
+		for (std::size_t lines : { 2 * HISTORY, 8 * HISTORY, 32 * HISTORY }) {
+			std::ostringstream in;
+			for (std::size_t i = 1; i < lines; ++i)
+				in << i << "\n";
+			in << "result(" << total + lines - 1 << ") + result(" << total + lines - HISTORY << ")\nresult(1)\n";
+			total += lines;
+
+			std::istringstream input(in.str());
+			std::ostringstream out, errors;
+			auto summary = stream.run(input, out, errors);
+			BOOST_CHECK_EQUAL(summary.lines, lines + 1);
+			BOOST_CHECK(out.str().find("[" + std::to_string(lines) + "] = Integer: " + std::to_string(2 * lines - 1 - HISTORY) + "\n") != std::string::npos);
+			BOOST_CHECK_EQUAL(errors.str(), "[" + std::to_string(lines + 1) + "] Error: result no longer kept.\n");
+			BOOST_CHECK_EQUAL(ee.get_history_limit(), std::numeric_limits<std::size_t>::max());
+			if (lines == 8 * HISTORY)
+				warmChunks = token_pool::chunks_allocated();
+		}
+		std::size_t const chunks = token_pool::chunks_allocated() - warmChunks;
+		BOOST_TEST_MESSAGE("token pool chunks added after warming: " << chunks);
+		BOOST_CHECK_LE(chunks, 8u);
+	}
+#endif // TEST_STREAM
+
+
+
+#if TEST_MAPPED
+	BOOST_AUTO_TEST_CASE(EE_line_scanner) {
+		// every alignment of a newline, either side of each 16 byte block
+		for (std::size_t length = 0; length <= 70; ++length)
+			for (std::size_t step = 1; step <= 17; ++step) {
+				std::string text(length, 'x');
+				std::vector<std::size_t> expected;
+				for (std::size_t i = step - 1; i < length; i += step) {
+					text[i] = '\n';
+					expected.push_back(i);
+				}
+				std::vector<std::size_t> found = { 99 };
+				line_scanner::find_newlines(text, found);
+				found.erase(found.begin());
+				BOOST_CHECK(found == expected);
+			}
+	}
+
+	BOOST_AUTO_TEST_CASE(EE_stream_view) {
+		std::string const text = "x = 3\r\n\n   \nx * 2\n1 +\r\nresult(2) + 1\ny\nx = 10";
+		for (std::size_t shard = 1; shard <= text.size() + 1; shard += 4) {
+			ExpressionEvaluator ee;
+			StreamEvaluator stream(ee, StreamEvaluator::formatter_type(), 2);
+			stream.set_shard_bytes(shard);
+			BOOST_CHECK_EQUAL(stream.get_shard_bytes(), shard);
+			std::ostringstream out, errors;
+			auto summary = stream.run(StreamEvaluator::view_type(text), out, errors);
+			BOOST_CHECK_EQUAL(out.str(), "[1] = Integer: 3\n[4] = Integer: 6\n[6] = Integer: 7\n[8] = Integer: 10\n");
+			BOOST_CHECK(errors.str().find("[5] ") == 0);
+			BOOST_CHECK(errors.str().find("\n[7] ") != std::string::npos);
+			BOOST_CHECK_EQUAL(summary.lines, 6u);
+			BOOST_CHECK_EQUAL(summary.errors, 2u);
+		}
+	}
+
+	BOOST_AUTO_TEST_CASE(EE_stream_shards) {
+		std::ostringstream in;
+		in << "n = 0\n";
+		for (std::size_t i = 2; i <= 20 * StreamEvaluator::CHUNK_LINES; ++i)
+			in << "n = n + " << i << "\n";
+		std::string const text = in.str();
+
+		ExpressionEvaluator byStream, byView;
+		std::istringstream input(text);
+		std::ostringstream streamOut, viewOut, errors;
+		StreamEvaluator(byStream, StreamEvaluator::formatter_type(), 4).run(input, streamOut, errors);
+		StreamEvaluator view(byView, StreamEvaluator::formatter_type(), 4);
+		view.set_shard_bytes(256);
+		auto summary = view.run(StreamEvaluator::view_type(text), viewOut, errors);
+		BOOST_CHECK(errors.str().empty());
+		BOOST_CHECK_EQUAL(summary.lines, 20 * StreamEvaluator::CHUNK_LINES);
+		BOOST_CHECK(viewOut.str() == streamOut.str());
+	}
+
+	BOOST_AUTO_TEST_CASE(EE_stream_latency_per_line) {
+		// one shard: a line that is slow to compile (but folds to a literal), then quick ones.
+		// Timed per line, the quick lines do not wait for the slow line's compile.
+		std::ostringstream in;
+		in << "1";
+		for (std::size_t i = 1; i < 50000; ++i)
+			in << " + 1";
+		in << "\n";
+		for (std::size_t i = 0; i < 1000; ++i)
+			in << i << "\n";
+		std::string const text = in.str();
+
+		ExpressionEvaluator ee;
+		StreamEvaluator stream(ee, StreamEvaluator::formatter_type(), 1);
+		std::ostringstream out, errors;
+		auto summary = stream.run(StreamEvaluator::view_type(text), out, errors);
+		BOOST_CHECK(errors.str().empty());
+		BOOST_CHECK_EQUAL(summary.lines, 1001u);
+		BOOST_CHECK(summary.medianLatency < summary.maxLatency / 2);
+	}
+
+	BOOST_AUTO_TEST_CASE(EE_mapped_file) {
+		char const* const PATH = "ut_mapped_file.txt";
+		{
+			std::ofstream file(PATH, std::ios::binary);
+			file << "1 + 2\n3 * 4";
+		}
+		{
+			MappedFile const file(PATH);
+			BOOST_CHECK_EQUAL(file.text(), "1 + 2\n3 * 4");
+		}
+		{
+			std::ofstream file(PATH, std::ios::binary | std::ios::trunc);
+		}
+		{
+			MappedFile const file(PATH);
+			BOOST_CHECK(file.text().empty());
+		}
+		std::remove(PATH);
+		BOOST_CHECK_THROW(MappedFile{ PATH }, std::runtime_error);
+	}
+#endif // TEST_MAPPED
+
+
+
+#if TEST_CACHE && TEST_VARIABLE && TEST_INTEGER && TEST_BINARY_OPERATOR
+	BOOST_AUTO_TEST_CASE(EE_cache_normalize) {
+		BOOST_CHECK_EQUAL(ParseCache::normalize("  1 +\t2 * ( x )\r\n"), "1+2*(x)");
+		BOOST_CHECK_EQUAL(ParseCache::normalize("a  and b"), "a and b");
+		BOOST_CHECK_EQUAL(ParseCache::normalize("2 ** 3"), "2**3");
+		BOOST_CHECK_EQUAL(ParseCache::normalize("2 * * 3"), "2* *3");
+		BOOST_CHECK_EQUAL(ParseCache::normalize("x = (1) / - 2"), "x= (1)/-2");
+		BOOST_CHECK_EQUAL(ParseCache::normalize("3 ! + not x"), "3! +not x");
+		BOOST_CHECK_EQUAL(ParseCache::normalize("5 % -2"), "5% -2");
+		BOOST_CHECK_EQUAL(ParseCache::normalize("1e +5"), "1e +5");
+		BOOST_CHECK_EQUAL(ParseCache::normalize("1e+ 5"), "1e+ 5");
+		BOOST_CHECK_EQUAL(ParseCache::normalize("1e+5"), "1e+5");
+		BOOST_CHECK_EQUAL(ParseCache::normalize(" \t "), "");
+	}
+
+	BOOST_AUTO_TEST_CASE(EE_cache_variables) {
+		ExpressionEvaluator ee;
+		ee.evaluate("x = 3");
+		BOOST_CHECK(get_value<Integer>(ee.evaluate("x * 2")) == Integer::value_type(6));
+		ee.evaluate("x = 10");
+		BOOST_CHECK(get_value<Integer>(ee.evaluate(" x*2 ")) == Integer::value_type(20));
+		BOOST_CHECK_EQUAL(ee.parse_cache().hits(), 1u);
+		BOOST_CHECK_EQUAL(ee.parse_cache().misses(), 3u);
+		BOOST_CHECK_EQUAL(ee.parse_cache().size(), 3u);
+
+		// assigned through another evaluator on the same variables
+		ExpressionEvaluator other(ee.get_environment());
+		other.evaluate("x = 7");
+		BOOST_CHECK(get_value<Integer>(ee.evaluate("x * 2")) == Integer::value_type(14));
+		BOOST_CHECK_EQUAL(ee.parse_cache().hits(), 2u);
+
+		// a formula assigned from the cache is still tracked
+		ee.evaluate("y = x + 1");
+		ee.evaluate("x = 1");
+		ee.evaluate("y = x + 1");
+		ee.evaluate("x = 3");
+		BOOST_CHECK(get_value<Integer>(get_value<Variable>(ee.evaluate("y"))) == Integer::value_type(4));
+
+		ee.reset_cache_counters();
+		BOOST_CHECK_EQUAL(ee.parse_cache().hits(), 0u);
+		BOOST_CHECK_EQUAL(ee.parse_cache().misses(), 0u);
+	}
+
+	BOOST_AUTO_TEST_CASE(EE_cache_lru) {
+		ExpressionEvaluator ee;
+		ee.set_cache_capacity(2);
+		ee.evaluate("1 + 1");
+		ee.evaluate("2 + 2");
+		ee.evaluate("1 + 1");
+		ee.evaluate("3 + 3");		// evicts 2 + 2
+		BOOST_CHECK_EQUAL(ee.parse_cache().size(), 2u);
+		ee.evaluate("1 + 1");
+		ee.evaluate("2 + 2");
+		BOOST_CHECK_EQUAL(ee.parse_cache().hits(), 2u);
+		BOOST_CHECK_EQUAL(ee.parse_cache().misses(), 4u);
+
+		// a failed compile is not cached
+		BOOST_CHECK_THROW(ee.evaluate("1 +"), std::exception);
+		BOOST_CHECK_EQUAL(ee.parse_cache().size(), 2u);
+
+		ee.set_precision(ee.get_precision());
+		BOOST_CHECK_EQUAL(ee.parse_cache().size(), 0u);
+
+		ee.set_cache_capacity(0);
+		ee.evaluate("1 + 1");
+		BOOST_CHECK_EQUAL(ee.parse_cache().size(), 0u);
+		BOOST_CHECK_EQUAL(ee.parse_cache().misses(), 5u);
+	}
+#endif // TEST_CACHE
+
 #endif // TEST_EXPRESSION_EVALUATOR
 
 /*=============================================================
 
 Revision History
 
+Version 1.21.0: 2026-10-18
+Added EE_parallel_jobs_isolated.
+
+Version 1.20.0: 2026-10-18
+EE_stream_history checks that the token pool stops growing, instead of the history size.
+
+Version 1.19.0: 2026-10-18
+Added EE_stream_latency_per_line.
+
+Version 1.18.0: 2026-10-18
+Added EE_stream_history.
+
+Version 1.17.0: 2026-10-18
+Added EE_share_deep.  The allocation hooks are linked from allocation_hooks.cpp.
+
+Version 1.16.0: 2026-10-18
+Added EE_variable_keyword, EE_environment_reader and EE_environment_names.
+
+Version 1.15.0: 2026-10-18
+Added parse cache tests.
+
+Version 1.14.0: 2026-10-18
+Added line scanner, mapped file and in-place stream tests.
+
+Version 1.13.0: 2026-10-18
+Added StreamEvaluator tests.
+
+Version 1.12.0: 2026-10-18
+Added allocation tracking tests.
+
+Version 1.11.0: 2026-10-18
+Added stats (per-phase timing and counters) tests.
+
+Version 1.10.0: 2026-10-18
+Added dependency tracking (formula refresh) tests.
+
+Version 1.9.0: 2026-10-18
+Added common subexpression sharing tests.
+
+Version 1.8.0: 2026-10-18
+Added constant folding test.
+
+Version 1.7.0: 2026-10-18
+Added Environment (shared variables, snapshots) tests.
+
+Version 1.6.0: 2026-10-18
+Added WorkStealingPool and ParallelEvaluator tests.
+
+Version 1.5.0: 2026-10-18
+Added BatchEvaluator (columnar) tests.
+
+Version 1.4.0: 2026-10-18
+Added tests for the shared Pi and E constants.
+
+Version 1.3.0: 2026-10-18
+Added tests for the Real precision tiers.
+
+Version 1.2.0: 2026-10-18
+Added tests for compile() / evaluate(CompiledExpression).
+
 Version 1.1.0: 2017-11-23
 Added Python-style power operator '**'.
 
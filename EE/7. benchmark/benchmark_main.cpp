@@ -0,0 +1,346 @@
+/** @file: benchmark_main.cpp
+	@author Chris Pollock
+	@version 0.2.0
+	@date 2026-10-18
+	@note Compiles under Visual C++ 15.4.4 and g++ 7 (C++14)
+
+	@brief Expression evaluator microbenchmarks.
+
+	Times Tokenizer::tokenize(), Parser::parse(), RPNEvaluator::evaluate(), ExpressionEvaluator::evaluate()
+	(end_to_end compiles every time, cached hits the parse cache) and Token::to_string() over a fixed corpus,
+	and writes ns/op, allocations/op and bytes/op as JSON.
+	Allocations are counted by allocation_tracking: allocs_per_op and bytes_per_op are those made through
+	the global operator new (pooled tokens add to them only when the pool grows), token_allocs_per_op
+	are pooled token allocations, and allocs_by_phase splits both by phase.
+
+	Usage: benchmark [--min-time=SECONDS] [--filter=TEXT] [--out=FILE]
+		--min-time	time spent on each sample (default 0.1); 5 samples are taken and the fastest reported
+		--filter	only the cases whose "case/phase" name contains TEXT
+		--out		write the JSON to FILE instead of stdout
+
+	Linux, from the EE directory:
+		g++ -std=c++14 -O2 -DNDEBUG -pthread "7. benchmark/benchmark_main.cpp" ee_common/src/[A-Za-z]*.cpp -o ee_benchmark
+	*/
+
+#include "../ee_common/inc/expression_evaluator.hpp"
+#include "../ee_common/inc/parser.hpp"
+#include "../ee_common/inc/RPNEvaluator.hpp"
+#include "../ee_common/inc/tokenizer.hpp"
+#include "../ee_common/inc/allocation_hooks.hpp"
+
+#include <algorithm>
+#include <array>
+#include <chrono>
+#include <cstdint>
+#include <cstdlib>
+#include <fstream>
+#include <functional>
+#include <iostream>
+#include <memory>
+#include <sstream>
+#include <string>
+#include <vector>
+
+using namespace std;
+
+
+namespace {
+	/** A benchmark input: the expression, and the assignments run before it. */
+	struct Case {
+		string			name;
+		vector<string>	setup;
+		string			expression;
+	};
+
+	/** The measurement of one case and phase. */
+	struct Result {
+		string		name;
+		uint64_t	iterations;
+		double		nsPerOp;
+		double		allocationsPerOp;
+		double		bytesPerOp;
+		double		tokenAllocationsPerOp;
+		double		tokenBytesPerOp;
+		array<double, ALLOCATION_PHASE_COUNT>	allocationsPerOpByPhase;	// heap and token pool
+	};
+
+	/** Runs 'iterations' operations. */
+	using operation_type = function<void(uint64_t iterations)>;
+
+	/** Makes a fresh operation (and the state it works on) for each sample. */
+	using factory_type = function<operation_type()>;
+
+	unsigned const SAMPLES = 5;
+
+
+	vector<Case> make_corpus() {
+		string nested;
+		for (int i = 0; i < 48; ++i)
+			nested += "(";
+		nested += "1";
+		for (int i = 0; i < 48; ++i)
+			nested += i % 2 ? " * 2)" : " + 1)";
+
+		return {
+			{ "short_arithmetic", {}, "1 + 2 * 3 - 8 / 4" },
+			{ "nested_parentheses", {}, nested },
+			{ "long_literals", {},
+				"123456789012345678901234567890123456789012345678901234567890 * 98765432109876543210987654321098765432109876543210"
+				" + 3.14159265358979323846264338327950288419716939937510582097494459230781640628620899862803482534211706798" },
+			{ "transcendental_real", {}, "sin(pi / 7) * cos(e / 3) + ln(2.5) ** 2 - sqrt(arctan(0.5) + exp(1.25))" },
+			{ "big_integer_sequence", {}, "fib(5000) + pel(2000) - syl(10) + 500!" },
+			{ "variable_heavy", { "a = 3", "b = 4.5", "c = 7", "d = 2" },
+				"a * b + c * d - (a + b) / (c + d) + a * a - b * c + d * d * a - (a - d) * (b - c)" },
+		};
+	}
+
+
+	// Evaluator set up for a case: the assignments are run through it, so its tokenizer binds their variables
+	shared_ptr<ExpressionEvaluator> make_evaluator(Case const& c) {
+		auto evaluator = make_shared<ExpressionEvaluator>();
+		for (auto const& assignment : c.setup)
+			evaluator->evaluate(assignment);
+		return evaluator;
+	}
+
+	factory_type tokenize_benchmark(Case const& c) {
+		return [c]() -> operation_type {
+			shared_ptr<ExpressionEvaluator> evaluator = make_evaluator(c);
+			return [c, evaluator](uint64_t iterations) {
+				Tokenizer tokenizer(evaluator->get_environment());
+				allocation_tracking::PhaseScope phase(allocation_phase::TOKENIZE);
+				for (uint64_t i = 0; i < iterations; ++i)
+					tokenizer.tokenize(c.expression);
+			};
+		};
+	}
+
+	factory_type parse_benchmark(Case const& c) {
+		return [c]() -> operation_type {
+			shared_ptr<ExpressionEvaluator> evaluator = make_evaluator(c);
+			TokenList infix = Tokenizer(evaluator->get_environment()).tokenize(c.expression);
+			return [evaluator, infix](uint64_t iterations) {
+				Parser parser;
+				allocation_tracking::PhaseScope phase(allocation_phase::PARSE);
+				for (uint64_t i = 0; i < iterations; ++i)
+					parser.parse(infix);
+			};
+		};
+	}
+
+	factory_type rpn_benchmark(Case const& c) {
+		return [c]() -> operation_type {
+			shared_ptr<ExpressionEvaluator> evaluator = make_evaluator(c);
+			TokenList postfix = Parser().parse(Tokenizer(evaluator->get_environment()).tokenize(c.expression));
+			auto rpn = make_shared<RPNEvaluator>();
+			return [evaluator, postfix, rpn](uint64_t iterations) {
+				allocation_tracking::PhaseScope phase(allocation_phase::EVALUATE);
+				for (uint64_t i = 0; i < iterations; ++i)
+					rpn->evaluate(postfix);
+			};
+		};
+	}
+
+	factory_type end_to_end_benchmark(Case const& c, size_t cacheCapacity) {
+		return [c, cacheCapacity]() -> operation_type {
+			shared_ptr<ExpressionEvaluator> evaluator = make_evaluator(c);
+			evaluator->set_cache_capacity(cacheCapacity);
+			return [c, evaluator](uint64_t iterations) {
+				for (uint64_t i = 0; i < iterations; ++i)
+					evaluator->evaluate(c.expression);
+			};
+		};
+	}
+
+	factory_type format_benchmark(Case const& c) {
+		return [c]() -> operation_type {
+			shared_ptr<ExpressionEvaluator> evaluator = make_evaluator(c);
+			Token::pointer_type result = evaluator->evaluate(c.expression);
+			return [evaluator, result](uint64_t iterations) {
+				allocation_tracking::PhaseScope phase(allocation_phase::FORMAT);
+				for (uint64_t i = 0; i < iterations; ++i)
+					result->to_string();
+			};
+		};
+	}
+
+
+	/** Times one sample of 'iterations' operations on fresh state. */
+	Result sample(factory_type const& factory, uint64_t iterations) {
+		operation_type operation = factory();
+		allocation_tracking::reset();
+		auto const start = chrono::steady_clock::now();
+		operation(iterations);
+		auto const elapsed = chrono::steady_clock::now() - start;
+		allocation_tracking::PhaseCounts const counts = allocation_tracking::by_phase();
+
+		double const n = double(iterations);
+		Result result{ string(), iterations, chrono::duration<double, nano>(elapsed).count() / n,
+			counts.heap_total().allocations / n, counts.heap_total().bytes / n,
+			counts.tokens_total().allocations / n, counts.tokens_total().bytes / n, {} };
+		for (size_t phase = 0; phase < ALLOCATION_PHASE_COUNT; ++phase)
+			result.allocationsPerOpByPhase[phase] = (counts.heap[phase].allocations + counts.tokens[phase].allocations) / n;
+		return result;
+	}
+
+	/** Grows the iteration count until a sample takes 'minTime', then reports the fastest of SAMPLES samples. */
+	Result measure(string const& name, factory_type const& factory, double minTime) {
+		uint64_t iterations = 1;
+		Result result = sample(factory, iterations);
+		while (result.nsPerOp * iterations < minTime * 1e9 && iterations < (uint64_t(1) << 40)) {
+			double const wanted = minTime * 1e9 / max(result.nsPerOp, 1.0) * 1.2;
+			iterations = max<uint64_t>(iterations * 2, min<uint64_t>(uint64_t(wanted), iterations * 100));
+			result = sample(factory, iterations);
+		}
+		for (unsigned i = 1; i < SAMPLES; ++i) {
+			Result another = sample(factory, iterations);
+			if (another.nsPerOp < result.nsPerOp)
+				result = another;
+		}
+		result.name = name;
+		return result;
+	}
+
+
+	string compiler() {
+		ostringstream oss;
+#if defined(_MSC_FULL_VER)
+		oss << "MSVC " << _MSC_FULL_VER;
+#elif defined(__clang__)
+		oss << "clang " << __clang_version__;
+#elif defined(__GNUC__)
+		oss << "g++ " << __VERSION__;
+#else
+		oss << "unknown";
+#endif
+		return oss.str();
+	}
+
+	// Names and compiler strings are plain ASCII; only quotes and backslashes need escaping
+	string quoted(string const& text) {
+		string out("\"");
+		for (char ch : text) {
+			if (ch == '"' || ch == '\\')
+				out += '\\';
+			out += ch;
+		}
+		return out + "\"";
+	}
+
+	void write_json(ostream& os, vector<Result> const& results, double minTime) {
+		os << "{\n"
+			<< "  \"compiler\": " << quoted(compiler()) << ",\n"
+#if defined(NDEBUG)
+			<< "  \"optimized\": true,\n"
+#else
+			<< "  \"optimized\": false,\n"
+#endif
+			<< "  \"pointer_bits\": " << sizeof(void*) * 8 << ",\n"
+			<< "  \"min_time_s\": " << minTime << ",\n"
+			<< "  \"samples\": " << SAMPLES << ",\n"
+			<< "  \"benchmarks\": [";
+		for (size_t i = 0; i < results.size(); ++i) {
+			Result const& r = results[i];
+			os << (i ? ",\n" : "\n")
+				<< "    { \"name\": " << quoted(r.name)
+				<< ", \"iterations\": " << r.iterations
+				<< ", \"ns_per_op\": " << r.nsPerOp
+				<< ", \"allocs_per_op\": " << r.allocationsPerOp
+				<< ", \"bytes_per_op\": " << r.bytesPerOp
+				<< ", \"token_allocs_per_op\": " << r.tokenAllocationsPerOp
+				<< ", \"token_bytes_per_op\": " << r.tokenBytesPerOp
+				<< ", \"allocs_by_phase\": {";
+			char const* separator = " ";
+			for (size_t phase = 0; phase < ALLOCATION_PHASE_COUNT; ++phase)
+				if (r.allocationsPerOpByPhase[phase] != 0) {
+					os << separator << quoted(phase_name(static_cast<allocation_phase>(phase))) << ": " << r.allocationsPerOpByPhase[phase];
+					separator = ", ";
+				}
+			os << " } }";
+		}
+		os << "\n  ]\n}\n";
+	}
+}
+
+
+
+int main(int argc, char* argv[]) {
+	double minTime = 0.1;
+	string filter, outFile;
+	for (int i = 1; i < argc; ++i) {
+		string const arg(argv[i]);
+		if (arg.compare(0, 11, "--min-time=") == 0)
+			minTime = atof(arg.c_str() + 11);
+		else if (arg.compare(0, 9, "--filter=") == 0)
+			filter = arg.substr(9);
+		else if (arg.compare(0, 6, "--out=") == 0)
+			outFile = arg.substr(6);
+		else {
+			cerr << "Usage: " << argv[0] << " [--min-time=SECONDS] [--filter=TEXT] [--out=FILE]" << endl;
+			return EXIT_FAILURE;
+		}
+	}
+
+	try {
+		allocation_tracking::enable(true);
+		vector<Result> results;
+		for (auto const& c : make_corpus()) {
+			pair<char const*, factory_type> const phases[] = {
+				{ "tokenize", tokenize_benchmark(c) },
+				{ "parse", parse_benchmark(c) },
+				{ "rpn_evaluate", rpn_benchmark(c) },
+				{ "end_to_end", end_to_end_benchmark(c, 0) },
+				{ "cached", end_to_end_benchmark(c, ParseCache::DEFAULT_CAPACITY) },
+				{ "format", format_benchmark(c) },
+			};
+			for (auto const& phase : phases) {
+				string const name = c.name + "/" + phase.first;
+				if (name.find(filter) == string::npos)
+					continue;
+				results.push_back(measure(name, phase.second, minTime));
+				cerr << name << ": " << results.back().nsPerOp << " ns/op" << endl;
+			}
+		}
+
+		if (outFile.empty())
+			write_json(cout, results, minTime);
+		else {
+			ofstream out(outFile);
+			write_json(out, results, minTime);
+			if (!out)
+				throw runtime_error("Error: cannot write " + outFile);
+		}
+	}
+	catch (exception const& e) {
+		cerr << e.what() << endl;
+		return EXIT_FAILURE;
+	}
+	return EXIT_SUCCESS;
+}
+
+/*=============================================================
+
+Revision History
+
+Version 0.2.0: 2026-10-18
+end_to_end runs without the parse cache; added the cached phase, which runs with it.
+
+Version 0.1.0: 2026-10-18
+Allocations are counted by allocation_tracking: token pool allocations and a split by phase.
+Added the format phase.
+
+Version 0.0.0: 2026-10-18
+Alpha release.
+
+=============================================================
+
+Copyright Garth Santor/Trinh Han
+
+The copyright to the computer program(s) herein
+is the property of Garth Santor/Trinh Han of Canada.
+The program(s) may be used and/or copied only with
+the written permission of Garth Santor/Trinh Han
+or in accordance with the terms and conditions
+stipulated in the agreement/contract under which
+the program(s) have been supplied.
+=============================================================*/
@@ -1,28 +1,154 @@
 /** @file: ee_main.cpp
 	@author Garth Santor/Trinh Han
 	@author http://www.gats.ca/
-	@date 2017-11-23
-	@version 1.1.0
+	@date 2026-10-18
+	@version 1.8.0
 	@note Compiles under Visual C++ 15.4.4
 
 	@brief Expression Evaluator application.
 
+	Usage: EE					interactive
+		   EE --batch [FILE]	evaluates each line of FILE (or stdin) and prints the figures of the run
+
 	@implemented by Chris Pollock
 	@date 2018 07 12
 	*/
 
 #include "../ee_common/inc/expression_evaluator.hpp"
+#include "../ee_common/inc/mapped_file.hpp"
+#include "../ee_common/inc/stream_evaluator.hpp"
 
+#include <cstdlib>
+#include <iomanip>
 #include <iostream>
+#include <sstream>
+#include <stdexcept>
 #include <string>
 #include <boost/multiprecision/cpp_int.hpp>
 
 using namespace std;
 
-int main() {
+namespace {
+	// Shows the stats of an evaluator
+	void print_stats(ExpressionEvaluator const& expEval)
+	{
+		EvaluationStats const& stats = expEval.stats();
+		cout << "stats are " << (expEval.stats_enabled() ? "on" : "off") << '\n'
+			<< "expressions             " << stats.expressions << '\n'
+			<< "evaluations             " << stats.evaluations << '\n'
+			<< "tokens                  " << stats.tokens << '\n'
+			<< "instructions            " << stats.instructions << '\n'
+			<< "peak stack depth        " << stats.peak_stack_depth << '\n'
+			<< "big integer operations  " << stats.big_integer_operations << '\n'
+			<< "real operations         " << stats.real_operations << '\n'
+			<< "parse cache hits        " << expEval.parse_cache().hits() << '\n'
+			<< "parse cache misses      " << expEval.parse_cache().misses() << '\n'
+			<< "parse cache size        " << expEval.parse_cache().size() << " of " << expEval.parse_cache().get_capacity() << '\n';
+		for (size_t i = 0; i < PHASE_COUNT; ++i)
+		{
+			string const name = phase_name(static_cast<phase_type>(i));
+			cout << name << string(24 - name.size(), ' ') << fixed << setprecision(3)
+				<< stats.nanoseconds[i] / 1e3 << " us\n";
+		}
+		cout.unsetf(ios::floatfield);
+		cout << flush;
+	}
+
+	// The text of a result: its value, without the name of its type
+	string format_result(Token::pointer_type result, unsigned outputDigits)
+	{
+		Operand::pointer_type varPtr = dynamic_pointer_cast<Operand>(result);
+
+		// Display variables by their value
+		if (is<Variable>(result) && get_value<Variable>(varPtr))
+			result = get_value<Variable>(varPtr);
+
+		// Cast the value to a string to be displayed
+		string str = result->to_string();
+		string strCheck = "";
+		strCheck = str[0];
+
+		// Check whether it is an Integer, Real, Boolean, or Variable. Then
+		// remove the characters of Integer, Real, Boolean, or Variable to display
+		// just the value.
+		if (strCheck == "I")
+		{
+			str = str.substr(9);
+		}
+		else if (strCheck == "R")
+		{
+			str = outputDigits == 0 ? str.substr(5) : convert<Real>(result)->format(outputDigits);
+		}
+		else if (strCheck == "V")
+		{	
+			Token::pointer_type variableValue = get_value<Variable>(varPtr);
+			str = variableValue->to_string();
+			str = str.substr(9);
+		}
+		else if (strCheck == "B")
+		{
+			str = str.substr(9);
+
+			if (str == "1")
+			{
+				str = "true";
+			}
+			else
+			{
+				str = "false";
+			}
+		}
+		return str;
+	}
+
+	// Evaluates each line of 'path' (stdin if null) through a StreamEvaluator.  A file is mapped and read in place.
+	int run_batch(char const* path)
+	{
+		ios::sync_with_stdio(false);
+		try
+		{
+			ExpressionEvaluator expEval;
+			StreamEvaluator stream(expEval, [](Token::pointer_type const& result) { return format_result(result, 0); });
+			StreamEvaluator::Summary summary;
+			if (path != nullptr)
+			{
+				MappedFile const file(path);
+				summary = stream.run(file.text(), cout, cerr);
+			}
+			else
+				summary = stream.run(cin, cout, cerr);
+
+			cerr << summary.lines << " lines, " << summary.errors << " errors in " << fixed << setprecision(3)
+				<< summary.seconds << " s (" << setprecision(0) << summary.throughput() << " lines/s)\n"
+				<< "latency ms: mean " << setprecision(3) << summary.meanLatency * 1e3
+				<< ", median " << summary.medianLatency * 1e3
+				<< ", p99 " << summary.p99Latency * 1e3
+				<< ", max " << summary.maxLatency * 1e3 << endl;
+			return summary.errors == 0 ? EXIT_SUCCESS : EXIT_FAILURE;
+		}
+		catch (exception const& e)
+		{
+			cerr << e.what() << endl;
+			return EXIT_FAILURE;
+		}
+	}
+}
+
+int main(int argc, char* argv[]) {
+	if (argc > 1)
+	{
+		if (string(argv[1]) != "--batch" || argc > 3)
+		{
+			cerr << "Usage: " << argv[0] << " [--batch [FILE]]" << endl;
+			return EXIT_FAILURE;
+		}
+		return run_batch(argc == 3 && string(argv[2]) != "-" ? argv[2] : nullptr);
+	}
+
 	cout << "Expression Evaluator, (c) 1998-2017 Garth Santor\n";
 	
 	ExpressionEvaluator expEval;
+	unsigned outputDigits = 0;		// 0 until setp is used: full precision output
 
 	for (unsigned count = 0; ; ++count) {
 
@@ -40,7 +166,12 @@ int main() {
 				cout << "Expression Evaluator 2017 (v 1.0.0)\n\n"
 
 					"var = assign a variable\n"
-					"setp #          sets the precision of floating point output\n\n"
+					"                (assigning an expression over other variables recomputes it when they change)\n"
+					"setp #          sets the precision of floating point output\n"
+					"stats           shows the timing and counters of each phase\n"
+					"stats on|off    starts or stops recording them (off by default)\n"
+					"stats reset     clears them\n"
+					"stats save file writes them to 'file' in the Prometheus text format\n\n"
 
 					"arithmetic operations :\n"
 					"addition                n + r\n"
@@ -91,50 +222,55 @@ int main() {
 				continue;
 			}
 
-			// Convert the evaluated expression to a Token pointer
-			auto result = expEval.evaluate(command);
-
-			Operand::pointer_type varPtr = dynamic_pointer_cast<Operand>(result);
-
-			// Cast the value to a string to be displayed
-			string str = result->to_string();
-			string strCheck = "";
-			strCheck = str[0];
-
-			// Check whether it is an Integer, Real, Boolean, or Variable. Then
-			// remove the characters of Integer, Real, Boolean, or Variable to display
-			// just the value.
-			if (strCheck == "I")
+			// Set the precision of real number computation and output
+			if (command.compare(0, 5, "setp ") == 0)
 			{
-				str = str.substr(9);
+				istringstream iss(command.substr(5));
+				unsigned digits;
+				if (!(iss >> digits) || digits == 0)
+					throw runtime_error("Error: setp requires a positive number of digits.");
+				outputDigits = digits;
+				expEval.set_precision(precision_for_digits(digits));
+				continue;
 			}
-			else if (strCheck == "R")
+
+			// Show, record or export the timing and counters of each phase
+			if (command == "stats")
 			{
-				str = str.substr(5);
-			}
-			else if (strCheck == "V")
-			{	
-				Token::pointer_type variableValue = get_value<Variable>(varPtr);
-				str = variableValue->to_string();
-				str = str.substr(9);
+				print_stats(expEval);
+				continue;
 			}
-			else if (strCheck == "B")
+			if (command.compare(0, 6, "stats ") == 0)
 			{
-				str = str.substr(9);
-
-				if (str == "1")
+				string const argument = command.substr(6);
+				if (argument == "on" || argument == "off")
+					expEval.enable_stats(argument == "on");
+				else if (argument == "reset")
 				{
-					str = "true";
+					expEval.reset_stats();
+					expEval.reset_cache_counters();
 				}
+				else if (argument.compare(0, 5, "save ") == 0 && argument.size() > 5)
+					expEval.stats().write_prometheus(argument.substr(5));
 				else
-				{
-					str = "false";
-				}
+					throw runtime_error("Error: stats takes on, off, reset or save <file>.");
+				continue;
 			}
 
-			cout << "[" << count << "] = " << str << endl;
+			// Convert the evaluated expression to a Token pointer
+			auto result = expEval.evaluate(command);
+			cout << "[" << count << "] = " << format_result(result, outputDigits) << endl;
+
+			// Show the formula variables recomputed because the expression assigned a variable they read
+			if (!expEval.get_refreshed().empty())
+			{
+				cout << "    refreshed:";
+				for (auto const& name : expEval.get_refreshed())
+					cout << ' ' << name;
+				cout << endl;
+			}
 		}
-		catch (exception e)
+		catch (exception const& e)
 		{
 			cerr << e.what() << endl;
 			continue;
@@ -151,6 +287,28 @@ int main() {
 
 Revision History
 
+Version 1.8.0: 2026-10-18
+stats shows the parse cache; stats reset clears its counters.
+
+Version 1.7.0: 2026-10-18
+--batch FILE maps the file and evaluates it in place.
+
+Version 1.6.0: 2026-10-18
+Added --batch: evaluates a file or stdin through a StreamEvaluator pipeline.
+Result formatting moved to format_result().
+
+Version 1.5.0: 2026-10-18
+Added the stats command.
+
+Version 1.4.0: 2026-10-18
+Errors are thrown as std::runtime_error and caught by reference, so their message is shown.
+
+Version 1.3.0: 2026-10-18
+Shows the formula variables refreshed by an assignment.
+
+Version 1.2.0: 2026-10-18
+setp selects the precision tier of real computation and the number of digits displayed.
+
 Version 1.1.0: 2017-11-23
 Added Python-style power operator '**'
 
@@ -4,8 +4,8 @@
 /** @file: RPNEvaluator.hpp
 	@author Garth Santor/Trinh Han
 	@author http://www.gats.ca/
-	@version 0.0.1
-	@date 2012-11-13
+	@version 0.7.0
+	@date 2026-10-18
 	@note Compiles under Visual C++ v110
 
 	@brief RPN Evaluator class declaration.
@@ -14,17 +14,120 @@
 	@date 2018 07 12
 	*/
 
+#include "evaluation_stats.hpp"
 #include "operand.hpp"
+#include "opcode.hpp"
+#include "real.hpp"
+#include "variable_store.hpp"
+#include <cstddef>
+#include <deque>
+#include <limits>
+#include <vector>
 
+/** Evaluates RPN token lists.
+	A token list is first lowered to a flat program of opcodes, which is then executed
+	by a dispatch table indexed by opcode.
+	Real literals, constants and Real-valued operations are computed at the evaluator's precision tier.
+	*/
 class RPNEvaluator {
 public:
-	Operand::pointer_type evaluate(TokenList const& container);
+	/** One step of a lowered RPN program. */
+	struct Instruction {
+		opcode_type			opcode;
+		unsigned			number_of_args;
+		Token::pointer_type	token;			// the operand to push, or the operation (for error reporting)
+		std::size_t			temporary;		// LOAD, STORE: index of the temporary
+	};
+	using program_type = std::vector<Instruction>;
+	using result_list_type = std::deque<Operand::pointer_type>;
+
+private:
+	result_list_type	results_;
+	std::size_t			historyLimit_;	// results kept in results_
+	std::size_t			forgotten_;		// results dropped from the front of results_
+	precision_type		precision_;
+	EvaluationStats*	stats_;
+	VariableStore::Reader	reader_;	// the snapshot of the variables last read by execute()
+
+public:
+	// C'tor
+	RPNEvaluator() : historyLimit_(std::numeric_limits<std::size_t>::max()), forgotten_(0), precision_(precision_type::DIGITS_1000), stats_(nullptr) { }
+
+	/** Sets the precision tier used for Real computation by subsequent compiles and executes. */
+	void					set_precision(precision_type precision) { precision_ = precision; }
+
+	/** Gets the precision tier used for Real computation. */
+	precision_type			get_precision() const { return precision_; }
+
+	/** Sets where execute() records the peak operand stack depth and the big integer and real operation
+		counts, or nullptr (the default) not to record them.
+		*/
+	void					set_stats(EvaluationStats* stats) { stats_ = stats; }
+
+	/** Lower an RPN token list to a program.  Real literals and constants are converted to the current precision. */
+	program_type			compile(TokenList const& rpnExpression) const;
+
+	/** Fold every subexpression without Variable operands into a literal.
+		Assignment and result(n) are never folded; operations that fail are left for execute() to report.
+		*/
+	program_type			fold(program_type const& program) const;
+
+	/** Compute structurally identical pure subexpressions once: the first occurrence is kept in a
+		temporary (STORE) and the later ones read it (LOAD).
+		'deduplicated' is set to the number of operations removed.
+		*/
+	program_type			share(program_type const& program, std::size_t& deduplicated) const;
+
+	/** Execute a lowered program.  The result is appended to the result history. */
+	Operand::pointer_type	execute(program_type const& program);
+
+	/** Lower and execute an RPN token list. */
+	Operand::pointer_type	evaluate(TokenList const& rpnExpression);
+
+	/** Sets the number of results kept for result(n) (unlimited by default).  Older results are dropped;
+		result(n) of a dropped result is an error.  Results keep their numbers.
+		*/
+	void					set_history_limit(std::size_t limit);
+
+	/** Gets the number of results kept for result(n). */
+	std::size_t				get_history_limit() const { return historyLimit_; }
+
+	/** Gets the results kept for result(n): result n is get_results()[n - 1 - get_forgotten()]. */
+	result_list_type const&	get_results() const { return results_; }
+
+	/** Gets the number of results dropped by the history limit. */
+	std::size_t				get_forgotten() const { return forgotten_; }
+
+private:
+	void					forget();
 };
 
 /*=============================================================
 
 Revision History
 
+Version 0.7.0: 2026-10-18
+Added set_history_limit(), get_history_limit() and get_forgotten(); the result history is a deque.
+
+Version 0.6.0: 2026-10-18
+Keeps a VariableStore::Reader, so unchanged variables are read without locking.
+
+Version 0.5.0: 2026-10-18
+Added set_stats().
+
+Version 0.4.0: 2026-10-18
+Added share() (common subexpression elimination) and Instruction::temporary.
+
+Version 0.3.0: 2026-10-18
+Added fold() (constant folding).
+
+Version 0.2.0: 2026-10-18
+Added the Real precision tier (set_precision/get_precision).
+
+Version 0.1.0: 2026-10-18
+Added compile()/execute(): opcode programs dispatched through a lookup table.
+Added the result history.
+
 Version 0.0.1: 2012-11-13
 C++ 11 cleanup
 
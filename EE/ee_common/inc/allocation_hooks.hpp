@@ -0,0 +1,49 @@
+#if !defined(GUARD_allocation_hooks_hpp20261018_)
+#define GUARD_allocation_hooks_hpp20261018_
+
+/** @file: allocation_hooks.hpp
+	@author Chris Pollock
+	@version 0.1.0
+	@date 2026-10-18
+	@note Compiles under Visual C++ 15.4.4
+
+	@brief Replacement global operator new and delete that report to allocation_tracking.
+
+	The replacements are defined in allocation_hooks.cpp.  Link it into a program (and only into the
+	programs that want it, e.g. ut_expression_evaluator and benchmark) to have its heap allocations
+	counted while allocation_tracking is enabled.  The library does not replace them itself, so
+	programs that don't link it pay nothing.
+	*/
+
+#include "allocation_tracking.hpp"
+
+
+namespace allocation_tracking {
+	/** Tests that allocation_hooks.cpp is linked.  A program that calls it fails to link without the hooks. */
+	bool		hooks_linked() noexcept;
+}
+
+
+/*=============================================================
+
+Revision History
+
+Version 0.1.0: 2026-10-18
+The replacements moved to allocation_hooks.cpp; the header only declares hooks_linked().
+
+Version 0.0.0: 2026-10-18
+Alpha release.
+
+=============================================================
+
+Copyright Garth Santor/Trinh Han
+
+The copyright to the computer program(s) herein
+is the property of Garth Santor/Trinh Han of Canada.
+The program(s) may be used and/or copied only with
+the written permission of Garth Santor/Trinh Han
+or in accordance with the terms and conditions
+stipulated in the agreement/contract under which
+the program(s) have been supplied.
+=============================================================*/
+#endif // GUARD_allocation_hooks_hpp20261018_
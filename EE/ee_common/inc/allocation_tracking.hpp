@@ -0,0 +1,135 @@
+#if !defined(GUARD_allocation_tracking_hpp20261018_)
+#define GUARD_allocation_tracking_hpp20261018_
+
+/** @file: allocation_tracking.hpp
+	@author Chris Pollock
+	@version 0.0.0
+	@date 2026-10-18
+	@note Compiles under Visual C++ 15.4.4
+
+	@brief Allocation accounting declarations.
+	*/
+
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <typeinfo>
+#include <vector>
+
+
+/** Phases that allocations are attributed to.  ExpressionEvaluator enters TOKENIZE, PARSE, COMPILE and
+	EVALUATE itself; FORMAT is entered by the caller around converting a result to text.
+	OTHER is everything else.
+	*/
+enum class allocation_phase : unsigned char { OTHER = 0, TOKENIZE, PARSE, COMPILE, EVALUATE, FORMAT, COUNT };
+
+/** Gets the table index of an allocation phase. */
+constexpr std::size_t index_of(allocation_phase phase) { return static_cast<std::size_t>(phase); }
+
+/** Number of allocation phases. */
+constexpr std::size_t ALLOCATION_PHASE_COUNT = index_of(allocation_phase::COUNT);
+
+/** Gets the name of an allocation phase ("other", "tokenize", "parse", "compile", "evaluate" or "format"). */
+char const* phase_name(allocation_phase phase);
+
+
+
+/** Optional accounting of allocations, off by default.
+	While enabled, every token pool allocation is counted by phase and by token type.  Heap allocations
+	(the global operator new) are counted by phase in programs linked with allocation_hooks.cpp.
+	The counters are shared by all threads; the phase is per thread.
+	*/
+namespace allocation_tracking {
+	/** A number of allocations and the bytes they requested. */
+	struct Counts {
+		std::uint64_t	allocations;
+		std::uint64_t	bytes;
+	};
+
+	/** Allocations by phase. */
+	struct PhaseCounts {
+		std::array<Counts, ALLOCATION_PHASE_COUNT>	heap;		// global operator new
+		std::array<Counts, ALLOCATION_PHASE_COUNT>	tokens;		// token pool
+
+		/** Gets the heap allocations of all phases. */
+		Counts	heap_total() const;
+
+		/** Gets the token pool allocations of all phases. */
+		Counts	tokens_total() const;
+	};
+
+	/** Token pool allocations of one token type. */
+	struct TypeCounts {
+		std::string	name;
+		Counts		counts;
+	};
+
+	namespace detail {
+		extern std::atomic<bool> isEnabled;
+	}
+
+	/** Tests if allocations are being counted. */
+	inline bool	enabled() noexcept { return detail::isEnabled.load(std::memory_order_relaxed); }
+
+	/** Starts or stops counting.  The counters are kept while counting is stopped. */
+	void		enable(bool enable) noexcept;
+
+	/** Sets every counter to zero. */
+	void		reset() noexcept;
+
+	/** Gets the allocations by phase.  Makes no allocation, so it may be called around the code measured. */
+	PhaseCounts	by_phase() noexcept;
+
+	/** Gets the token pool allocations by token type, in order of type name. */
+	std::vector<TypeCounts>	by_token_type();
+
+	/** Gets the phase that this thread's allocations are attributed to. */
+	allocation_phase	current_phase() noexcept;
+
+	/** Counts a heap allocation in this thread's phase.  Called by allocation_hooks.cpp. */
+	void		record_heap(std::size_t bytes) noexcept;
+
+	/** Counts a token pool allocation of a token of 'type' in this thread's phase.  Called by TokenAllocator. */
+	void		record_token(std::type_info const& type, std::size_t bytes) noexcept;
+
+
+	/** Attributes this thread's allocations to a phase until it is destroyed, then restores the previous phase. */
+	class PhaseScope {
+		allocation_phase	previous_;
+	public:
+		// C'tor
+		explicit PhaseScope(allocation_phase phase) noexcept;
+		PhaseScope(PhaseScope const&) = delete;
+		PhaseScope& operator = (PhaseScope const&) = delete;
+
+		// D'tor
+		~PhaseScope();
+
+		/** Moves on to the next phase. */
+		void	enter(allocation_phase phase) noexcept;
+	};
+}
+
+
+/*=============================================================
+
+Revision History
+
+Version 0.0.0: 2026-10-18
+Alpha release.
+
+=============================================================
+
+Copyright Garth Santor/Trinh Han
+
+The copyright to the computer program(s) herein
+is the property of Garth Santor/Trinh Han of Canada.
+The program(s) may be used and/or copied only with
+the written permission of Garth Santor/Trinh Han
+or in accordance with the terms and conditions
+stipulated in the agreement/contract under which
+the program(s) have been supplied.
+=============================================================*/
+#endif // GUARD_allocation_tracking_hpp20261018_
@@ -0,0 +1,91 @@
+#if !defined(GUARD_batch_evaluator_hpp20261018_)
+#define GUARD_batch_evaluator_hpp20261018_
+
+/** @file: batch_evaluator.hpp
+	@author Chris Pollock
+	@version 0.1.0
+	@date 2026-10-18
+	@note Compiles under Visual C++ 15.4.4
+
+	@brief BatchEvaluator class declaration.
+	*/
+
+#include "column.hpp"
+#include "compiled_expression.hpp"
+#include <cstddef>
+#include <map>
+#include <string>
+#include <vector>
+
+
+/** Evaluates one compiled expression over many rows.
+	Variables are bound to columns (Integer, Real or Boolean); variables that are not bound keep
+	their current value, which is broadcast to every row.
+	The program is run a block of BLOCK_SIZE rows at a time: each instruction is dispatched once
+	per block to a kernel that loops over the block's rows.
+	Integers are 64-bit (overflow is an error rather than a promotion) and Reals are doubles.
+	*/
+class BatchEvaluator {
+public:
+	using string_type = CompiledExpression::string_type;
+
+	/** Rows per block (per kernel dispatch). */
+	static std::size_t const BLOCK_SIZE = 1024;
+
+private:
+	struct Plan;
+
+	CompiledExpression::program_type		program_;
+	std::vector<string_type>				names_;		// variable name of each program position, or empty
+	std::map<string_type, ColumnView>		columns_;
+
+public:
+	// C'tor
+	explicit BatchEvaluator(CompiledExpression const& compiled);
+
+	/** Binds the variable 'name' to a column.  All bound columns must have the same length. */
+	void			bind(string_type const& name, ColumnView column);
+
+	/** Gets the number of rows (the length of the bound columns). */
+	std::size_t		rows() const;
+
+	/** Gets the kind of the result column. */
+	column_kind		result_kind() const;
+
+	/** Evaluates every row into 'out', which is resized to rows(). */
+	void			evaluate(Column& out) const;
+
+	/** Evaluates rows [first, last) into the same rows of 'out', which must already have the result kind and at least 'last' rows.
+		Distinct row ranges may be evaluated concurrently into the same column.
+		*/
+	void			evaluate(std::size_t first, std::size_t last, Column& out) const;
+
+private:
+	Plan			make_plan() const;
+	void			run(Plan const& plan, std::size_t first, std::size_t last, Column& out) const;
+};
+
+
+/*=============================================================
+
+Revision History
+
+Version 0.1.0: 2026-10-18
+Shared subexpressions (LOAD/STORE) are kept in per-block temporaries.
+
+Version 0.0.0: 2026-10-18
+Alpha release.
+
+=============================================================
+
+Copyright Garth Santor/Trinh Han
+
+The copyright to the computer program(s) herein
+is the property of Garth Santor/Trinh Han of Canada.
+The program(s) may be used and/or copied only with
+the written permission of Garth Santor/Trinh Han
+or in accordance with the terms and conditions
+stipulated in the agreement/contract under which
+the program(s) have been supplied.
+=============================================================*/
+#endif // GUARD_batch_evaluator_hpp20261018_
@@ -19,6 +19,7 @@
 class Boolean : public Operand {
 public:
 	DEF_POINTER_TYPE(Boolean)
+	DEF_KIND(BOOLEAN)
 		using value_type = bool;
 private: 
 	value_type value_;
@@ -44,6 +45,8 @@ public:
 
 Revision History
 
+Version 0.2.0: 2026-10-18
+Added DEF_KIND.
 Version 0.1.1: 2012-11-13
 C++ 11 cleanup
 
@@ -0,0 +1,94 @@
+#if !defined(GUARD_bounded_queue_hpp20261018_)
+#define GUARD_bounded_queue_hpp20261018_
+
+/** @file: bounded_queue.hpp
+	@author Chris Pollock
+	@version 0.0.0
+	@date 2026-10-18
+	@note Compiles under Visual C++ 15.4.4
+
+	@brief BoundedQueue class declaration and implementation.
+	*/
+
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <mutex>
+#include <utility>
+#include <boost/noncopyable.hpp>
+
+
+/** A first in, first out queue between threads that holds at most 'capacity' items.
+	push() waits while the queue is full, so a fast producer is held back to the pace of its consumer.
+	Once the queue is closed push() refuses items, and pop() returns those left and then reports the end.
+	*/
+template <typename T>
+class BoundedQueue : boost::noncopyable {
+	std::mutex				mutex_;
+	std::condition_variable	notEmpty_;
+	std::condition_variable	notFull_;
+	std::deque<T>			items_;
+	std::size_t				capacity_;
+	bool					closed_;
+
+public:
+	// C'tor
+	explicit BoundedQueue(std::size_t capacity) : capacity_(capacity == 0 ? 1 : capacity), closed_(false) { }
+
+	/** Adds an item, waiting while the queue is full.  Returns false (dropping the item) if the queue is closed. */
+	bool	push(T item) {
+		std::unique_lock<std::mutex> lock(mutex_);
+		notFull_.wait(lock, [this] { return closed_ || items_.size() < capacity_; });
+		if (closed_)
+			return false;
+		items_.push_back(std::move(item));
+		lock.unlock();
+		notEmpty_.notify_one();
+		return true;
+	}
+
+	/** Takes the oldest item, waiting while the queue is empty.  Returns false once the queue is closed and empty. */
+	bool	pop(T& item) {
+		std::unique_lock<std::mutex> lock(mutex_);
+		notEmpty_.wait(lock, [this] { return closed_ || !items_.empty(); });
+		if (items_.empty())
+			return false;
+		item = std::move(items_.front());
+		items_.pop_front();
+		lock.unlock();
+		notFull_.notify_one();
+		return true;
+	}
+
+	/** Ends the queue: wakes every waiting thread; no more items are accepted. */
+	void	close() {
+		{
+			std::lock_guard<std::mutex> lock(mutex_);
+			closed_ = true;
+		}
+		notEmpty_.notify_all();
+		notFull_.notify_all();
+	}
+};
+
+
+/*=============================================================
+
+Revision History
+
+Version 0.0.0: 2026-10-18
+Alpha release.
+
+=============================================================
+
+Copyright Garth Santor/Trinh Han
+
+The copyright to the computer program(s) herein
+is the property of Garth Santor/Trinh Han of Canada.
+The program(s) may be used and/or copied only with
+the written permission of Garth Santor/Trinh Han
+or in accordance with the terms and conditions
+stipulated in the agreement/contract under which
+the program(s) have been supplied.
+=============================================================*/
+#endif // GUARD_bounded_queue_hpp20261018_
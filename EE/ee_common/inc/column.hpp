@@ -0,0 +1,105 @@
+#if !defined(GUARD_column_hpp20261018_)
+#define GUARD_column_hpp20261018_
+
+/** @file: column.hpp
+	@author Chris Pollock
+	@version 0.0.0
+	@date 2026-10-18
+	@note Compiles under Visual C++ 15.4.4
+
+	@brief Column and ColumnView class declarations (columnar data for batch evaluation).
+	*/
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+
+/** Element kind of a column. */
+enum class column_kind : unsigned char { INTEGER, REAL, BOOLEAN };
+
+
+/** Column element types.  Booleans are one byte each, 0 or 1. */
+using column_integer_type = std::int64_t;
+using column_real_type = double;
+using column_boolean_type = std::uint8_t;
+
+
+
+/** Read-only view of a contiguous column owned by the caller. */
+class ColumnView {
+	column_kind		kind_;
+	std::size_t		size_;
+	void const*		data_;
+public:
+	// C'tors
+	ColumnView(column_integer_type const* data, std::size_t size) : kind_(column_kind::INTEGER), size_(size), data_(data) { }
+	ColumnView(column_real_type const* data, std::size_t size) : kind_(column_kind::REAL), size_(size), data_(data) { }
+	ColumnView(column_boolean_type const* data, std::size_t size) : kind_(column_kind::BOOLEAN), size_(size), data_(data) { }
+	ColumnView(std::vector<column_integer_type> const& data) : ColumnView(data.data(), data.size()) { }
+	ColumnView(std::vector<column_real_type> const& data) : ColumnView(data.data(), data.size()) { }
+	ColumnView(std::vector<column_boolean_type> const& data) : ColumnView(data.data(), data.size()) { }
+
+	column_kind					get_kind() const { return kind_; }
+	std::size_t					size() const { return size_; }
+
+	/** Gets the elements.  Only meaningful for the column's kind. */
+	column_integer_type const*	integers() const { return static_cast<column_integer_type const*>(data_); }
+	column_real_type const*		reals() const { return static_cast<column_real_type const*>(data_); }
+	column_boolean_type const*	booleans() const { return static_cast<column_boolean_type const*>(data_); }
+};
+
+
+
+/** A column that owns its elements.  Only the vector of the column's kind is used. */
+class Column {
+	column_kind							kind_;
+	std::vector<column_integer_type>	integers_;
+	std::vector<column_real_type>		reals_;
+	std::vector<column_boolean_type>	booleans_;
+public:
+	// C'tor
+	Column() : kind_(column_kind::REAL) { }
+
+	/** Sets the kind and number of elements.  Storage is kept for reuse. */
+	void reset(column_kind kind, std::size_t size) {
+		kind_ = kind;
+		integers_.resize(kind == column_kind::INTEGER ? size : 0);
+		reals_.resize(kind == column_kind::REAL ? size : 0);
+		booleans_.resize(kind == column_kind::BOOLEAN ? size : 0);
+	}
+
+	column_kind							get_kind() const { return kind_; }
+	std::size_t							size() const {
+		return kind_ == column_kind::INTEGER ? integers_.size() : kind_ == column_kind::REAL ? reals_.size() : booleans_.size();
+	}
+
+	std::vector<column_integer_type>&		integers() { return integers_; }
+	std::vector<column_integer_type> const&	integers() const { return integers_; }
+	std::vector<column_real_type>&			reals() { return reals_; }
+	std::vector<column_real_type> const&	reals() const { return reals_; }
+	std::vector<column_boolean_type>&		booleans() { return booleans_; }
+	std::vector<column_boolean_type> const&	booleans() const { return booleans_; }
+};
+
+
+/*=============================================================
+
+Revision History
+
+Version 0.0.0: 2026-10-18
+Alpha release.
+
+=============================================================
+
+Copyright Garth Santor/Trinh Han
+
+The copyright to the computer program(s) herein
+is the property of Garth Santor/Trinh Han of Canada.
+The program(s) may be used and/or copied only with
+the written permission of Garth Santor/Trinh Han
+or in accordance with the terms and conditions
+stipulated in the agreement/contract under which
+the program(s) have been supplied.
+=============================================================*/
+#endif // GUARD_column_hpp20261018_
@@ -0,0 +1,94 @@
+#if !defined(GUARD_compiled_expression_hpp20261018_)
+#define GUARD_compiled_expression_hpp20261018_
+
+/** @file: compiled_expression.hpp
+	@author Chris Pollock
+	@version 0.2.0
+	@date 2026-10-18
+	@note Compiles under Visual C++ 15.4.4
+
+	@brief CompiledExpression class declaration.
+	*/
+
+#include "RPNEvaluator.hpp"
+#include <string>
+#include <vector>
+
+
+/** A parsed and lowered (RPN opcode) expression that can be evaluated repeatedly without re-tokenizing,
+	re-parsing or re-lowering.
+	Repeated subexpressions are computed once per evaluation (see RPNEvaluator::share()).
+	Variables are recorded by name so that the program can be re-bound to the variables of
+	any ExpressionEvaluator that shares the same keyword/function table.
+	*/
+class CompiledExpression {
+public:
+	using string_type = Token::string_type;
+	using session_type = unsigned long long;
+	using program_type = RPNEvaluator::program_type;
+
+	/** Location of a variable token within the program and the name it was bound to. */
+	struct Binding {
+		size_t		position;
+		string_type	name;
+	};
+	using binding_list = std::vector<Binding>;
+
+private:
+	program_type	program_;
+	binding_list	bindings_;
+	session_type	session_;
+	std::size_t		deduplicated_;
+
+public:
+	// C'tor
+	CompiledExpression() : session_(0), deduplicated_(0) { }
+	CompiledExpression(program_type program, binding_list bindings, session_type session, std::size_t deduplicated = 0)
+		: program_(std::move(program))
+		, bindings_(std::move(bindings))
+		, session_(session)
+		, deduplicated_(deduplicated) { }
+
+	/** Gets the lowered RPN program. */
+	program_type const&	get_program() const { return program_; }
+
+	/** Gets the variable bindings (position in the program and variable name). */
+	binding_list const&	get_bindings() const { return bindings_; }
+
+	/** Gets the id of the evaluator session that compiled the expression. */
+	session_type		get_session() const { return session_; }
+
+	/** Gets the number of operations removed by sharing common subexpressions. */
+	std::size_t			get_deduplicated() const { return deduplicated_; }
+
+	/** Tests for an empty program (i.e. compiled from an empty expression). */
+	bool				empty() const { return program_.empty(); }
+};
+
+
+/*=============================================================
+
+Revision History
+
+Version 0.2.0: 2026-10-18
+Added get_deduplicated().
+
+Version 0.1.0: 2026-10-18
+Holds the lowered opcode program instead of the token list.
+
+Version 0.0.0: 2026-10-18
+Alpha release.
+
+=============================================================
+
+Copyright Garth Santor/Trinh Han
+
+The copyright to the computer program(s) herein
+is the property of Garth Santor/Trinh Han of Canada.
+The program(s) may be used and/or copied only with
+the written permission of Garth Santor/Trinh Han
+or in accordance with the terms and conditions
+stipulated in the agreement/contract under which
+the program(s) have been supplied.
+=============================================================*/
+#endif // GUARD_compiled_expression_hpp20261018_
@@ -0,0 +1,74 @@
+#if !defined(GUARD_dependency_graph_hpp20261018_)
+#define GUARD_dependency_graph_hpp20261018_
+
+/** @file: dependency_graph.hpp
+	@author Chris Pollock
+	@version 0.0.0
+	@date 2026-10-18
+	@note Compiles under Visual C++ 15.4.4
+
+	@brief DependencyGraph class declaration.
+	*/
+
+#include <map>
+#include <set>
+#include <string>
+#include <vector>
+
+
+/** Which variables are defined by formulas over which other variables.
+	A variable assigned from an expression that reads other variables is defined by that formula;
+	when any variable it reads changes, it is recomputed, as a spreadsheet cell would be.
+	The graph is kept acyclic: a definition that would close a cycle is refused.
+	*/
+class DependencyGraph {
+public:
+	using string_type = std::string;
+	using name_list = std::vector<string_type>;
+
+private:
+	using name_set = std::set<string_type>;
+
+	std::map<string_type, name_set>	reads_;			// formula variable -> the variables it reads
+	std::map<string_type, name_set>	dependents_;	// variable -> the formula variables that read it
+
+public:
+	/** Defines 'name' by a formula reading 'reads', replacing any previous definition.
+		@return false (and leaves 'name' undefined) if the formula would depend on 'name' itself.
+		*/
+	bool		define(string_type const& name, name_list const& reads);
+
+	/** Drops the formula of 'name': it becomes a plain value. */
+	void		undefine(string_type const& name);
+
+	/** Tests if 'name' is defined by a formula. */
+	bool		is_defined(string_type const& name) const { return reads_.count(name) != 0; }
+
+	/** Gets the variables that depend on 'name', directly or transitively, in the order they must be recomputed. */
+	name_list	dependents(string_type const& name) const;
+
+private:
+	bool		reaches(string_type const& from, name_set const& targets) const;
+};
+
+
+/*=============================================================
+
+Revision History
+
+Version 0.0.0: 2026-10-18
+Alpha release.
+
+=============================================================
+
+Copyright Garth Santor/Trinh Han
+
+The copyright to the computer program(s) herein
+is the property of Garth Santor/Trinh Han of Canada.
+The program(s) may be used and/or copied only with
+the written permission of Garth Santor/Trinh Han
+or in accordance with the terms and conditions
+stipulated in the agreement/contract under which
+the program(s) have been supplied.
+=============================================================*/
+#endif // GUARD_dependency_graph_hpp20261018_
@@ -0,0 +1,91 @@
+#if !defined(GUARD_environment_hpp20261018_)
+#define GUARD_environment_hpp20261018_
+
+/** @file: environment.hpp
+	@author Chris Pollock
+	@version 0.1.0
+	@date 2026-10-18
+	@note Compiles under Visual C++ 15.4.4
+
+	@brief Environment class declaration.
+	*/
+
+#include "variable.hpp"
+#include "variable_store.hpp"
+#include <functional>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <utility>
+#include <vector>
+#include <boost/noncopyable.hpp>
+#include <boost/utility/string_view.hpp>
+
+
+/** The variables of one or more evaluators: a dictionary of variable tokens by name, and their values.
+	Each name is bound to one Variable token for the life of the environment, so programs compiled
+	against the environment stay bound to it.  Values are kept in a VariableStore: evaluation reads one
+	consistent snapshot of them, while assignments (and publish()) make new snapshots.
+	Evaluators on different threads may share an environment.  Binding a name (get_variable(), when an
+	expression is compiled) takes the environment's mutex; reading values does not, see VariableStore.
+	*/
+class Environment : boost::noncopyable {
+public:
+	using string_type = std::string;
+	using view_type = boost::string_view;
+	using snapshot_pointer = VariableStore::snapshot_pointer;
+	using binding_list = std::vector<std::pair<string_type, Operand::pointer_type>>;
+
+private:
+	using dictionary_type = std::map<string_type, Token::pointer_type, std::less<>>;
+
+	mutable std::mutex				mutex_;		// guards variables_ and names_ (not the values)
+	dictionary_type					variables_;
+	std::vector<dictionary_type::const_iterator>	names_;		// by slot: the entry of each variable
+	std::shared_ptr<VariableStore>	store_;
+
+public:
+	// C'tor
+	Environment() : store_(std::make_shared<VariableStore>()) { }
+
+	/** Gets the variable token bound to 'name', creating it if it doesn't exist. */
+	Token::pointer_type	get_variable(view_type name);
+
+	/** Gets the name a variable token is bound to, or an empty string if it is not one of ours. */
+	string_type			find_variable_name(Token::pointer_type const& variable) const;
+
+	/** Gets the current snapshot of the values. */
+	snapshot_pointer	snapshot() const { return store_->snapshot(); }
+
+	/** Sets several variables (creating them if they don't exist) as a single new snapshot. */
+	void				publish(binding_list const& bindings);
+
+	/** Gets the store holding the values. */
+	VariableStore&		get_store() const { return *store_; }
+};
+
+
+/*=============================================================
+
+Revision History
+
+Version 0.1.0: 2026-10-18
+find_variable_name() looks the name up by slot instead of scanning the dictionary.
+
+Version 0.0.0: 2026-10-18
+Alpha release.
+
+=============================================================
+
+Copyright Garth Santor/Trinh Han
+
+The copyright to the computer program(s) herein
+is the property of Garth Santor/Trinh Han of Canada.
+The program(s) may be used and/or copied only with
+the written permission of Garth Santor/Trinh Han
+or in accordance with the terms and conditions
+stipulated in the agreement/contract under which
+the program(s) have been supplied.
+=============================================================*/
+#endif // GUARD_environment_hpp20261018_
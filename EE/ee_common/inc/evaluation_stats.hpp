@@ -0,0 +1,84 @@
+#if !defined(GUARD_evaluation_stats_hpp20261018_)
+#define GUARD_evaluation_stats_hpp20261018_
+
+/** @file: evaluation_stats.hpp
+	@author Chris Pollock
+	@version 0.0.0
+	@date 2026-10-18
+	@note Compiles under Visual C++ 15.4.4
+
+	@brief EvaluationStats declaration.
+	*/
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+
+
+/** Phases of evaluating an expression. */
+enum class phase_type : unsigned char { TOKENIZE = 0, PARSE, COMPILE, EVALUATE, COUNT };
+
+/** Gets the table index of a phase. */
+constexpr std::size_t index_of(phase_type phase) { return static_cast<std::size_t>(phase); }
+
+/** Number of phases. */
+constexpr std::size_t PHASE_COUNT = index_of(phase_type::COUNT);
+
+/** Gets the name of a phase ("tokenize", "parse", "compile" or "evaluate"). */
+char const* phase_name(phase_type phase);
+
+
+
+/** Timing and counters of an ExpressionEvaluator, accumulated over the calls made while they are enabled.
+	COMPILE is lowering, constant folding and subexpression sharing; EVALUATE is executing the program
+	and recomputing the formulas that depend on an assigned variable.
+	An operation counts as a big integer operation if an argument or its result is an Integer outside
+	64 bits, and as a real operation if an argument or its result is a Real.
+	*/
+struct EvaluationStats {
+	std::uint64_t	expressions;		// compiled
+	std::uint64_t	evaluations;		// compiled expressions evaluated
+	std::array<std::uint64_t, PHASE_COUNT>	nanoseconds;	// wall time, by phase
+	std::uint64_t	tokens;				// produced by the tokenizer
+	std::uint64_t	instructions;		// of the compiled programs
+	std::size_t		peak_stack_depth;	// of the operand stack, over all evaluations
+	std::uint64_t	big_integer_operations;
+	std::uint64_t	real_operations;
+
+	// C'tor
+	EvaluationStats() { reset(); }
+
+	/** Sets every counter to zero. */
+	void		reset();
+
+	/** Formats the counters in the Prometheus text exposition format. */
+	std::string	to_prometheus() const;
+
+	/** Writes to_prometheus() to the file 'path', replacing it.  The text is written to a temporary file
+		first and renamed, so a scraper never reads a partial file.
+		*/
+	void		write_prometheus(std::string const& path) const;
+};
+
+
+/*=============================================================
+
+Revision History
+
+Version 0.0.0: 2026-10-18
+Alpha release.
+
+=============================================================
+
+Copyright Garth Santor/Trinh Han
+
+The copyright to the computer program(s) herein
+is the property of Garth Santor/Trinh Han of Canada.
+The program(s) may be used and/or copied only with
+the written permission of Garth Santor/Trinh Han
+or in accordance with the terms and conditions
+stipulated in the agreement/contract under which
+the program(s) have been supplied.
+=============================================================*/
+#endif // GUARD_evaluation_stats_hpp20261018_
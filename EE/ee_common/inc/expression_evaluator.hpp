@@ -4,8 +4,8 @@
 /** @file: expression_evaluator.hpp
 	@author Garth Santor/Trinh Han
 	@author http://www.gats.ca/
-	@version 0.0.1
-	@date 2012-11-13
+	@version 0.9.0
+	@date 2026-10-18
 	@note Compiles under Visual C++ v110
 
 	@brief ExpressionEvaluator class declaration.
@@ -19,24 +19,135 @@
 #include "parser.hpp"
 #include "RPNEvaluator.hpp"
 #include "variable.hpp"
+#include "environment.hpp"
 #include "operand.hpp"
+#include "compiled_expression.hpp"
+#include "dependency_graph.hpp"
+#include "evaluation_stats.hpp"
+#include "parse_cache.hpp"
+#include <map>
+#include <vector>
 
 class ExpressionEvaluator {
 public:
 	typedef Token::string_type	expression_type;
+	typedef Tokenizer::view_type	view_type;
 	typedef Token::pointer_type	result_type;
 private:
 	Tokenizer		tokenizer_;
 	Parser			parser_;
 	RPNEvaluator	rpn_;
+	CompiledExpression::session_type	session_;
+	DependencyGraph		dependencies_;
+	std::map<expression_type, CompiledExpression::program_type>	formulas_;		// the program that assigns each formula variable
+	std::vector<expression_type>	refreshed_;
+	EvaluationStats	stats_;
+	bool			statsEnabled_;
+	ParseCache		cache_;
 public:
+	// C'tors
+	/** Evaluates with variables of its own. */
+	ExpressionEvaluator();
+
+	/** Evaluates with the variables of 'environment', which may be shared with evaluators on other threads. */
+	explicit ExpressionEvaluator(std::shared_ptr<Environment> environment);
+
+	/** Gets the environment holding the variables. */
+	std::shared_ptr<Environment> const&	get_environment() const { return tokenizer_.get_environment(); }
+
+	/** Tokenize and parse an expression once, for repeated evaluation. */
+	CompiledExpression	compile(view_type expr);
+
+	/** Evaluate an expression.  The compiled expression is kept in parse_cache(), so the same text
+		(ignoring whitespace) is not tokenized and parsed again.
+		*/
 	result_type	evaluate(expression_type const& expr);
+
+	/** Evaluate a compiled expression against the current variable bindings.
+		Assigning `name = expression` over other variables makes 'name' a formula: whenever one of those
+		variables is assigned (through this evaluator), 'name' is recomputed.
+		*/
+	result_type	evaluate(CompiledExpression const& compiled);
+
+	/** Sets the precision tier of Real computation.  Applies to expressions compiled afterwards, so parse_cache() is cleared. */
+	void			set_precision(precision_type precision) { rpn_.set_precision(precision); cache_.clear(); }
+
+	/** Gets the precision tier of Real computation. */
+	precision_type	get_precision() const { return rpn_.get_precision(); }
+
+	/** Sets the number of results kept for result(n) (unlimited by default).  Older results are dropped. */
+	void			set_history_limit(std::size_t limit) { rpn_.set_history_limit(limit); }
+
+	/** Gets the number of results kept for result(n). */
+	std::size_t		get_history_limit() const { return rpn_.get_history_limit(); }
+
+	/** Gets the number of results currently kept for result(n). */
+	std::size_t		history_size() const { return rpn_.get_results().size(); }
+
+	/** Sets the value of the variable 'name', creating the variable if it doesn't exist. */
+	void			set_variable(expression_type const& name, Operand::pointer_type value);
+
+	/** Gets the formula variables recomputed by the last evaluate() or set_variable(), in the order they were recomputed. */
+	std::vector<expression_type> const&	get_refreshed() const { return refreshed_; }
+
+	/** Starts or stops recording stats().  Recording is off by default. */
+	void			enable_stats(bool enable);
+
+	/** Tests if stats() are being recorded. */
+	bool			stats_enabled() const { return statsEnabled_; }
+
+	/** Gets the timing and counters recorded since the last reset_stats(). */
+	EvaluationStats const&	stats() const { return stats_; }
+
+	/** Sets every counter of stats() to zero. */
+	void			reset_stats() { stats_.reset(); }
+
+	/** Sets the number of compiled expressions kept by evaluate().  Zero turns the cache off. */
+	void			set_cache_capacity(std::size_t capacity) { cache_.set_capacity(capacity); }
+
+	/** Gets the cache of compiled expressions, with its hit and miss counters. */
+	ParseCache const&	parse_cache() const { return cache_; }
+
+	/** Sets the hit and miss counters of parse_cache() to zero. */
+	void			reset_cache_counters() { cache_.reset_counters(); }
+
+private:
+	void			track(CompiledExpression::binding_list const& bindings, CompiledExpression::program_type const& program);
+	void			refresh(expression_type const& name);
 };
 
 /*=============================================================
 
 Revision History
 
+Version 0.9.0: 2026-10-18
+Added set_history_limit(), get_history_limit() and history_size().
+
+Version 0.8.0: 2026-10-18
+evaluate() of text looks the expression up in a ParseCache before compiling it.
+
+Version 0.7.0: 2026-10-18
+compile() takes a string view.
+
+Version 0.6.0: 2026-10-18
+Added enable_stats(), stats() and reset_stats().
+
+Version 0.5.0: 2026-10-18
+Assignments over other variables are tracked as formulas and recomputed when those variables change.
+Added get_refreshed().
+
+Version 0.4.0: 2026-10-18
+Added the Environment constructor and get_environment().
+
+Version 0.3.0: 2026-10-18
+Added set_variable().
+
+Version 0.2.0: 2026-10-18
+Added set_precision() and get_precision().
+
+Version 0.1.0: 2026-10-18
+Added compile() and evaluate(CompiledExpression).
+
 Version 0.0.0: 2010-10-31
 Alpha release.
 
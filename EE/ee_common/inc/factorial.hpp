@@ -0,0 +1,45 @@
+#if !defined(GUARD_factorial_hpp20261018_)
+#define GUARD_factorial_hpp20261018_
+
+/** @file: factorial.hpp
+	@author Chris Pollock
+	@version 0.0.0
+	@date 2026-10-18
+	@note Compiles under Visual C++ 15.4.4
+
+	@brief Factorial declaration.
+	*/
+
+#include <boost/multiprecision/cpp_int.hpp>
+#include <cstdint>
+
+
+/** Computes n! exactly, as the product tree (binary splitting) of 2..n.
+	Each multiplication is of two products of about the same size, rather than of a huge running
+	product by one small factor.  For large n the leaves, and then each level of the tree, are
+	multiplied in parallel on a shared work-stealing pool; if the pool is busy the caller multiplies
+	the whole tree itself.
+	*/
+boost::multiprecision::cpp_int factorial(std::uint64_t n);
+
+
+/*=============================================================
+
+Revision History
+
+Version 0.0.0: 2026-10-18
+Alpha release.
+
+=============================================================
+
+Copyright Garth Santor/Trinh Han
+
+The copyright to the computer program(s) herein
+is the property of Garth Santor/Trinh Han of Canada.
+The program(s) may be used and/or copied only with
+the written permission of Garth Santor/Trinh Han
+or in accordance with the terms and conditions
+stipulated in the agreement/contract under which
+the program(s) have been supplied.
+=============================================================*/
+#endif // GUARD_factorial_hpp20261018_
@@ -26,58 +26,58 @@ class Function : public Operation { };
 		};
 
 				/** Absolute value function token. */
-				class Abs : public OneArgFunction {	};
+				class Abs : public OneArgFunction { DEF_OPCODE(ABS) };
 
 				/** Arccos value function token. */
-				class Arccos : public OneArgFunction {	};
+				class Arccos : public OneArgFunction { DEF_OPCODE(ARCCOS) };
 
 				/** Arcsin value function token. */
-				class Arcsin : public OneArgFunction {	};
+				class Arcsin : public OneArgFunction { DEF_OPCODE(ARCSIN) };
 
 				/** Arctan value function token. */
-				class Arctan : public OneArgFunction {	};
+				class Arctan : public OneArgFunction { DEF_OPCODE(ARCTAN) };
 
 				/** Ceil value function token. */
-				class Ceil : public OneArgFunction {	};
+				class Ceil : public OneArgFunction { DEF_OPCODE(CEIL) };
 
 				/** Cos value function token. */
-				class Cos : public OneArgFunction {	};
+				class Cos : public OneArgFunction { DEF_OPCODE(COS) };
 
 				/** Exp value function token. */
-				class Exp : public OneArgFunction {	};
+				class Exp : public OneArgFunction { DEF_OPCODE(EXP) };
 
 				/** Floor value function token. */
-				class Floor : public OneArgFunction {	};
+				class Floor : public OneArgFunction { DEF_OPCODE(FLOOR) };
 
 				/** Lb value function token. */
-				class Lb : public OneArgFunction {	};
+				class Lb : public OneArgFunction { DEF_OPCODE(LB) };
 
 				/** Ln value function token. */
-				class Ln : public OneArgFunction {	};
+				class Ln : public OneArgFunction { DEF_OPCODE(LN) };
 
 				/** Log value function token. */
-				class Log : public OneArgFunction {	};
+				class Log : public OneArgFunction { DEF_OPCODE(LOG) };
 
 				/** Result value function token. */
-				class Result : public OneArgFunction {	};
+				class Result : public OneArgFunction { DEF_OPCODE(RESULT) };
 
 				/** Sin value function token. */
-				class Sin : public OneArgFunction {	};
+				class Sin : public OneArgFunction { DEF_OPCODE(SIN) };
 
 				/** Sqrt value function token. */
-				class Sqrt : public OneArgFunction {	};
+				class Sqrt : public OneArgFunction { DEF_OPCODE(SQRT) };
 
 				/** Tan value function token. */
-				class Tan : public OneArgFunction {	};
+				class Tan : public OneArgFunction { DEF_OPCODE(TAN) };
 
 				/** Fib value function token. */
-				class Fib : public OneArgFunction {	};
+				class Fib : public OneArgFunction { DEF_OPCODE(FIB) };
 
 				/** Pel value function token. */
-				class Pel : public OneArgFunction {	};
+				class Pel : public OneArgFunction { DEF_OPCODE(PEL) };
 
 				/** Syl value function token. */
-				class Syl : public OneArgFunction {	};
+				class Syl : public OneArgFunction { DEF_OPCODE(SYL) };
 
 			/** One argument function token base class. */
 			class TwoArgFunction : public Function {
@@ -86,22 +86,25 @@ class Function : public Operation { };
 			};
 
 				/** Arctan2 value function token. */
-				class Arctan2 : public TwoArgFunction {	};
+				class Arctan2 : public TwoArgFunction { DEF_OPCODE(ARCTAN2) };
 
 				/** Max value function token. */
-				class Max : public TwoArgFunction {	};
+				class Max : public TwoArgFunction { DEF_OPCODE(MAX) };
 
 				/** Min value function token. */
-				class Min : public TwoArgFunction {	};
+				class Min : public TwoArgFunction { DEF_OPCODE(MIN) };
 
 				/** Pow value function token. */
-				class Pow : public TwoArgFunction {	};
+				class Pow : public TwoArgFunction { DEF_OPCODE(POW) };
 
 
 /*=============================================================
 
 Revision History
 
+Version 1.1.0: 2026-10-18
+Added DEF_OPCODE to the concrete functions.
+
 Version 1.0.0: 2016-11-02
 Added 'override' keyword where appropriate.
 
@@ -4,8 +4,8 @@
 /** @file: integer.hpp
 	@author Garth Santor/Trinh Han
 	@author http://www.gats.ca/
-	@version 1.0.0
-	@date 2012-11-15
+	@version 1.2.0
+	@date 2026-10-18
 	@note Compiles under Visual C++ v110
 
 	@brief Integer class declaration.
@@ -17,22 +17,43 @@
 #include "operand.hpp"
 #include <boost/multiprecision/cpp_int.hpp>
 #include <boost/multiprecision/debug_adaptor.hpp>
+#include <cstdint>
+#include <limits>
 
 
-/** Integer token. */
+/** Integer token.
+	Values that fit in 64 bits are held inline (the small value); larger values are held as a cpp_int.
+	*/
 class Integer : public Operand {
 public:
 	using value_type = boost::multiprecision::cpp_int;
+	using small_type = std::int64_t;
 	DEF_POINTER_TYPE(Integer)
+	DEF_KIND(INTEGER)
 private:
-	value_type	value_;
+	small_type	small_;
+	bool		isSmall_;
+	value_type	value_;		// only used when !isSmall_
 public:
 	//C'tor
-	Integer( value_type value = 0 )
-		: value_( value ) { }
+	Integer( small_type value = 0 )
+		: small_( value ), isSmall_( true ) { }
+	Integer( value_type const& value )
+		: small_( 0 ), isSmall_( value >= (std::numeric_limits<small_type>::min)() && value <= (std::numeric_limits<small_type>::max)() ) {
+		if (isSmall_)
+			small_ = value.convert_to<small_type>();
+		else
+			value_ = value;
+	}
 
 	// Getter method to get the value of the Integer
-	value_type				get_value() const { return value_; }
+	value_type				get_value() const { return isSmall_ ? value_type(small_) : value_; }
+
+	/** Tests if the value is held inline. */
+	bool					is_small() const { return isSmall_; }
+
+	/** Gets the inline value.  Only meaningful when is_small(). */
+	small_type				get_small() const { return small_; }
 
 	// to_string declaration method
 	string_type				to_string() const;
@@ -44,6 +65,12 @@ public:
 /*=============================================================
 
 Revision History
+Version 1.2.0: 2026-10-18
+64-bit values are held inline; cpp_int only for values outside that range.
+
+Version 1.1.0: 2026-10-18
+Added DEF_KIND.  get_value() returns a reference.
+
 Version 1.0.0: 2014-10-29
 C++ 11 refactor.
 Converted Integer::value_type to boost::multiprecision::cpp_int
@@ -0,0 +1,116 @@
+#if !defined(GUARD_keyword_table_hpp20261018_)
+#define GUARD_keyword_table_hpp20261018_
+
+/** @file: keyword_table.hpp
+	@author Chris Pollock
+	@version 0.2.0
+	@date 2026-10-18
+	@note Compiles under Visual C++ 15.4.4
+
+	@brief KeywordTable class declaration.
+	*/
+
+#include "token.hpp"
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+#include <boost/noncopyable.hpp>
+
+
+/** Process-wide, read-only table of the keyword tokens, shared by all Tokenizers.
+	Keywords are matched ignoring case, through a perfect hash: one hash of the name, one slot probe
+	and one name comparison.
+	Only immutable tokens are shared.  A keyword whose token can change (the 'variable' keyword is a
+	Variable) is not shared: each Tokenizer gets its own token from create().
+	*/
+class KeywordTable : boost::noncopyable {
+public:
+	/** Gets the table.  It is built on first use. */
+	static KeywordTable const& instance();
+
+	static std::size_t const NOT_FOUND = std::size_t(-1);
+
+	/** Finds a keyword, ignoring case.
+		@return the keyword's token, or an empty pointer if 'name' is not a keyword.
+		*/
+	Token::pointer_type find(char const* name, std::size_t length) const;
+
+	/** Finds a keyword, ignoring case.
+		@return the keyword's index, or NOT_FOUND if 'name' is not a keyword.
+		*/
+	std::size_t find_index(char const* name, std::size_t length) const;
+
+	/** Gets the token of the keyword at 'index'. */
+	Token::pointer_type const& token(std::size_t index) const { return entries_[index].token; }
+
+	/** Tests if the keyword at 'index' ends an operand (it is an Operand, a PostfixOperator or a RightParenthesis). */
+	bool ends_operand(std::size_t index) const { return entries_[index].endsOperand; }
+
+	/** Tests if the keyword at 'index' is a Function. */
+	bool is_function(std::size_t index) const { return entries_[index].isFunction; }
+
+	/** Tests if the token of the keyword at 'index' is immutable, so token() may be used by every Tokenizer. */
+	bool is_shared(std::size_t index) const { return entries_[index].create == nullptr; }
+
+	/** Makes a new token for the keyword at 'index'.  Used for the keywords that are not is_shared(). */
+	Token::pointer_type create(std::size_t index) const { return entries_[index].create(); }
+
+	/** Gets the number of keywords. */
+	std::size_t size() const { return entries_.size(); }
+
+private:
+	using factory_type = Token::pointer_type (*)();
+
+	struct Entry {
+		char const*			name;	// lower case
+		Token::pointer_type	token;
+		bool				endsOperand;
+		bool				isFunction;
+		factory_type		create;	// null if 'token' is shared
+
+		Entry(char const* name, Token::pointer_type token);
+	};
+
+	static std::size_t const SLOT_BITS = 8;
+	static std::size_t const EMPTY = 0xFF;
+
+	std::vector<Entry>								entries_;
+	std::array<std::uint8_t, 1 << SLOT_BITS>		slots_;		// entry index, or EMPTY
+	std::uint32_t									multiplier_;
+
+	// C'tor
+	KeywordTable();
+
+	std::size_t slot_of(char const* name, std::size_t length) const;
+	bool		try_multiplier(std::uint32_t multiplier);
+};
+
+
+/*=============================================================
+
+Revision History
+
+Version 0.2.0: 2026-10-18
+Keywords with a mutable token (variable) are created per Tokenizer: is_shared() and create().
+Entry initializes every field.
+
+Version 0.1.0: 2026-10-18
+Added find_index(), token(), ends_operand() and is_function() for the lexeme scanner.
+
+Version 0.0.0: 2026-10-18
+Alpha release.
+
+=============================================================
+
+Copyright Garth Santor/Trinh Han
+
+The copyright to the computer program(s) herein
+is the property of Garth Santor/Trinh Han of Canada.
+The program(s) may be used and/or copied only with
+the written permission of Garth Santor/Trinh Han
+or in accordance with the terms and conditions
+stipulated in the agreement/contract under which
+the program(s) have been supplied.
+=============================================================*/
+#endif // GUARD_keyword_table_hpp20261018_
@@ -0,0 +1,74 @@
+#if !defined(GUARD_lexeme_hpp20261018_)
+#define GUARD_lexeme_hpp20261018_
+
+/** @file: lexeme.hpp
+	@author Chris Pollock
+	@version 0.0.0
+	@date 2026-10-18
+	@note Compiles under Visual C++ 15.4.4
+
+	@brief Lexeme (compact token record) declarations.
+	*/
+
+#include <cstddef>
+#include <cstdint>
+#include <type_traits>
+#include <vector>
+
+
+/** Kind of a lexeme. */
+enum class lexeme_kind : unsigned char {
+	KEYWORD,			// index: KeywordTable entry
+	VARIABLE,			// an identifier that is not a keyword; the name is the source text
+	INTEGER,			// index: LexemeList::integers entry, or NO_INDEX if too long for 64 bits (parsed from the source text)
+	REAL,				// parsed from the source text
+
+	// operators recognized by the scanner itself
+	ASSIGNMENT, EQUALITY, INEQUALITY, LEFT_PARENTHESIS, RIGHT_PARENTHESIS,
+	POWER, MULTIPLICATION, DIVISION, FACTORIAL,
+	ADDITION, IDENTITY, SUBTRACTION, NEGATION
+};
+
+
+/** A token as a trivially copyable record referring back to the source text. */
+struct Lexeme {
+	static std::uint32_t const NO_INDEX = 0xFFFFFFFF;
+
+	lexeme_kind		kind;
+	std::uint32_t	offset;		// position in the source text
+	std::uint32_t	length;		// length in the source text
+	std::uint32_t	index;		// keyword or literal pool index (see lexeme_kind), else NO_INDEX
+};
+
+static_assert(std::is_trivially_copyable<Lexeme>::value, "Lexeme must be trivially copyable");
+
+
+/** The lexemes of an expression and the literal pool they refer to. */
+struct LexemeList {
+	std::vector<Lexeme>			lexemes;
+	std::vector<std::int64_t>	integers;
+
+	void clear() { lexemes.clear(); integers.clear(); }
+};
+
+
+/*=============================================================
+
+Revision History
+
+Version 0.0.0: 2026-10-18
+Alpha release.
+
+=============================================================
+
+Copyright Garth Santor/Trinh Han
+
+The copyright to the computer program(s) herein
+is the property of Garth Santor/Trinh Han of Canada.
+The program(s) may be used and/or copied only with
+the written permission of Garth Santor/Trinh Han
+or in accordance with the terms and conditions
+stipulated in the agreement/contract under which
+the program(s) have been supplied.
+=============================================================*/
+#endif // GUARD_lexeme_hpp20261018_
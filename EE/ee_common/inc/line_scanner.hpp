@@ -0,0 +1,49 @@
+#if !defined(GUARD_line_scanner_hpp20261018_)
+#define GUARD_line_scanner_hpp20261018_
+
+/** @file: line_scanner.hpp
+	@author Chris Pollock
+	@version 0.0.0
+	@date 2026-10-18
+	@note Compiles under Visual C++ 15.4.4
+
+	@brief Newline scanning declarations.
+	*/
+
+#include <cstddef>
+#include <vector>
+#include <boost/utility/string_view.hpp>
+
+
+/** Finds the line boundaries of a block of text.
+	Compares 16 bytes at a time with SSE2 where the target has it (every x64 target), a byte at a time
+	elsewhere.
+	*/
+namespace line_scanner {
+	using view_type = boost::string_view;
+
+	/** Appends the offset of every '\n' in 'text' to 'out', in order. */
+	void	find_newlines(view_type text, std::vector<std::size_t>& out);
+}
+
+
+/*=============================================================
+
+Revision History
+
+Version 0.0.0: 2026-10-18
+Alpha release.
+
+=============================================================
+
+Copyright Garth Santor/Trinh Han
+
+The copyright to the computer program(s) herein
+is the property of Garth Santor/Trinh Han of Canada.
+The program(s) may be used and/or copied only with
+the written permission of Garth Santor/Trinh Han
+or in accordance with the terms and conditions
+stipulated in the agreement/contract under which
+the program(s) have been supplied.
+=============================================================*/
+#endif // GUARD_line_scanner_hpp20261018_
@@ -0,0 +1,60 @@
+#if !defined(GUARD_mapped_file_hpp20261018_)
+#define GUARD_mapped_file_hpp20261018_
+
+/** @file: mapped_file.hpp
+	@author Chris Pollock
+	@version 0.0.0
+	@date 2026-10-18
+	@note Compiles under Visual C++ 15.4.4
+
+	@brief MappedFile class declaration.
+	*/
+
+#include <string>
+#include <boost/interprocess/file_mapping.hpp>
+#include <boost/interprocess/mapped_region.hpp>
+#include <boost/noncopyable.hpp>
+#include <boost/utility/string_view.hpp>
+
+
+/** A file mapped read-only into memory, so its text can be read in place instead of copied through a stream.
+	Pages are read in as they are first touched, by whichever thread touches them.
+	*/
+class MappedFile : boost::noncopyable {
+public:
+	using view_type = boost::string_view;
+
+private:
+	boost::interprocess::file_mapping	mapping_;
+	boost::interprocess::mapped_region	region_;
+
+public:
+	// C'tor
+	/** Maps the file 'path'.  Throws std::runtime_error if it cannot be opened. */
+	explicit MappedFile(std::string const& path);
+
+	/** Gets the text of the file.  Valid for the life of this object. */
+	view_type	text() const { return view_type(static_cast<char const*>(region_.get_address()), region_.get_size()); }
+};
+
+
+/*=============================================================
+
+Revision History
+
+Version 0.0.0: 2026-10-18
+Alpha release.
+
+=============================================================
+
+Copyright Garth Santor/Trinh Han
+
+The copyright to the computer program(s) herein
+is the property of Garth Santor/Trinh Han of Canada.
+The program(s) may be used and/or copied only with
+the written permission of Garth Santor/Trinh Han
+or in accordance with the terms and conditions
+stipulated in the agreement/contract under which
+the program(s) have been supplied.
+=============================================================*/
+#endif // GUARD_mapped_file_hpp20261018_
@@ -0,0 +1,228 @@
+#if !defined(GUARD_numeric_conversion_hpp20261018_)
+#define GUARD_numeric_conversion_hpp20261018_
+
+/** @file: numeric_conversion.hpp
+	@author Chris Pollock
+	@version 0.0.0
+	@date 2026-10-18
+	@note Compiles under Visual C++ 15.4.4
+
+	@brief Direct conversions between the operand value types.
+	*/
+
+#include <boost/multiprecision/cpp_dec_float.hpp>
+#include <boost/multiprecision/cpp_int.hpp>
+#include <cmath>
+#include <cstdint>
+#include <limits>
+#include <stdexcept>
+#include <vector>
+
+
+/** Conversions between the Integer and Real value types (std::int64_t, cpp_int, double and the
+	cpp_dec_float tiers) that work on the binary and decimal digits directly.
+	Boost's own conversions to and from double, and from cpp_int to cpp_dec_float, either format the
+	value as a decimal string and parse it back, or scale it by powers of two with full precision
+	multiplications; the conversions here only multiply or divide by single-limb values.
+	*/
+namespace numeric_conversion {
+	using integer_type = boost::multiprecision::cpp_int;
+
+	/** Converts value to type To. */
+	template <typename To, typename From> To convert(From const& value);
+
+	/** Converts an integer to the integral type To.  Throws 'error' if the value does not fit. */
+	template <typename To> To narrow(std::int64_t value, char const* error);
+	template <typename To> To narrow(integer_type const& value, char const* error);
+
+
+
+	// Selects a conversion by its result type
+	template <typename T> struct to_type { };
+
+	// cpp_dec_float's limb base (10^8): single-limb multipliers and divisors must be smaller
+	std::uint64_t const POWER2_STEP_BITS = 26;
+	std::uint64_t const DECIMAL_CHUNK = 10000000;
+	std::int32_t const DECIMAL_CHUNK_DIGITS = 7;
+	std::uint64_t const INTEGER_CHUNK = DECIMAL_CHUNK * DECIMAL_CHUNK;
+
+	/** Multiplies a cpp_dec_float by 2^shift (divides for a negative shift), exactly when the
+		result's digits fit.
+		*/
+	template <unsigned D, typename E, typename A>
+	void scale_by_power2(boost::multiprecision::backends::cpp_dec_float<D, E, A>& value, long shift) {
+		for (; shift >= long(POWER2_STEP_BITS); shift -= long(POWER2_STEP_BITS))
+			value.mul_unsigned_long_long(std::uint64_t(1) << POWER2_STEP_BITS);
+		for (; shift <= -long(POWER2_STEP_BITS); shift += long(POWER2_STEP_BITS))
+			value.div_unsigned_long_long(std::uint64_t(1) << POWER2_STEP_BITS);
+		if (shift > 0)
+			value.mul_unsigned_long_long(std::uint64_t(1) << shift);
+		else if (shift < 0)
+			value.div_unsigned_long_long(std::uint64_t(1) << -shift);
+	}
+
+	// Same type
+	inline double convert(to_type<double>, double value) { return value; }
+
+	// Between cpp_dec_float tiers: the backend copies (and truncates) the decimal limbs
+	template <unsigned D, typename E, typename A, boost::multiprecision::expression_template_option ET,
+		unsigned FD, typename FE, typename FA, boost::multiprecision::expression_template_option FET>
+	boost::multiprecision::number<boost::multiprecision::backends::cpp_dec_float<D, E, A>, ET>
+	convert(to_type<boost::multiprecision::number<boost::multiprecision::backends::cpp_dec_float<D, E, A>, ET>>,
+		boost::multiprecision::number<boost::multiprecision::backends::cpp_dec_float<FD, FE, FA>, FET> const& value) {
+		using backend_type = boost::multiprecision::backends::cpp_dec_float<D, E, A>;
+		return boost::multiprecision::number<backend_type, ET>(backend_type(value.backend()));
+	}
+
+	/** double to cpp_dec_float: the 53 bit significand, scaled by its power of two.
+		Exact whenever the decimal expansion fits the tier.
+		*/
+	template <unsigned D, typename E, typename A, boost::multiprecision::expression_template_option ET>
+	boost::multiprecision::number<boost::multiprecision::backends::cpp_dec_float<D, E, A>, ET>
+	convert(to_type<boost::multiprecision::number<boost::multiprecision::backends::cpp_dec_float<D, E, A>, ET>>, double value) {
+		using backend_type = boost::multiprecision::backends::cpp_dec_float<D, E, A>;
+		if (value == 0 || !std::isfinite(value))
+			return boost::multiprecision::number<backend_type, ET>(value);
+		int exponent;
+		double const fraction = std::frexp(std::fabs(value), &exponent);
+		backend_type result;
+		result = static_cast<boost::ulong_long_type>(std::ldexp(fraction, std::numeric_limits<double>::digits));
+		scale_by_power2(result, long(exponent) - std::numeric_limits<double>::digits);
+		if (value < 0)
+			result.negate();
+		return boost::multiprecision::number<backend_type, ET>(result);
+	}
+
+	/** cpp_dec_float to double, correctly rounded: the value is scaled by a power of two into
+		[2^52, 2^53), and its integer part rounded half to even by the fraction.
+		Values below the normal range of double are left to boost.
+		*/
+	template <unsigned D, typename E, typename A, boost::multiprecision::expression_template_option ET>
+	double convert(to_type<double>, boost::multiprecision::number<boost::multiprecision::backends::cpp_dec_float<D, E, A>, ET> const& value) {
+		using work_type = boost::multiprecision::backends::cpp_dec_float<std::numeric_limits<double>::max_digits10 * 3>;
+		work_type scaled(value.backend());
+		if (scaled.iszero() || !(scaled.isfinite)())
+			return scaled.extract_double();
+		bool const negative = scaled.isneg();
+		if (negative)
+			scaled.negate();
+
+		double mantissa;
+		typename work_type::exponent_type exponent10;
+		scaled.extract_parts(mantissa, exponent10);
+		if (exponent10 > std::numeric_limits<double>::max_exponent10)
+			return negative ? -std::numeric_limits<double>::infinity() : std::numeric_limits<double>::infinity();
+		if (exponent10 <= std::numeric_limits<double>::min_exponent10)
+			return value.backend().extract_double();
+
+		int const significand_bits = std::numeric_limits<double>::digits - 1;
+		long exponent2 = long(std::floor(std::log2(mantissa) + exponent10 * 3.321928094887362));	// log2(10)
+		scale_by_power2(scaled, significand_bits - exponent2);
+
+		// the estimate of the exponent may be one out
+		work_type low, high;
+		low = static_cast<boost::ulong_long_type>(1) << significand_bits;
+		high = static_cast<boost::ulong_long_type>(1) << (significand_bits + 1);
+		while (scaled.compare(high) >= 0) { scaled.div_unsigned_long_long(2); ++exponent2; }
+		while (scaled.compare(low) < 0) { scaled.mul_unsigned_long_long(2); --exponent2; }
+
+		std::uint64_t significand = scaled.extract_unsigned_long_long();
+		eval_subtract(scaled, static_cast<boost::ulong_long_type>(significand));
+		work_type half;
+		half = 0.5;
+		int const rounding = scaled.compare(half);
+		if (rounding > 0 || (rounding == 0 && (significand & 1)))
+			++significand;
+		double const result = std::ldexp(double(significand), int(exponent2 - significand_bits));
+		return negative ? -result : result;
+	}
+
+	// Anything else (64-bit integers, and same type conversions) is constructed directly
+	template <typename To, typename From>
+	To convert(to_type<To>, From const& value) { return To(value); }
+
+	// cpp_int to double: boost rounds from the binary limbs
+	inline double convert(to_type<double>, integer_type const& value) { return value.convert_to<double>(); }
+
+	/** cpp_int to cpp_dec_float: the integer is split into decimal chunks, most significant first,
+		and accumulated by one single-limb multiplication and addition per chunk.  While accumulating,
+		the working precision is only that of the digits so far.
+		*/
+	template <unsigned D, typename E, typename A, boost::multiprecision::expression_template_option ET>
+	boost::multiprecision::number<boost::multiprecision::backends::cpp_dec_float<D, E, A>, ET>
+	convert(to_type<boost::multiprecision::number<boost::multiprecision::backends::cpp_dec_float<D, E, A>, ET>>, integer_type const& value) {
+		using backend_type = boost::multiprecision::backends::cpp_dec_float<D, E, A>;
+		using result_type = boost::multiprecision::number<backend_type, ET>;
+		if (value >= (std::numeric_limits<std::int64_t>::min)() && value <= (std::numeric_limits<std::int64_t>::max)())
+			return result_type(value.convert_to<std::int64_t>());
+
+		// least significant chunk first
+		std::vector<std::uint64_t> chunks;
+		integer_type rest = abs(value), quotient, remainder;
+		integer_type const divisor = INTEGER_CHUNK;
+		while (rest != 0) {
+			divide_qr(rest, divisor, quotient, remainder);
+			std::uint64_t const chunk = remainder.convert_to<std::uint64_t>();
+			chunks.push_back(chunk % DECIMAL_CHUNK);
+			chunks.push_back(chunk / DECIMAL_CHUNK);
+			rest.swap(quotient);
+		}
+		while (chunks.back() == 0)
+			chunks.pop_back();
+
+		backend_type result;
+		result = static_cast<boost::ulong_long_type>(chunks.back());
+		std::int32_t digits = DECIMAL_CHUNK_DIGITS;
+		for (std::size_t i = chunks.size() - 1; i-- > 0; ) {
+			digits += DECIMAL_CHUNK_DIGITS;
+			result.precision(digits + 2 * DECIMAL_CHUNK_DIGITS);
+			result.mul_unsigned_long_long(DECIMAL_CHUNK);
+			eval_add(result, static_cast<boost::ulong_long_type>(chunks[i]));
+		}
+		result.precision((std::numeric_limits<std::int32_t>::max)());
+		if (value < 0)
+			result.negate();
+		return result_type(result);
+	}
+
+	template <typename To, typename From>
+	To convert(From const& value) {
+		return convert(to_type<To>(), value);
+	}
+
+	template <typename To>
+	To narrow(std::int64_t value, char const* error) {
+		if (value < 0 ? value < std::int64_t((std::numeric_limits<To>::min)()) : std::uint64_t(value) > std::uint64_t((std::numeric_limits<To>::max)()))
+			throw std::runtime_error(error);
+		return static_cast<To>(value);
+	}
+
+	template <typename To>
+	To narrow(integer_type const& value, char const* error) {
+		if (value < (std::numeric_limits<To>::min)() || value > (std::numeric_limits<To>::max)())
+			throw std::runtime_error(error);
+		return value.template convert_to<To>();
+	}
+}
+
+
+/*=============================================================
+
+Revision History
+
+Version 0.0.0: 2026-10-18
+Alpha release.
+
+=============================================================
+
+Copyright Garth Santor/Trinh Han
+
+The copyright to the computer program(s) herein
+is the property of Garth Santor/Trinh Han of Canada.
+The program(s) may be used and/or copied only with
+the written permission of Garth Santor/Trinh Han
+or in accordance with the terms and conditions
+stipulated in the agreement/contract under which
+the program(s) have been supplied.
+=============================================================*/
+#endif // GUARD_numeric_conversion_hpp20261018_
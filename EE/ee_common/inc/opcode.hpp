@@ -0,0 +1,79 @@
+#if !defined(GUARD_opcode_hpp20261018_)
+#define GUARD_opcode_hpp20261018_
+
+/** @file: opcode.hpp
+	@author Chris Pollock
+	@version 0.1.0
+	@date 2026-10-18
+	@note Compiles under Visual C++ 15.4.4
+
+	@brief RPN evaluator opcode declarations.
+	*/
+
+#include <cstddef>
+
+
+/** Operation codes.  Each concrete operation token maps to exactly one opcode,
+	which the RPN evaluator uses as an index into its dispatch table.
+	*/
+enum class opcode_type : unsigned char {
+	UNSUPPORTED = 0, OPERAND,
+
+	// common subexpression temporaries
+	LOAD, STORE,
+
+	// unary operators
+	IDENTITY, NEGATION, NOT, FACTORIAL,
+
+	// binary operators
+	ADDITION, SUBTRACTION, MULTIPLICATION, DIVISION, MODULUS, POWER, ASSIGNMENT,
+	AND, NAND, OR, NOR, XOR, XNOR,
+	EQUALITY, INEQUALITY, GREATER, GREATER_EQUAL, LESS, LESS_EQUAL,
+
+	// one argument functions
+	ABS, ARCCOS, ARCSIN, ARCTAN, CEIL, COS, EXP, FLOOR, LB, LN, LOG, RESULT, SIN, SQRT, TAN,
+	FIB, PEL, SYL,
+
+	// two argument functions
+	ARCTAN2, MAX, MIN, POW,
+
+	COUNT
+};
+
+
+/** Gets the dispatch table index of an opcode. */
+constexpr std::size_t index_of(opcode_type op) { return static_cast<std::size_t>(op); }
+
+
+/** Number of opcodes (dispatch table size). */
+constexpr std::size_t OPCODE_COUNT = index_of(opcode_type::COUNT);
+
+
+
+/** Defines an opcode method.  Used inside a class declaration. */
+#define DEF_OPCODE(op)	public: opcode_type get_opcode() const override { return opcode_type::op; }
+
+
+/*=============================================================
+
+Revision History
+
+Version 0.1.0: 2026-10-18
+Added LOAD and STORE (common subexpression temporaries).
+
+Version 0.0.0: 2026-10-18
+Alpha release.
+
+=============================================================
+
+Copyright Garth Santor/Trinh Han
+
+The copyright to the computer program(s) herein
+is the property of Garth Santor/Trinh Han of Canada.
+The program(s) may be used and/or copied only with
+the written permission of Garth Santor/Trinh Han
+or in accordance with the terms and conditions
+stipulated in the agreement/contract under which
+the program(s) have been supplied.
+=============================================================*/
+#endif // GUARD_opcode_hpp20261018_
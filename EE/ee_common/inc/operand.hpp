@@ -16,18 +16,36 @@
 
 #include "token.hpp"
 #include <cassert>
+#include <cstddef>
+
+
+/** Operand kinds.  Lets the evaluator select an implementation by table lookup instead of casting. */
+enum class operand_kind : unsigned char { NONE = 0, INTEGER, REAL, BOOLEAN, VARIABLE, COUNT };
+
+/** Gets the table index of an operand kind. */
+constexpr std::size_t index_of(operand_kind kind) { return static_cast<std::size_t>(kind); }
+
+/** Number of operand kinds (table dimension). */
+constexpr std::size_t OPERAND_KIND_COUNT = index_of(operand_kind::COUNT);
+
+/** Defines an operand kind method.  Used inside a class declaration. */
+#define DEF_KIND(kind)	public: operand_kind get_kind() const override { return operand_kind::kind; }
+
 
 
 /** Operand token base class. */
 class Operand : public Token {
 public:
 	DEF_POINTER_TYPE(Operand)
+
+	/** Gets the operand kind. */
+	virtual operand_kind get_kind() const { return operand_kind::NONE; }
 };
 
 
 /** Make a new smart-pointer managed Token object with constructor parameter. */
 template <typename T, typename U> inline Operand::pointer_type make_operand( U const& param ) {
-	return Operand::pointer_type( new T(param) );
+	return std::allocate_shared<T>( TokenAllocator<T>(), param );
 }
 
 
@@ -44,6 +62,11 @@ typename OPERAND_TYPE::value_type get_value( Token::pointer_type const& operand
 
 Revision History
 
+Version 0.3.0: 2026-10-18
+make_operand<>() allocates from the token pool.
+
+Version 0.2.0: 2026-10-18
+Added operand_kind and get_kind().
 Version 0.1.1: 2012-11-13
 C++ cleanup.
 
@@ -15,6 +15,7 @@
 
 
 #include "operand.hpp"
+#include "opcode.hpp"
 
 
 /** Operation token base class. */
@@ -23,6 +24,9 @@ public:
 	DEF_POINTER_TYPE(Operation)
 
 	virtual unsigned number_of_args() const = 0;
+
+	/** Gets the evaluator opcode.  Abstract and unsupported operations yield UNSUPPORTED. */
+	virtual opcode_type get_opcode() const { return opcode_type::UNSUPPORTED; }
 };
 
 
@@ -31,6 +35,9 @@ public:
 /*=============================================================
 
 Revision History
+Version 1.1.0: 2026-10-18
+Added get_opcode().
+
 Version 1.0.0: 2016-11-02
 Added 'override' keyword where appropriate.
 
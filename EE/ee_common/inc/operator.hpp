@@ -76,16 +76,19 @@ public:
 /* Negation token class */
 class Negation : public NonAssociative {
 	DEF_PRECEDENCE(UNARY);
+	DEF_OPCODE(NEGATION)
 };
 
 /* Identity token class */
 class Identity : public NonAssociative {
 	DEF_PRECEDENCE(UNARY);
+	DEF_OPCODE(IDENTITY)
 };
 
 /* Not token class */
 class Not : public NonAssociative {
 	DEF_PRECEDENCE(UNARY);
+	DEF_OPCODE(NOT)
 };
 
 /* BitNot token class */
@@ -101,6 +104,7 @@ class PostfixOperator : public NonAssociative {
 /* Factorial token class */
 class Factorial : public PostfixOperator {
 	DEF_PRECEDENCE(POSTFIX);
+	DEF_OPCODE(FACTORIAL)
 };
 
 /** Right-associative operator base class. */
@@ -109,6 +113,7 @@ class RAssocOperator : public BinaryOperator { };
 		/** Power token class */
 		class Power : public RAssocOperator {
 		DEF_PRECEDENCE(POWER)
+		DEF_OPCODE(POWER)
 		};
 
 /** Left-associative operator base class. */
@@ -122,16 +127,19 @@ class Multiplicative : public LAssocOperator {
 		/** Multiplication token class */
 		class Multiplication : public  Multiplicative {
 			DEF_PRECEDENCE(MULTIPLICATIVE);
+			DEF_OPCODE(MULTIPLICATION)
 		};
 
 		/** Division token class */
 		class Division : public Multiplicative {
 			DEF_PRECEDENCE(MULTIPLICATIVE);
+			DEF_OPCODE(DIVISION)
 		};
 
 		/** Modulus token class */
 		class Modulus : public Multiplicative {
 			DEF_PRECEDENCE(MULTIPLICATIVE);
+			DEF_OPCODE(MODULUS)
 		};
 
 /** Additive operator base class. */
@@ -142,11 +150,13 @@ class Additive : public LAssocOperator {
 	/** Addition token class */
 	class Addition : public Additive {
 		DEF_PRECEDENCE(ADDITIVE);
+		DEF_OPCODE(ADDITION)
 	};
 
 	/** Subtraction token class */
 	class Subtraction : public Additive {
 		DEF_PRECEDENCE(ADDITIVE);
+		DEF_OPCODE(SUBTRACTION)
 	};
 
 /** BitShift operator base class. */
@@ -172,31 +182,37 @@ class Relational : public LAssocOperator {
 	/** Greater token class */
 	class Greater : public Relational {
 		DEF_PRECEDENCE(RELATIONAL);
+		DEF_OPCODE(GREATER)
 	};
 
 	/** Less token class */
 	class Less : public Relational {
 		DEF_PRECEDENCE(RELATIONAL);
+		DEF_OPCODE(LESS)
 	};
 
 	/** GreaterEqual token class */
 	class GreaterEqual : public Relational {
 		DEF_PRECEDENCE(RELATIONAL);
+		DEF_OPCODE(GREATER_EQUAL)
 	};
 
 	/** LessEqual token class */
 	class LessEqual : public Relational {
 	DEF_PRECEDENCE(RELATIONAL);
+	DEF_OPCODE(LESS_EQUAL)
 	};
 
 /** Equality token class */
 class Equality : public LAssocOperator {
 	DEF_PRECEDENCE(EQUALITY);
+	DEF_OPCODE(EQUALITY)
 };
 
 /** Inequality token class */
 class Inequality : public LAssocOperator {
 	DEF_PRECEDENCE(EQUALITY);
+	DEF_OPCODE(INEQUALITY)
 };
 
 /** BitAnd token class */
@@ -217,11 +233,13 @@ class LogAnd : public LAssocOperator {
 	/** And token class */
 	class And : public LogAnd {
 		DEF_PRECEDENCE(LOGAND);
+		DEF_OPCODE(AND)
 	};
 
 	/** Nand token class */
 	class Nand : public LogAnd {
 		DEF_PRECEDENCE(LOGAND);
+		DEF_OPCODE(NAND)
 	};
 
 /** LogXor token base class */
@@ -232,11 +250,13 @@ class LogXor : public LAssocOperator {
 	/** Xor token class */
 	class Xor : public LogXor {
 		DEF_PRECEDENCE(LOGXOR);
+		DEF_OPCODE(XOR)
 	};
 
 	/** Xnor token class */
 	class Xnor : public LogXor {
 		DEF_PRECEDENCE(LOGXOR);
+		DEF_OPCODE(XNOR)
 	};
 
 /** LogOr token base class */
@@ -247,22 +267,28 @@ class LogOr : public LAssocOperator {
 	/** Or token class */
 	class Or : public LogOr {
 		DEF_PRECEDENCE(LOGOR);
+		DEF_OPCODE(OR)
 	};
 
 	/** Nor token class */
 	class Nor : public LogOr {
 		DEF_PRECEDENCE(LOGOR);
+		DEF_OPCODE(NOR)
 	};
 
 /** Assignment token class */
 class Assignment : public RAssocOperator {
 	DEF_PRECEDENCE(ASSIGNMENT);
+	DEF_OPCODE(ASSIGNMENT)
 };
 
 
 /*=============================================================
 
 Revision History
+Version 1.1.0: 2026-10-18
+Added DEF_OPCODE to the concrete operators.
+
 Version 1.0.0: 2016-11-02
 Added 'override' keyword where appropriate.
 
@@ -0,0 +1,105 @@
+#if !defined(GUARD_parallel_evaluator_hpp20261018_)
+#define GUARD_parallel_evaluator_hpp20261018_
+
+/** @file: parallel_evaluator.hpp
+	@author Chris Pollock
+	@version 0.1.0
+	@date 2026-10-18
+	@note Compiles under Visual C++ 15.4.4
+
+	@brief ParallelEvaluator class declaration.
+	*/
+
+#include "batch_evaluator.hpp"
+#include "expression_evaluator.hpp"
+#include "work_stealing_pool.hpp"
+#include <cstddef>
+#include <memory>
+#include <vector>
+#include <boost/noncopyable.hpp>
+
+
+/** Spreads evaluation across the workers of a WorkStealingPool.
+	Each worker evaluates its jobs with an ExpressionEvaluator of its own, so its tokenizer, variables and
+	parse cache are reused from job to job.  Jobs share no mutable state: a job's bindings are cleared once
+	it is done, and a job that leaves anything else behind gets its worker a new evaluator.  Row ranges
+	write disjoint rows of the output column.  Results are in job (or row) order whichever worker ran them.
+	result(n) has no earlier results to refer to in a job.
+	*/
+class ParallelEvaluator : boost::noncopyable {
+public:
+	using expression_type = ExpressionEvaluator::expression_type;
+	using result_type = ExpressionEvaluator::result_type;
+	using result_list_type = std::vector<result_type>;
+
+	/** A variable and the value it is set to before the job's expression is evaluated. */
+	struct Binding {
+		expression_type			name;
+		Operand::pointer_type	value;
+	};
+
+	/** An expression and its variable bindings. */
+	struct Job {
+		expression_type			expression;
+		std::vector<Binding>	bindings;
+	};
+	using job_list_type = std::vector<Job>;
+
+	/** Rows per task when evaluating a batch. */
+	static std::size_t const CHUNK_ROWS = 16 * BatchEvaluator::BLOCK_SIZE;
+
+private:
+	WorkStealingPool	pool_;
+	precision_type		precision_;
+	std::vector<std::unique_ptr<ExpressionEvaluator>>	evaluators_;	// by worker; made on first use
+
+public:
+	// C'tor
+	/** Starts 'threads' workers (the hardware concurrency if 0). */
+	explicit ParallelEvaluator(std::size_t threads = 0);
+
+	/** Gets the number of workers. */
+	std::size_t			threads() const { return pool_.size(); }
+
+	/** Sets the precision tier of Real computation used by jobs. */
+	void				set_precision(precision_type precision) { precision_ = precision; }
+
+	/** Gets the precision tier of Real computation used by jobs. */
+	precision_type		get_precision() const { return precision_; }
+
+	/** Evaluates the jobs.  Result i is job i's result.
+		If jobs throw, the exception of the lowest numbered one is rethrown.
+		*/
+	result_list_type	evaluate(job_list_type const& jobs);
+
+	/** Evaluates every row of a batch into 'out', CHUNK_ROWS rows per task. */
+	void				evaluate(BatchEvaluator const& batch, Column& out);
+
+private:
+	std::unique_ptr<ExpressionEvaluator>	make_evaluator() const;
+};
+
+
+/*=============================================================
+
+Revision History
+
+Version 0.1.0: 2026-10-18
+One ExpressionEvaluator per worker, kept between jobs and between calls of evaluate().
+
+Version 0.0.0: 2026-10-18
+Alpha release.
+
+=============================================================
+
+Copyright Garth Santor/Trinh Han
+
+The copyright to the computer program(s) herein
+is the property of Garth Santor/Trinh Han of Canada.
+The program(s) may be used and/or copied only with
+the written permission of Garth Santor/Trinh Han
+or in accordance with the terms and conditions
+stipulated in the agreement/contract under which
+the program(s) have been supplied.
+=============================================================*/
+#endif // GUARD_parallel_evaluator_hpp20261018_
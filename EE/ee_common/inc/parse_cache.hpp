@@ -0,0 +1,107 @@
+#if !defined(GUARD_parse_cache_hpp20261018_)
+#define GUARD_parse_cache_hpp20261018_
+
+/** @file: parse_cache.hpp
+	@author Chris Pollock
+	@version 0.0.0
+	@date 2026-10-18
+	@note Compiles under Visual C++ 15.4.4
+
+	@brief ParseCache class declaration.
+	*/
+
+#include "compiled_expression.hpp"
+#include <cstddef>
+#include <list>
+#include <map>
+#include <string>
+#include <utility>
+#include <boost/utility/string_view.hpp>
+
+
+/** The most recently used compiled expressions, keyed by their normalized text.
+	A compiled program holds its variables as the environment's variable tokens, never their values,
+	so a cached program reads the current value of each variable every time it is executed.
+	*/
+class ParseCache {
+public:
+	using string_type = std::string;
+	using view_type = boost::string_view;
+
+	static std::size_t const DEFAULT_CAPACITY = 256;
+
+private:
+	using entry_type = std::pair<string_type, CompiledExpression>;
+	using list_type = std::list<entry_type>;
+
+	list_type										entries_;	// most recently used first
+	std::map<string_type, list_type::iterator>		index_;
+	std::size_t										capacity_;
+	std::size_t										hits_;
+	std::size_t										misses_;
+
+public:
+	// C'tor
+	explicit ParseCache(std::size_t capacity = DEFAULT_CAPACITY) : capacity_(capacity), hits_(0), misses_(0) { }
+
+	/** Gets the expression cached under 'key' and marks it most recently used, or null if there is none. */
+	CompiledExpression const*	find(string_type const& key);
+
+	/** Caches 'compiled' under 'key', evicting the least recently used expression when full.
+		@return the cached expression, or 'compiled' itself if the capacity is zero.
+		*/
+	CompiledExpression const&	insert(string_type const& key, CompiledExpression const& compiled);
+
+	/** Sets the number of expressions kept, evicting the least recently used ones.  Zero turns the cache off. */
+	void			set_capacity(std::size_t capacity);
+
+	/** Gets the number of expressions kept. */
+	std::size_t		get_capacity() const { return capacity_; }
+
+	/** Gets the number of expressions cached. */
+	std::size_t		size() const { return entries_.size(); }
+
+	/** Gets the number of lookups that found their expression. */
+	std::size_t		hits() const { return hits_; }
+
+	/** Gets the number of lookups that did not. */
+	std::size_t		misses() const { return misses_; }
+
+	/** Drops every cached expression.  The counters are kept. */
+	void			clear();
+
+	/** Sets hits() and misses() to zero. */
+	void			reset_counters() { hits_ = misses_ = 0; }
+
+	/** Gets the key of an expression: its text without the whitespace the tokenizer ignores.
+		A run of whitespace is dropped unless it separates two characters that could be read as one token
+		(two word characters, two symbols, or part of a Real literal).
+		*/
+	static string_type	normalize(view_type text);
+
+private:
+	void			evict(std::size_t keep);
+};
+
+
+
+/*=============================================================
+
+Revision History
+
+Version 0.0.0: 2026-10-18
+Alpha release.
+
+=============================================================
+
+Copyright Garth Santor/Trinh Han
+
+The copyright to the computer program(s) herein
+is the property of Garth Santor/Trinh Han of Canada.
+The program(s) may be used and/or copied only with
+the written permission of Garth Santor/Trinh Han
+or in accordance with the terms and conditions
+stipulated in the agreement/contract under which
+the program(s) have been supplied.
+=============================================================*/
+#endif // GUARD_parse_cache_hpp20261018_
@@ -4,8 +4,8 @@
 /** @file: real.hpp
 	@author Garth Santor/Trinh Han
 	@author http://www.gats.ca/
-	@date 2012-11-13
-	@version 1.0.0
+	@date 2026-10-18
+	@version 1.4.0
 	@note Compiles under Visual C++ v120
 
 	@brief Real class declaration.
@@ -14,44 +14,125 @@
 	@date 2018 07 12
 	*/
 
+#include "numeric_conversion.hpp"
 #include "operand.hpp"
 #include <boost/multiprecision/cpp_dec_float.hpp>
 #include <boost/math/constants/constants.hpp>
+#include <boost/variant.hpp>
+#include <cstddef>
+#include <ios>
 
 
-/** Real number token. */
+/** Real number precision tiers. */
+enum class precision_type : unsigned char { DOUBLE = 0, DIGITS_50, DIGITS_100, DIGITS_1000, COUNT };
+
+/** Gets the table index of a precision tier. */
+constexpr std::size_t index_of(precision_type precision) { return static_cast<std::size_t>(precision); }
+
+/** Number of precision tiers. */
+constexpr std::size_t PRECISION_COUNT = index_of(precision_type::COUNT);
+
+/** Gets the smallest precision tier holding at least 'digits' significant decimal digits. */
+precision_type precision_for_digits(unsigned digits);
+
+
+
+/** Real number token.
+	The value is held at one of the precision tiers; get_value() always yields the full (1000 digit) value.
+	*/
 class Real : public Operand {
 public:
 	DEF_POINTER_TYPE(Real)
+	DEF_KIND(REAL)
 		using value_type = boost::multiprecision::number<boost::multiprecision::cpp_dec_float<1000, int32_t, void>>;
+		using double_type = double;
+		using digits50_type = boost::multiprecision::number<boost::multiprecision::cpp_dec_float<50>>;
+		using digits100_type = boost::multiprecision::number<boost::multiprecision::cpp_dec_float<100>>;
 private:
-	value_type	value_;
+	// alternatives in precision_type order
+	using storage_type = boost::variant<double_type, digits50_type, digits100_type, value_type>;
+	storage_type	value_;
+
+	// Converts whichever alternative is held to T
+	template <typename T> struct converter : boost::static_visitor<T> {
+		template <typename U> T operator()(U const& value) const { return numeric_conversion::convert<T>(value); }
+	};
 public:
 	// C'tor
 	Real( value_type value = value_type(0) ) : value_( value ) { }
-	value_type				get_value() const { return value_; }
+	Real( double_type value ) : value_( value ) { }
+	Real( digits50_type const& value ) : value_( value ) { }
+	Real( digits100_type const& value ) : value_( value ) { }
+
+	/** Gets the value at full precision. */
+	value_type				get_value() const { return get_value_as<value_type>(); }
+
+	/** Gets the value converted to one of the tier types. */
+	template <typename T> T	get_value_as() const;
+
+	/** Gets the precision tier the value is held at. */
+	precision_type			get_precision() const { return static_cast<precision_type>(value_.which()); }
+
 	string_type				to_string() const;
+
+	/** Formats the value with 'digits' significant digits. */
+	string_type				format(std::streamsize digits) const;
+
+	/** Gets the value held at another precision tier. */
+	virtual pointer_type	to_precision(precision_type precision) const;
 };
 
 
-/** Pi constant token. */
+template <typename T>
+T Real::get_value_as() const {
+	return boost::apply_visitor(converter<T>(), value_);
+}
+
+
+/** Pi constant token.
+	instance() hands out a process-wide shared token, computed once per precision tier.
+	*/
 class Pi : public Real {
 public:
 	// C'tor
 	Pi() : Real( boost::math::constants::pi<value_type>() ) { }
+
+	/** Gets the shared constant at a precision tier. */
+	static Real::pointer_type const& instance(precision_type precision = precision_type::DIGITS_1000);
+
+	pointer_type to_precision(precision_type precision) const override;
 };
 
-/** E constant token. */
+/** E constant token.
+	instance() hands out a process-wide shared token, computed once per precision tier.
+	*/
 class E : public Real {
 public:
 	// C'tor
 	E() : Real(boost::math::constants::e<value_type>()) { }
+
+	/** Gets the shared constant at a precision tier. */
+	static Real::pointer_type const& instance(precision_type precision = precision_type::DIGITS_1000);
+
+	pointer_type to_precision(precision_type precision) const override;
 };
 
 
 /*=============================================================
 
 Revision History
+Version 1.4.0: 2026-10-18
+Tier conversions through numeric_conversion rather than boost's string round trip.
+
+Version 1.3.0: 2026-10-18
+Added Pi::instance() and E::instance(): shared constants per precision tier.
+
+Version 1.2.0: 2026-10-18
+Value held at a selectable precision tier (double, 50, 100 or 1000 digits).
+
+Version 1.1.0: 2026-10-18
+Added DEF_KIND.  get_value() returns a reference.
+
 Version 1.0.0: 2014-10-29
 C++ 11 refactor.
 Switched value_type to boost::multiprecision::cpp_dec_float_100
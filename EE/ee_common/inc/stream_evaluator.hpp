@@ -0,0 +1,140 @@
+#if !defined(GUARD_stream_evaluator_hpp20261018_)
+#define GUARD_stream_evaluator_hpp20261018_
+
+/** @file: stream_evaluator.hpp
+	@author Chris Pollock
+	@version 0.3.0
+	@date 2026-10-18
+	@note Compiles under Visual C++ 15.4.4
+
+	@brief StreamEvaluator class declaration.
+	*/
+
+#include "expression_evaluator.hpp"
+#include <cstddef>
+#include <functional>
+#include <iosfwd>
+#include <string>
+#include <boost/noncopyable.hpp>
+
+
+/** Evaluates a stream of expressions, one per line, as a pipeline.
+	Chunks of text pass through bounded queues from a reader, to compilers that cut them into lines and
+	tokenize, parse and compile each, to the evaluator, to a formatter that writes the results.  Compiling
+	a line does not depend on the lines before it, so several compilers run at once; their chunks are put
+	back in order before evaluation.  Lines are tokenized in place, as views of the chunk's text.  Lines are evaluated in order by a single ExpressionEvaluator, so assignments and
+	result(n) behave as they do when the lines are evaluated one at a time, except that only the last
+	HISTORY_RESULTS results can be referred to by result(n).
+	Each result is written as "[line] = value" and each error as "[line] message", where line is the
+	line number in the input.  Blank lines are skipped.  Output is buffered and written in large blocks.
+	*/
+class StreamEvaluator : boost::noncopyable {
+public:
+	using result_type = ExpressionEvaluator::result_type;
+	using view_type = ExpressionEvaluator::view_type;
+
+	/** Converts a result (an operand, never a variable) to the text written after "= ". */
+	using formatter_type = std::function<std::string(result_type const&)>;
+
+	/** Lines read from a stream passed between stages at a time. */
+	static std::size_t const CHUNK_LINES = 64;
+
+	/** Bytes of in-memory text (the default) passed between stages at a time, rounded up to a whole line. */
+	static std::size_t const SHARD_BYTES = 1024 * 1024;
+
+	/** Chunks each queue between stages holds. */
+	static std::size_t const QUEUE_CHUNKS = 16;
+
+	/** Results kept for result(n) during a run (if the evaluator's history limit is not already lower). */
+	static std::size_t const HISTORY_RESULTS = 1024;
+
+	/** The figures of a run.  Latency is per line: from a compiler starting on the line to its result (or error)
+		being buffered for output.  Time a line spends queued before that, in its chunk or shard, is not included,
+		so the figures of run(std::istream&) and run(view_type) are comparable whatever the chunk size.
+		The mean and maximum are exact; the median and 99th percentile are rounded up by at most 9%.
+		*/
+	struct Summary {
+		std::size_t	lines;			// not blank, including those in error
+		std::size_t	errors;
+		double		seconds;		// wall time of the run
+		double		meanLatency;	// seconds
+		double		medianLatency;
+		double		p99Latency;
+		double		maxLatency;
+
+		/** Gets the lines evaluated per second. */
+		double		throughput() const { return seconds > 0 ? lines / seconds : 0; }
+	};
+
+private:
+	ExpressionEvaluator&	evaluator_;
+	formatter_type			formatter_;
+	std::size_t				compilers_;
+	std::size_t				shardBytes_;
+
+public:
+	// C'tor
+	/** Evaluates with 'evaluator', formatting results with 'formatter' (Token::to_string() if empty).
+		Runs 'compilers' compiler threads (if 0, the hardware concurrency less the reader, evaluator and formatter, at least 1).
+		*/
+	explicit StreamEvaluator(ExpressionEvaluator& evaluator, formatter_type formatter = formatter_type(), std::size_t compilers = 0);
+
+	/** Gets the number of compiler threads. */
+	std::size_t	compilers() const { return compilers_; }
+
+	/** Sets the bytes of in-memory text passed between stages at a time. */
+	void		set_shard_bytes(std::size_t bytes) { shardBytes_ = bytes == 0 ? 1 : bytes; }
+
+	/** Gets the bytes of in-memory text passed between stages at a time. */
+	std::size_t	get_shard_bytes() const { return shardBytes_; }
+
+	/** Evaluates every line of 'in', writing results to 'out' and errors to 'errors'.
+		An error in one line does not stop the others.  Exceptions other than those of a line are rethrown.
+		*/
+	Summary		run(std::istream& in, std::ostream& out, std::ostream& errors);
+
+	/** Evaluates every line of 'text' (e.g. a MappedFile) in place, as run(std::istream&) does.
+		Each compiler takes a contiguous shard of the text, so the pages it reads stay with one thread.
+		'text' must be unchanged until run() returns.
+		*/
+	Summary		run(view_type text, std::ostream& out, std::ostream& errors);
+
+private:
+	struct Chunk;
+
+	/** Reads the input as chunks of text, passing each to 'push' (which returns false once the run has failed). */
+	using reader_type = std::function<void(std::function<bool(Chunk&&)> const& push)>;
+
+	Summary		run(reader_type const& read, std::ostream& out, std::ostream& errors);
+};
+
+
+/*=============================================================
+
+Revision History
+
+Version 0.3.0: 2026-10-18
+Latency is measured per line, from a compiler starting on it.
+
+Version 0.2.0: 2026-10-18
+Added HISTORY_RESULTS; the median and 99th percentile latencies are taken from a histogram.
+
+Version 0.1.0: 2026-10-18
+Added run(view_type): evaluates in-memory text in shards, without copying lines.
+
+Version 0.0.0: 2026-10-18
+Alpha release.
+
+=============================================================
+
+Copyright Garth Santor/Trinh Han
+
+The copyright to the computer program(s) herein
+is the property of Garth Santor/Trinh Han of Canada.
+The program(s) may be used and/or copied only with
+the written permission of Garth Santor/Trinh Han
+or in accordance with the terms and conditions
+stipulated in the agreement/contract under which
+the program(s) have been supplied.
+=============================================================*/
+#endif // GUARD_stream_evaluator_hpp20261018_
@@ -4,8 +4,8 @@
 /** @file: token.hpp
 	@author Garth Santor/Trinh Han
 	@author http://www.gats.ca/
-	@date 2015-11-03
-	@version 0.3.0
+	@date 2026-10-18
+	@version 0.5.0
 	@note Compiles under Visual C++ v110
 
 	@brief Token class declaration for Expression Evaluator project.
@@ -14,6 +14,7 @@
 	@date 2018 07 12
 	*/
 
+#include "token_allocator.hpp"
 #include <memory>
 #include <boost/noncopyable.hpp>
 #include <string>
@@ -47,9 +48,9 @@ public:
 /** Make a new smart-pointer managed Token object. */
 // todo: make<T>
 template<typename T>
-inline Token::pointer_type make() // dynamically allocate with a shared pointer
+inline Token::pointer_type make() // allocate the token and its shared pointer control block from the token pool
 {
-	return Token::pointer_type(new T); // Token is the base class and T is could be a sub class like Integer
+	return std::allocate_shared<T>(TokenAllocator<T>()); // Token is the base class and T is could be a sub class like Integer
 };
 
 /** Make a new smart-pointer managed Token object with constructor parameter. */
@@ -57,7 +58,7 @@ inline Token::pointer_type make() // dynamically allocate with a shared pointer
 template<typename T, typename U> // U is a parameter type and T is a Token type
 inline Token::pointer_type make(U const& param) 
 {
-	return Token::pointer_type(new T(param)); 
+	return std::allocate_shared<T>(TokenAllocator<T>(), param);
 };
 
 
@@ -85,7 +86,7 @@ inline bool is(ORIGINAL_TYPE const& tkn)
 template<typename CAST_TYPE, typename ORIGINAL_TYPE>
 inline bool is(ORIGINAL_TYPE const * tknptr)
 {
-	return std::dynamic_cast<CAST_TYPE const*>(tknptr) != nullptr;
+	return dynamic_cast<CAST_TYPE const*>(tknptr) != nullptr;
 };
 
 /** Convert to subclass type. */
@@ -117,6 +118,12 @@ inline std::ostream& operator << (std::ostream& os, Token::pointer_type const& t
 
 Revision History
 
+Version 0.5.0: 2026-10-18
+is<>(Token const*) uses dynamic_cast (std::dynamic_cast is a Visual C++ extension).
+
+Version 0.4.0: 2026-10-18
+make<>() allocates from the token pool.
+
 Version 0.2.1: 2012-11-13
 C++ 11 cleanup
 
@@ -0,0 +1,93 @@
+#if !defined(GUARD_token_allocator_hpp20261018_)
+#define GUARD_token_allocator_hpp20261018_
+
+/** @file: token_allocator.hpp
+	@author Chris Pollock
+	@version 0.2.0
+	@date 2026-10-18
+	@note Compiles under Visual C++ 15.4.4
+
+	@brief Pooled token allocation.
+	*/
+
+#include "allocation_tracking.hpp"
+#include <cstddef>
+#include <typeinfo>
+
+
+/** Size-class pool for token storage.
+	Each thread allocates from its own free lists, so allocation and release take no lock and make no
+	call to the system allocator once the pool is warm.  Pool memory is never returned to the system,
+	so a block may be released by any thread.  A thread's free lists are capped: the excess, such as blocks
+	released by a consumer thread, goes to a shared stack that other threads refill from.
+	Requests larger than MAX_POOLED_SIZE use operator new.
+	*/
+namespace token_pool {
+	std::size_t const ALIGNMENT = 16;
+	std::size_t const MAX_POOLED_SIZE = 1024;
+
+	void*	allocate(std::size_t bytes);
+	void	deallocate(void* block, std::size_t bytes) noexcept;
+
+	/** Gets the number of chunks the pool has taken from operator new. */
+	std::size_t	chunks_allocated() noexcept;
+}
+
+
+
+/** Standard allocator over the token pool.  Used with std::allocate_shared() so that a token and its
+	shared_ptr control block are a single pooled block.
+	TOKEN is the token type the allocator was made for.  Rebinding (to the control block type) keeps it,
+	so allocation_tracking can count the block against the token type.
+	*/
+template <typename T, typename TOKEN = T>
+class TokenAllocator {
+public:
+	using value_type = T;
+	static_assert(alignof(T) <= token_pool::ALIGNMENT, "TokenAllocator: over-aligned type");
+
+	// C'tor
+	TokenAllocator() noexcept { }
+	template <typename U> TokenAllocator(TokenAllocator<U, TOKEN> const&) noexcept { }
+
+	T*		allocate(std::size_t n) {
+		if (allocation_tracking::enabled())
+			allocation_tracking::record_token(typeid(TOKEN), n * sizeof(T));
+		return static_cast<T*>(token_pool::allocate(n * sizeof(T)));
+	}
+	void	deallocate(T* block, std::size_t n) noexcept { token_pool::deallocate(block, n * sizeof(T)); }
+};
+
+template <typename T, typename U, typename TOKEN>
+inline bool operator == (TokenAllocator<T, TOKEN> const&, TokenAllocator<U, TOKEN> const&) { return true; }
+
+template <typename T, typename U, typename TOKEN>
+inline bool operator != (TokenAllocator<T, TOKEN> const&, TokenAllocator<U, TOKEN> const&) { return false; }
+
+
+/*=============================================================
+
+Revision History
+
+Version 0.2.0: 2026-10-18
+Added chunks_allocated().  Free lists are capped per thread.
+
+Version 0.1.0: 2026-10-18
+TokenAllocator counts its allocations by token type when allocation_tracking is enabled.
+
+Version 0.0.0: 2026-10-18
+Alpha release.
+
+=============================================================
+
+Copyright Garth Santor/Trinh Han
+
+The copyright to the computer program(s) herein
+is the property of Garth Santor/Trinh Han of Canada.
+The program(s) may be used and/or copied only with
+the written permission of Garth Santor/Trinh Han
+or in accordance with the terms and conditions
+stipulated in the agreement/contract under which
+the program(s) have been supplied.
+=============================================================*/
+#endif // GUARD_token_allocator_hpp20261018_
@@ -4,8 +4,8 @@
 /** @file: tokenizer.hpp
 	@author Garth Santor/Trinh Han
 	@author http://www.gats.ca/
-	@version 0.1.0
-	@date 2012-11-15
+	@version 0.7.0
+	@date 2026-10-18
 	@note Compiles under Visual C++ v110
 
 	@brief Tokenizer class declaration for Expression Evaulator.
@@ -15,26 +15,35 @@
 	*/
 
 #include "token.hpp"
-#include <map>
+#include "environment.hpp"
+#include "lexeme.hpp"
+#include <memory>
+#include <stdexcept>
 #include <string>
+#include <vector>
 #include <boost/noncopyable.hpp>
+#include <boost/utility/string_view.hpp>
 
 
 /** Tokenizer class is used to create lists of tokens from expression strings.
-	It maintains a dictionary of variable tokens introduced by the expression strings.
+	Variables introduced by the expression strings are bound in its Environment.
+	Keywords come from the process-wide KeywordTable, so constructing a Tokenizer is cheap.
+	Scanning (lex) is separate from token construction (to_tokens): lex() only records the kind,
+	source offset and length of each lexeme, so it allocates nothing per lexeme.
 	*/
 class Tokenizer : boost::noncopyable {
 // types
 public:
 	typedef std::string	string_type;
+	typedef boost::string_view	view_type;
 
 	// Class to throw personalized exceptions
-	class XTokenizer : public std::exception {
+	class XTokenizer : public std::runtime_error {
 		string_type	expression_;
 		size_t		location_;
 	public:
 		XTokenizer(string_type const& expression, size_t location, char const* msg)
-			: std::exception(msg)
+			: std::runtime_error(msg)
 			, expression_( expression )
 			, location_( location )
 		{ }
@@ -74,24 +83,40 @@ public:
 			: XTokenizer(expression, location, "Tokenizer::Factorial must follow Expression.") { }
 	};
 
-// Typedef for a map containing a string as a "keyword" and a Token pointer as its value
-private:
-	using dictionary_type = std::map<string_type, Token::pointer_type>;
-
 // Data
 private:
-	dictionary_type	keywords_;
-	dictionary_type variables_;
+	std::shared_ptr<Environment> environment_;
+	std::vector<Token::pointer_type> ownKeywords_;	// by keyword index: the tokens of the keywords that are not shared
 
 // Methods
 public:
-	// C'tor
-	Tokenizer();
-	TokenList tokenize(string_type const& expression);
+	// C'tors
+	/** Binds variables in a new environment of its own. */
+	Tokenizer() : environment_(std::make_shared<Environment>()) { }
 
-private:
-	Token::pointer_type _get_identifier(Tokenizer::string_type::const_iterator& currentChar, Tokenizer::string_type const& expression);
-	Token::pointer_type _get_number(Tokenizer::string_type::const_iterator& currentChar, Tokenizer::string_type const& expression);
+	/** Binds variables in 'environment', which may be shared with other Tokenizers. */
+	explicit Tokenizer(std::shared_ptr<Environment> environment) : environment_(std::move(environment)) { }
+
+	/** Gets the environment variables are bound in. */
+	std::shared_ptr<Environment> const& get_environment() const { return environment_; }
+
+	/** Tokenizes 'expression', which need not be a std::string (e.g. a line of a memory-mapped file). */
+	TokenList tokenize(view_type expression);
+
+	/** Scans 'expression' into 'out' (cleared first). */
+	void lex(view_type expression, LexemeList& out) const;
+
+	/** Scans 'expression' into a new LexemeList. */
+	LexemeList lex(view_type expression) const { LexemeList out; lex(expression, out); return out; }
+
+	/** Builds the tokens of lexemes scanned from 'expression'. */
+	TokenList to_tokens(LexemeList const& lexemes, view_type expression);
+
+	/** Gets the variable token bound to 'name', creating it if it doesn't exist. */
+	Token::pointer_type get_variable(view_type name) { return environment_->get_variable(name); }
+
+	/** Gets the name a variable token is bound to, or an empty string if it is not one of ours. */
+	string_type find_variable_name(Token::pointer_type const& variable) const { return environment_->find_variable_name(variable); }
 };
 
 
@@ -99,6 +124,24 @@ private:
 
 Revision History
 
+Version 0.7.0: 2026-10-18
+Keywords with a mutable token get a token of this Tokenizer's own.
+
+Version 0.6.0: 2026-10-18
+tokenize() takes a string view.
+
+Version 0.5.0: 2026-10-18
+XTokenizer derives from std::runtime_error (std::exception(const char*) is a Visual C++ extension).
+
+Version 0.4.0: 2026-10-18
+The variable dictionary moved to Environment.
+
+Version 0.3.0: 2026-10-18
+Added lex() and to_tokens() over boost::string_view; variables are found without building a string.
+
+Version 0.2.0: 2026-10-18
+Keywords moved to the shared KeywordTable.
+
 Version 0.1.0: 2012-11-15
 Replaced BadCharacter with XTokenizer, XBadCharacter, and XNumericOverflow
 
@@ -4,8 +4,8 @@
 /** @file: variable.hpp
 	@author Garth Santor/Trinh Han
 	@author http://www.gats.ca/
-	@date 2012-11-13
-	@version 0.1.1
+	@date 2026-10-18
+	@version 0.3.0
 	@note Compiles under Visual C++ v110
 
 	@brief Variable class declaration.
@@ -15,26 +15,43 @@
 	*/
 
 #include "operand.hpp"
+#include <cstddef>
+#include <memory>
 
-/* Variable token class*/
+class VariableStore;
+
+/* Variable token class
+	A variable made by an Environment keeps its value in the environment's VariableStore, so that it
+	can be read and set from several threads.  A variable made on its own keeps its value itself.
+*/
 class Variable : public Operand {
 public:
 	DEF_POINTER_TYPE(Variable)
+	DEF_KIND(VARIABLE)
 		using value_type = Operand::pointer_type;
 private:
-	value_type value_;
+	value_type						value_;		// only used without a store
+	std::shared_ptr<VariableStore>	store_;
+	std::size_t						slot_;
 public:
 	//C'tor
-	Variable(value_type value = nullptr) : value_(value) { }
+	Variable(value_type value = nullptr) : value_(value), slot_(0) { }
+	Variable(std::shared_ptr<VariableStore> store, std::size_t slot) : store_(std::move(store)), slot_(slot) { }
 
-	// Getter method to get the value of the variable
-	value_type get_value() const { return value_; }
+	// Getter method to get the value of the variable (the latest published value if it has a store)
+	value_type get_value() const;
 
 	// Declaration of to_string method
 	string_type to_string() const;
 
-	// Setter method to set the value of the variable
-	void set_value(value_type value) { value_ = value; }
+	// Setter method to set the value of the variable (published to the store if it has one)
+	void set_value(value_type value);
+
+	/** Gets the store holding the variable's value, or nullptr. */
+	VariableStore* get_store() const { return store_.get(); }
+
+	/** Gets the variable's slot in its store. */
+	std::size_t get_slot() const { return slot_; }
 };
 
 
@@ -42,6 +59,11 @@ public:
 
 Revision History
 
+Version 0.3.0: 2026-10-18
+Values of environment variables are kept in a VariableStore.
+
+Version 0.2.0: 2026-10-18
+Added DEF_KIND.
 Version 0.1.1: 2012-11-13
 C++ 11 cleanup
 
@@ -0,0 +1,139 @@
+#if !defined(GUARD_variable_store_hpp20261018_)
+#define GUARD_variable_store_hpp20261018_
+
+/** @file: variable_store.hpp
+	@author Chris Pollock
+	@version 0.1.0
+	@date 2026-10-18
+	@note Compiles under Visual C++ 15.4.4
+
+	@brief VariableStore class declaration and implementation.
+	*/
+
+#include "operand.hpp"
+#include <cstddef>
+#include <atomic>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <utility>
+#include <vector>
+#include <boost/noncopyable.hpp>
+
+
+/** The values of a set of variables, published as immutable snapshots (read-copy-update).
+	A snapshot stays valid (and unchanged) for as long as a reader holds it, and is read without
+	synchronization.  A writer copies the current snapshot, changes the copy, publishes it and then
+	advances the atomic version.  A snapshot is freed when its last reader lets go of it.
+	snapshot() takes a mutex for as long as it takes to copy a shared_ptr.  A Reader keeps the snapshot
+	it last took and only takes it again when the version has moved on, so reading a store that has not
+	changed is one atomic load.
+	Variables are identified by slot (see Environment).
+	*/
+class VariableStore : boost::noncopyable {
+public:
+	using value_type = Operand::pointer_type;
+
+	/** A consistent set of values, indexed by slot. */
+	struct Snapshot {
+		std::uint64_t			version;
+		std::vector<value_type>	values;
+
+		/** Gets the value in 'slot', or an empty pointer if the variable has not been set. */
+		value_type const& value(std::size_t slot) const {
+			static value_type const none;
+			return slot < values.size() ? values[slot] : none;
+		}
+	};
+	using snapshot_pointer = std::shared_ptr<Snapshot const>;
+
+	/** A slot and its new value. */
+	using binding_type = std::pair<std::size_t, value_type>;
+
+	/** The snapshot of a store last seen by one reader (e.g. one RPNEvaluator).  Not shared between threads. */
+	class Reader {
+		std::uint64_t		store_;		// id of the store 'cached_' came from, or 0
+		snapshot_pointer	cached_;
+	public:
+		Reader() : store_(0) { }
+
+		/** Gets the current snapshot of 'store', without locking if it is the one last taken. */
+		snapshot_pointer const&	snapshot(VariableStore const& store) {
+			if (store_ != store.id_ || cached_->version != store.version())
+			{
+				store_ = store.id_;
+				cached_ = store.snapshot();
+			}
+			return cached_;
+		}
+	};
+
+private:
+	std::uint64_t const			id_;		// unique for the life of the process, unlike an address
+	mutable std::mutex			mutex_;		// guards current_
+	snapshot_pointer			current_;
+	std::atomic<std::uint64_t>	version_;	// the version of current_, advanced after it is replaced
+
+	static std::uint64_t next_id() {
+		static std::atomic<std::uint64_t> next(1);
+		return next++;
+	}
+
+public:
+	// C'tor
+	VariableStore() : id_(next_id()), current_(std::make_shared<Snapshot const>(Snapshot{ 0, {} })), version_(0) { }
+
+	/** Gets the current snapshot. */
+	snapshot_pointer	snapshot() const {
+		std::lock_guard<std::mutex> lock(mutex_);
+		return current_;
+	}
+
+	/** Gets the version of the current snapshot. */
+	std::uint64_t		version() const { return version_.load(std::memory_order_acquire); }
+
+	/** Publishes a new value for one slot. */
+	void				publish(std::size_t slot, value_type value) { publish(std::vector<binding_type>{ { slot, std::move(value) } }); }
+
+	/** Publishes new values for several slots as a single version. */
+	void				publish(std::vector<binding_type> const& bindings) {
+		std::lock_guard<std::mutex> lock(mutex_);
+		std::shared_ptr<Snapshot> next = std::make_shared<Snapshot>(*current_);
+		++next->version;
+		for (auto const& binding : bindings)
+		{
+			if (binding.first >= next->values.size())
+				next->values.resize(binding.first + 1);
+			next->values[binding.first] = binding.second;
+		}
+		std::uint64_t const version = next->version;
+		current_ = std::move(next);
+		version_.store(version, std::memory_order_release);
+	}
+};
+
+
+/*=============================================================
+
+Revision History
+
+Version 0.1.0: 2026-10-18
+Added Reader: a cached snapshot, refreshed when the atomic version changes.
+snapshot() takes a mutex instead of std::atomic_load, which libstdc++ implements with a lock anyway.
+
+Version 0.0.0: 2026-10-18
+Alpha release.
+
+=============================================================
+
+Copyright Garth Santor/Trinh Han
+
+The copyright to the computer program(s) herein
+is the property of Garth Santor/Trinh Han of Canada.
+The program(s) may be used and/or copied only with
+the written permission of Garth Santor/Trinh Han
+or in accordance with the terms and conditions
+stipulated in the agreement/contract under which
+the program(s) have been supplied.
+=============================================================*/
+#endif // GUARD_variable_store_hpp20261018_
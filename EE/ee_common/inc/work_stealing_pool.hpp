@@ -0,0 +1,100 @@
+#if !defined(GUARD_work_stealing_pool_hpp20261018_)
+#define GUARD_work_stealing_pool_hpp20261018_
+
+/** @file: work_stealing_pool.hpp
+	@author Chris Pollock
+	@version 0.0.0
+	@date 2026-10-18
+	@note Compiles under Visual C++ 15.4.4
+
+	@brief WorkStealingPool class declaration.
+	*/
+
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <exception>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+#include <boost/noncopyable.hpp>
+
+
+/** A fixed set of worker threads that run the tasks 0..count-1 of a parallel loop.
+	Each worker starts with a contiguous share of the task indices.  A worker takes tasks from the front
+	of its own share and, when that is empty, steals the back half of another worker's share.  A share
+	is a single atomic word, so neither taking nor stealing a task locks.
+	*/
+class WorkStealingPool : boost::noncopyable {
+public:
+	/** A task: called with the task index and the index of the worker running it (0..size()-1). */
+	using task_type = std::function<void(std::size_t task, std::size_t worker)>;
+
+private:
+	// Padded so that no two shares are on the same cache line
+	struct Share {
+		std::atomic<std::uint64_t>	range;		// [first, last) as (first << 32 | last)
+		char						padding[64 - sizeof(std::atomic<std::uint64_t>)];
+	};
+
+	std::vector<std::thread>	threads_;
+	std::unique_ptr<Share[]>	shares_;
+
+	// Start and finish of a run (not on the task path)
+	std::mutex					mutex_;
+	std::condition_variable		start_;
+	std::condition_variable		finish_;
+	std::uint64_t				generation_;
+	std::size_t					running_;
+	bool						stopping_;
+	task_type const*			task_;
+
+	// The exception of the lowest numbered failed task
+	std::mutex					errorMutex_;
+	std::exception_ptr			error_;
+	std::size_t					errorTask_;
+
+public:
+	// C'tor
+	/** Starts 'threads' workers (the hardware concurrency if 0). */
+	explicit WorkStealingPool(std::size_t threads = 0);
+	~WorkStealingPool();
+
+	/** Gets the number of workers. */
+	std::size_t	size() const { return threads_.size(); }
+
+	/** Runs tasks 0..count-1 and waits for them to finish.
+		If tasks throw, the exception of the lowest numbered one is rethrown once every task has run.
+		*/
+	void		run(std::size_t count, task_type const& task);
+
+private:
+	void		work(std::size_t worker);
+	bool		take(std::size_t worker, std::size_t& task);
+	bool		steal(std::size_t worker);
+};
+
+
+/*=============================================================
+
+Revision History
+
+Version 0.0.0: 2026-10-18
+Alpha release.
+
+=============================================================
+
+Copyright Garth Santor/Trinh Han
+
+The copyright to the computer program(s) herein
+is the property of Garth Santor/Trinh Han of Canada.
+The program(s) may be used and/or copied only with
+the written permission of Garth Santor/Trinh Han
+or in accordance with the terms and conditions
+stipulated in the agreement/contract under which
+the program(s) have been supplied.
+=============================================================*/
+#endif // GUARD_work_stealing_pool_hpp20261018_
@@ -1,8 +1,8 @@
 /** @file: RPNEvaluator.cpp
 	@author Garth Santor/Trinh Han
 	@author http://www.gats.ca/
-	@version 0.0.1
-	@date 2012-11-13
+	@version 0.14.0
+	@date 2026-10-18
 	@note Compiles under Visual C++ v110
 
 	@brief RPN Evaluator class implementation.
@@ -17,10 +17,21 @@
 #include "../inc/operator.hpp"
 #include "../inc/token.hpp"
 #include "../inc/boolean.hpp"
+#include "../inc/factorial.hpp"
 #include "../inc/function.hpp"
 #include "../inc/integer.hpp"
+#include "../inc/numeric_conversion.hpp"
 #include "../inc/real.hpp"
 #include "../inc/variable.hpp"
+#include "../inc/variable_store.hpp"
+#include <algorithm>
+#include <array>
+#include <cstdint>
+#include <deque>
+#include <limits>
+#include <map>
+#include <stdexcept>
+#include <string>
 #include <vector>
 #include <memory>		// shared_ptr<>, dynamic_pointer_cast<>()
 
@@ -29,3389 +40,1105 @@ using namespace std;
 using integer = boost::multiprecision::cpp_int;
 using real = boost::multiprecision::cpp_dec_float_50;
 
-// Templated function to calculate the Fibonacci numbers
-template<typename T>
+// Index of a sequence term: the whole part of n, which must fit the term loops' counter
+template <typename T>
+std::uint64_t sequence_index(T const& n) {
+	if (n > T((std::numeric_limits<std::uint32_t>::max)()))
+		throw runtime_error("Error: sequence index too large.");
+	return n.template convert_to<std::uint64_t>();
+}
+
+inline std::uint64_t sequence_index(double n) {
+	if (n > (std::numeric_limits<std::uint32_t>::max)())
+		throw runtime_error("Error: sequence index too large.");
+	return static_cast<std::uint64_t>(n);
+}
+
+// The highest set bit of n, or 0
+inline std::uint64_t highest_bit(std::uint64_t n) {
+	if (n == 0)
+		return 0;
+	std::uint64_t bit = 1;
+	while (bit <= n >> 1)
+		bit <<= 1;
+	return bit;
+}
+
+// Fibonacci by fast doubling: (F(k), F(k+1)) -> (F(2k), F(2k+1)), one bit of n at a time.
+// Uses F(2k) = F(k) * (2F(k+1) - F(k)) and F(2k+1) = F(k)^2 + F(k+1)^2.
+template <typename T>
+T fibonacci_term(std::uint64_t n) {
+	T a = 0, b = 1, t;
+	for (std::uint64_t bit = highest_bit(n); bit != 0; bit >>= 1) {
+		t = b;
+		t *= 2;
+		t -= a;
+		t *= a;			// F(2k)
+		a *= a;
+		b *= b;
+		b += a;			// F(2k+1)
+		a = t;
+		if (n & bit) {
+			a += b;
+			swap(a, b);	// (F(2k+1), F(2k+2))
+		}
+	}
+	return a;
+}
+
+// Pell by powering the symmetric matrix M = [[2,1],[1,0]]: M^k = [[P(k+1), P(k)], [P(k), P(k-1)]].
+// Only (P(k), P(k+1)) is held; squaring gives P(2k) = 2P(k) * (P(k+1) - P(k)) and P(2k+1) = P(k)^2 + P(k+1)^2.
+template <typename T>
+T pell_term(std::uint64_t n) {
+	T a = 0, b = 1, t;
+	for (std::uint64_t bit = highest_bit(n); bit != 0; bit >>= 1) {
+		t = b;
+		t -= a;
+		t *= a;
+		t *= 2;			// P(2k)
+		a *= a;
+		b *= b;
+		b += a;			// P(2k+1)
+		a = t;
+		if (n & bit) {
+			t = b;
+			t *= 2;
+			t += a;		// P(2k+2) = 2P(2k+1) + P(2k)
+			a = b;
+			b = t;
+		}
+	}
+	return a;
+}
+
+// fib(n): 0 and 1 for n <= 1, otherwise F(n+1) (fib(4) = 5)
+template <typename T>
 T ifibonacci(T const& n) {
 	if (n <= 1)
 		return n;
-	T n1 = 1, n2 = 0, next;
-	for (T i = 1; i <= n; ++i) {
-		next = n1 + n2;
-		n2 = n1;
-		n1 = next;
+	return fibonacci_term<T>(sequence_index(n) + 1);
+}
+
+// pel(n): the n'th Pell number (pel(4) = 12), 0 for n < 0
+template <typename T>
+T pell(T const& n) {
+	if (n < 0)
+		return T(0);
+	return pell_term<T>(sequence_index(n));
+}
+
+// syl(n): the n'th term of Sylvester's sequence, s(0) = 2 and s(k+1) = s(k) * (s(k) - 1) + 1, updated in place
+template <typename T>
+T sylvester(T const& n) {
+	T s = 2, t;
+	if (n <= 0)
+		return s;
+	for (std::uint64_t i = sequence_index(n); i != 0; --i) {
+		t = s;
+		t -= 1;
+		s *= t;
+		s += 1;
 	}
-	return next;
-};
-
-// Templated function to calculate the Pell numbers
-template<typename T>
-T pell(T n)
-{
-	// Variables to hold the previous 2 values and the 
-	// calculated result of the pell function
-	T result = 0;
-	T temp1 = 0;
-	T temp2 = 0;
-
-	// For loop to iterate through the algorithm
-	for (int i = 0; i <= n; i++)
+	return s;
+}
+
+
+
+namespace {
+	using operand_stack_type = vector<Operand::pointer_type>;
+	using Instruction = RPNEvaluator::Instruction;
+
+	/** Evaluation state shared by the opcode handlers.
+		Variables of a store are read from one snapshot of it, taken at the first read.
+		*/
+	struct Machine {
+		operand_stack_type						operands;
+		RPNEvaluator::result_list_type const&	results;
+		size_t									forgotten;		// results dropped before results.front()
+		precision_type							precision;
+		VariableStore*							store;
+		VariableStore::snapshot_pointer			snapshot;
+		VariableStore::Reader*					reader;			// takes 'snapshot', if not null
+		operand_stack_type						temporaries;	// values of shared subexpressions
+	};
+
+	/** Opcode handler: pops its arguments from the machine and pushes its result. */
+	using handler_type = void(*)(Machine&, Instruction const&);
+
+	/** Typed implementations, selected by operand kind. */
+	using unary_function_type = Operand::pointer_type(*)(Operand::pointer_type const&);
+	using binary_function_type = Operand::pointer_type(*)(Operand::pointer_type const&, Operand::pointer_type const&);
+
+	using unary_row_type = array<unary_function_type, OPERAND_KIND_COUNT>;
+	using binary_row_type = array<array<binary_function_type, OPERAND_KIND_COUNT>, OPERAND_KIND_COUNT>;
+
+	std::size_t const INTEGER = index_of(operand_kind::INTEGER);
+	std::size_t const REAL = index_of(operand_kind::REAL);
+	std::size_t const BOOLEAN = index_of(operand_kind::BOOLEAN);
+
+
+
+	// Throw the 'cannot perform' error for an operation token
+	[[noreturn]] void cannot_perform(Token::pointer_type const& operation)
 	{
-		if (i == 0)
+		string message = "Error: cannot perform " + operation->to_string();
+		throw runtime_error(message.c_str());
+	}
+
+	// Gets the value of a variable, or the operand itself if it is not an initialized variable
+	Operand::pointer_type value_of(Machine& machine, Operand::pointer_type const& operand)
+	{
+		if (operand->get_kind() != operand_kind::VARIABLE)
+			return operand;
+
+		Variable const& variable = static_cast<Variable const&>(*operand);
+		VariableStore* store = variable.get_store();
+		if (store == nullptr)
 		{
-			temp1 = 0;
-			temp2 = 0;
+			Operand::pointer_type value = variable.get_value();
+			return value ? value : operand;
+		}
+
+		if (store != machine.store)
+		{
+			machine.store = store;
+			machine.snapshot = machine.reader != nullptr ? machine.reader->snapshot(*store) : store->snapshot();
+		}
+		Operand::pointer_type const& value = machine.snapshot->value(variable.get_slot());
+		return value ? value : operand;
+	}
+
+	// Pop the top operand, without looking through variables
+	Operand::pointer_type pop(Machine& machine)
+	{
+		Operand::pointer_type operand = move(machine.operands.back());
+		machine.operands.pop_back();
+		return operand;
+	}
+
+	// Pop the top operand's value (variables are replaced by their values)
+	Operand::pointer_type pop_value(Machine& machine)
+	{
+		Operand::pointer_type operand = value_of(machine, pop(machine));
+		if (operand->get_kind() == operand_kind::VARIABLE)
+			throw runtime_error("Error: variable not initialized.");
+		return operand;
+	}
+
+	// Gets the value of an operand converted to the computation type V
+	template <typename V> V to_value(Integer const& operand) {
+		return operand.is_small() ? numeric_conversion::convert<V>(operand.get_small()) : numeric_conversion::convert<V>(operand.get_value());
+	}
+	template <typename V> V to_value(Real const& operand) { return operand.get_value_as<V>(); }
+	template <typename V> V to_value(Boolean const& operand) { return V(operand.get_value()); }
+
+	// Gets the value of an operand of known kind T, converted to the computation type V
+	template <typename T, typename V>
+	V value_as(Operand::pointer_type const& operand)
+	{
+		return to_value<V>(static_cast<T const&>(*operand));
+	}
+
+
+
+	// Overflow-checked 64-bit arithmetic: false if the result does not fit (it must then be computed as a cpp_int)
+	using small_type = Integer::small_type;
+	small_type const SMALL_MIN = (numeric_limits<small_type>::min)();
+	small_type const SMALL_MAX = (numeric_limits<small_type>::max)();
+
+	bool checked_add(small_type lhs, small_type rhs, small_type& result)
+	{
+#if defined(__GNUC__) || defined(__clang__)
+		return !__builtin_add_overflow(lhs, rhs, &result);
+#else
+		if ((rhs > 0 && lhs > SMALL_MAX - rhs) || (rhs < 0 && lhs < SMALL_MIN - rhs))
+			return false;
+		result = lhs + rhs;
+		return true;
+#endif
+	}
+
+	bool checked_subtract(small_type lhs, small_type rhs, small_type& result)
+	{
+#if defined(__GNUC__) || defined(__clang__)
+		return !__builtin_sub_overflow(lhs, rhs, &result);
+#else
+		if ((rhs < 0 && lhs > SMALL_MAX + rhs) || (rhs > 0 && lhs < SMALL_MIN + rhs))
+			return false;
+		result = lhs - rhs;
+		return true;
+#endif
+	}
+
+	bool checked_multiply(small_type lhs, small_type rhs, small_type& result)
+	{
+#if defined(__GNUC__) || defined(__clang__)
+		return !__builtin_mul_overflow(lhs, rhs, &result);
+#else
+		if (lhs > 0 ? (rhs > 0 ? lhs > SMALL_MAX / rhs : rhs < SMALL_MIN / lhs)
+					: (rhs > 0 ? lhs < SMALL_MIN / rhs : lhs != 0 && rhs < SMALL_MAX / lhs))
+			return false;
+		result = lhs * rhs;
+		return true;
+#endif
+	}
+
+	// Division by zero and MIN / -1 are left to cpp_int
+	bool checked_divide(small_type lhs, small_type rhs, small_type& result)
+	{
+		if (rhs == 0 || (lhs == SMALL_MIN && rhs == -1))
+			return false;
+		result = lhs / rhs;
+		return true;
+	}
+
+	bool checked_modulus(small_type lhs, small_type rhs, small_type& result)
+	{
+		if (rhs == 0 || (lhs == SMALL_MIN && rhs == -1))
+			return false;
+		result = lhs % rhs;
+		return true;
+	}
+
+
+
+	// Operations applicable to both Integer and Real values.
+	// checked() is the 64-bit Integer fast path.
+	struct AddOp {
+		template <typename T> T operator()(T const& lhs, T const& rhs) const { return lhs + rhs; }
+		bool checked(small_type lhs, small_type rhs, small_type& result) const { return checked_add(lhs, rhs, result); }
+	};
+	struct SubtractOp {
+		template <typename T> T operator()(T const& lhs, T const& rhs) const { return lhs - rhs; }
+		bool checked(small_type lhs, small_type rhs, small_type& result) const { return checked_subtract(lhs, rhs, result); }
+	};
+	struct MultiplyOp {
+		template <typename T> T operator()(T const& lhs, T const& rhs) const { return lhs * rhs; }
+		bool checked(small_type lhs, small_type rhs, small_type& result) const { return checked_multiply(lhs, rhs, result); }
+	};
+	struct DivideOp {
+		template <typename T> T operator()(T const& lhs, T const& rhs) const { return lhs / rhs; }
+		bool checked(small_type lhs, small_type rhs, small_type& result) const { return checked_divide(lhs, rhs, result); }
+	};
+	struct ModulusOp {
+		template <typename T> T operator()(T const& lhs, T const& rhs) const { return lhs % rhs; }
+		bool checked(small_type lhs, small_type rhs, small_type& result) const { return checked_modulus(lhs, rhs, result); }
+	};
+	struct MaxOp {
+		template <typename T> T operator()(T const& lhs, T const& rhs) const { return lhs < rhs ? rhs : lhs; }
+		bool checked(small_type lhs, small_type rhs, small_type& result) const { result = (*this)(lhs, rhs); return true; }
+	};
+	struct MinOp {
+		template <typename T> T operator()(T const& lhs, T const& rhs) const { return rhs < lhs ? rhs : lhs; }
+		bool checked(small_type lhs, small_type rhs, small_type& result) const { result = (*this)(lhs, rhs); return true; }
+	};
+	struct PowerOp { template <typename T> T operator()(T const& lhs, T const& rhs) const { using std::pow; return pow(lhs, rhs); } };
+	struct Arctan2Op { template <typename T> T operator()(T const& lhs, T const& rhs) const { using std::atan2; return atan2(lhs, rhs); } };
+
+	// Comparisons, applicable to Integer, Real and Boolean values
+	struct EqualOp { template <typename T> bool operator()(T const& lhs, T const& rhs) const { return lhs == rhs; } };
+	struct NotEqualOp { template <typename T> bool operator()(T const& lhs, T const& rhs) const { return lhs != rhs; } };
+	struct GreaterOp { template <typename T> bool operator()(T const& lhs, T const& rhs) const { return lhs > rhs; } };
+	struct GreaterEqualOp { template <typename T> bool operator()(T const& lhs, T const& rhs) const { return lhs >= rhs; } };
+	struct LessOp { template <typename T> bool operator()(T const& lhs, T const& rhs) const { return lhs < rhs; } };
+	struct LessEqualOp { template <typename T> bool operator()(T const& lhs, T const& rhs) const { return lhs <= rhs; } };
+
+	// Logical operations on Boolean values
+	struct AndOp { bool operator()(bool lhs, bool rhs) const { return lhs && rhs; } };
+	struct NandOp { bool operator()(bool lhs, bool rhs) const { return !(lhs && rhs); } };
+	struct OrOp { bool operator()(bool lhs, bool rhs) const { return lhs || rhs; } };
+	struct NorOp { bool operator()(bool lhs, bool rhs) const { return !(lhs || rhs); } };
+	struct XorOp { bool operator()(bool lhs, bool rhs) const { return lhs != rhs; } };
+	struct XnorOp { bool operator()(bool lhs, bool rhs) const { return lhs == rhs; } };
+
+	// Unary operations
+	struct NegateOp { template <typename T> T operator()(T const& x) const { return -x; } };
+	struct NotOp { bool operator()(bool x) const { return !x; } };
+	struct AbsOp { template <typename T> T operator()(T const& x) const { using std::abs; return abs(x); } };
+	// n! is the product of 2..n (1 when n < 2), computed exactly by product tree.
+	// A multiprecision Real is rounded once from the exact value; a double overflows past 170!,
+	// so it is still multiplied out, in the same order as before.
+	struct FactorialOp {
+		Integer::value_type operator()(Integer::value_type const& n) const {
+			return n < 2 ? Integer::value_type(1) : factorial(sequence_index(n));
 		}
-		else if (i == 1)
+		double operator()(double n) const {
+			double accumulatedFactorial = 1;
+			for (double i = 2; i <= n && accumulatedFactorial != numeric_limits<double>::infinity(); ++i)
+				accumulatedFactorial *= i;
+			return accumulatedFactorial;
+		}
+		template <typename T> T operator()(T const& n) const {
+			return n < 2 ? T(1) : T(factorial(sequence_index(n)));
+		}
+	};
+
+	// Real-valued functions, computed at the precision tier type T
+	struct ArccosFn { template <typename T> T operator()(T const& x) const { using std::acos; return acos(x); } };
+	struct ArcsinFn { template <typename T> T operator()(T const& x) const { using std::asin; return asin(x); } };
+	struct ArctanFn { template <typename T> T operator()(T const& x) const { using std::atan; return atan(x); } };
+	struct CeilFn { template <typename T> T operator()(T const& x) const { using std::ceil; return ceil(x); } };
+	struct CosFn { template <typename T> T operator()(T const& x) const { using std::cos; return cos(x); } };
+	struct ExpFn { template <typename T> T operator()(T const& x) const { using std::exp; return exp(x); } };
+	struct FloorFn { template <typename T> T operator()(T const& x) const { using std::floor; return floor(x); } };
+	struct LbFn { template <typename T> T operator()(T const& x) const { using std::log2; return log2(x); } };
+	struct LnFn { template <typename T> T operator()(T const& x) const { using std::log; return log(x); } };
+	struct LogFn { template <typename T> T operator()(T const& x) const { using std::log10; return log10(x); } };
+	struct SinFn { template <typename T> T operator()(T const& x) const { using std::sin; return sin(x); } };
+	struct SqrtFn { template <typename T> T operator()(T const& x) const { using std::sqrt; return sqrt(x); } };
+	struct TanFn { template <typename T> T operator()(T const& x) const { using std::tan; return tan(x); } };
+
+	// Integer sequences.  A Real argument is truncated to its whole part and the term computed as a Real.
+	struct FibFn {
+		Integer::value_type operator()(Integer::value_type const& n) const { return ifibonacci(n); }
+		template <typename T> T operator()(T const& n) const { using std::floor; return ifibonacci(T(floor(n))); }
+	};
+	struct PelFn {
+		Integer::value_type operator()(Integer::value_type const& n) const { return pell(n); }
+		template <typename T> T operator()(T const& n) const { using std::floor; return pell(T(floor(n))); }
+	};
+	struct SylFn {
+		Integer::value_type operator()(Integer::value_type const& n) const { return sylvester(n); }
+		template <typename T> T operator()(T const& n) const { using std::floor; return sylvester(T(floor(n))); }
+	};
+
+
+
+	/** Apply OP to an operand of kind T, computing in V and producing a RESULT operand. */
+	template <typename OP, typename RESULT, typename V, typename T>
+	Operand::pointer_type unary(Operand::pointer_type const& operand)
+	{
+		return make_operand<RESULT>(OP()(value_as<T, V>(operand)));
+	}
+
+	/** Apply OP to operands of kinds L and R, computing in V and producing a RESULT operand. */
+	template <typename OP, typename RESULT, typename V, typename L, typename R>
+	Operand::pointer_type binary(Operand::pointer_type const& lhs, Operand::pointer_type const& rhs)
+	{
+		return make_operand<RESULT>(OP()(value_as<L, V>(lhs), value_as<R, V>(rhs)));
+	}
+
+	/** Integer OP Integer, in 64 bits when both values are inline and the result fits, otherwise as cpp_int. */
+	template <typename OP>
+	Operand::pointer_type integer_arithmetic(Operand::pointer_type const& lhs, Operand::pointer_type const& rhs)
+	{
+		Integer const& l = static_cast<Integer const&>(*lhs);
+		Integer const& r = static_cast<Integer const&>(*rhs);
+		small_type result;
+		if (l.is_small() && r.is_small() && OP().checked(l.get_small(), r.get_small(), result))
+			return make_operand<Integer>(result);
+		return make_operand<Integer>(OP()(l.get_value(), r.get_value()));
+	}
+
+	/** Integer comparison, in 64 bits when both values are inline. */
+	template <typename OP>
+	Operand::pointer_type integer_relational(Operand::pointer_type const& lhs, Operand::pointer_type const& rhs)
+	{
+		Integer const& l = static_cast<Integer const&>(*lhs);
+		Integer const& r = static_cast<Integer const&>(*rhs);
+		if (l.is_small() && r.is_small())
+			return make_operand<Boolean>(OP()(l.get_small(), r.get_small()));
+		return make_operand<Boolean>(OP()(l.get_value(), r.get_value()));
+	}
+
+	// An Integer power's exponent, which must fit an int
+	int exponent_of(Operand::pointer_type const& operand)
+	{
+		Integer const& exponent = static_cast<Integer const&>(*operand);
+		char const* const error = "Error: exponent out of range.";
+		return exponent.is_small() ? numeric_conversion::narrow<int>(exponent.get_small(), error) : numeric_conversion::narrow<int>(exponent.get_value(), error);
+	}
+
+	Operand::pointer_type same(Operand::pointer_type const& operand)
+	{
+		return operand;
+	}
+
+	// Integer ** Integer: a negative exponent gives a Real
+	template <typename R>
+	Operand::pointer_type power_integer(Operand::pointer_type const& lhs, Operand::pointer_type const& rhs)
+	{
+		using std::pow;
+		int exponent = exponent_of(rhs);
+		if (exponent < 0)
+			return make_operand<Real>(R(pow(value_as<Integer, R>(lhs), exponent)));
+		return make_operand<Integer>(Integer::value_type(pow(static_cast<Integer const&>(*lhs).get_value(), unsigned(exponent))));
+	}
+
+	// Real ** Integer: repeated multiplication
+	template <typename R>
+	Operand::pointer_type power_real_integer(Operand::pointer_type const& lhs, Operand::pointer_type const& rhs)
+	{
+		using std::pow;
+		int exponent = exponent_of(rhs);
+		return make_operand<Real>(R(pow(value_as<Real, R>(lhs), exponent)));
+	}
+
+
+
+	/** Typed implementations of the unary operations, indexed by [opcode][operand kind].
+		There is one table per precision tier; R is the tier's Real computation type.
+		*/
+	using unary_table_type = array<unary_row_type, OPCODE_COUNT>;
+
+	// Integer -> Integer and Real -> Real
+	template <typename OP, typename R>
+	void set_numeric(unary_row_type& row)
+	{
+		row[INTEGER] = &unary<OP, Integer, Integer::value_type, Integer>;
+		row[REAL] = &unary<OP, Real, R, Real>;
+	}
+
+	// Integer or Real -> Real
+	template <typename FN, typename R>
+	void set_real(unary_row_type& row)
+	{
+		row[INTEGER] = &unary<FN, Real, R, Integer>;
+		row[REAL] = &unary<FN, Real, R, Real>;
+	}
+
+	template <typename R>
+	unary_table_type make_unary_table()
+	{
+		unary_table_type table = {};
+
+		table[index_of(opcode_type::IDENTITY)][INTEGER] = &same;
+		table[index_of(opcode_type::IDENTITY)][REAL] = &same;
+		set_numeric<NegateOp, R>(table[index_of(opcode_type::NEGATION)]);
+		table[index_of(opcode_type::NOT)][BOOLEAN] = &unary<NotOp, Boolean, bool, Boolean>;
+		set_numeric<FactorialOp, R>(table[index_of(opcode_type::FACTORIAL)]);
+
+		set_numeric<AbsOp, R>(table[index_of(opcode_type::ABS)]);
+		set_real<ArccosFn, R>(table[index_of(opcode_type::ARCCOS)]);
+		set_real<ArcsinFn, R>(table[index_of(opcode_type::ARCSIN)]);
+		set_real<ArctanFn, R>(table[index_of(opcode_type::ARCTAN)]);
+		set_real<CosFn, R>(table[index_of(opcode_type::COS)]);
+		set_real<ExpFn, R>(table[index_of(opcode_type::EXP)]);
+		set_real<LbFn, R>(table[index_of(opcode_type::LB)]);
+		set_real<LnFn, R>(table[index_of(opcode_type::LN)]);
+		set_real<LogFn, R>(table[index_of(opcode_type::LOG)]);
+		set_real<SinFn, R>(table[index_of(opcode_type::SIN)]);
+		set_real<SqrtFn, R>(table[index_of(opcode_type::SQRT)]);
+		set_real<TanFn, R>(table[index_of(opcode_type::TAN)]);
+
+		// Integers are already whole
+		table[index_of(opcode_type::CEIL)][INTEGER] = &same;
+		table[index_of(opcode_type::CEIL)][REAL] = &unary<CeilFn, Real, R, Real>;
+		table[index_of(opcode_type::FLOOR)][INTEGER] = &same;
+		table[index_of(opcode_type::FLOOR)][REAL] = &unary<FloorFn, Real, R, Real>;
+
+		table[index_of(opcode_type::FIB)][INTEGER] = &unary<FibFn, Integer, Integer::value_type, Integer>;
+		table[index_of(opcode_type::PEL)][INTEGER] = &unary<PelFn, Integer, Integer::value_type, Integer>;
+		table[index_of(opcode_type::SYL)][INTEGER] = &unary<SylFn, Integer, Integer::value_type, Integer>;
+		table[index_of(opcode_type::FIB)][REAL] = &unary<FibFn, Real, R, Real>;
+		table[index_of(opcode_type::PEL)][REAL] = &unary<PelFn, Real, R, Real>;
+		table[index_of(opcode_type::SYL)][REAL] = &unary<SylFn, Real, R, Real>;
+
+		return table;
+	}
+
+	array<unary_table_type, PRECISION_COUNT> const unaryTables = { {
+		make_unary_table<Real::double_type>(),
+		make_unary_table<Real::digits50_type>(),
+		make_unary_table<Real::digits100_type>(),
+		make_unary_table<Real::value_type>()
+	} };
+
+
+
+	/** Typed implementations of the binary operations, indexed by [opcode][lhs kind][rhs kind].
+		There is one table per precision tier; R is the tier's Real computation type.
+		*/
+	using binary_table_type = array<binary_row_type, OPCODE_COUNT>;
+
+	// Integer op Integer is an Integer, any other numeric combination is a Real
+	template <typename OP, typename R>
+	void set_arithmetic(binary_row_type& row)
+	{
+		row[INTEGER][INTEGER] = &integer_arithmetic<OP>;
+		row[INTEGER][REAL] = &binary<OP, Real, R, Integer, Real>;
+		row[REAL][INTEGER] = &binary<OP, Real, R, Real, Integer>;
+		row[REAL][REAL] = &binary<OP, Real, R, Real, Real>;
+	}
+
+	// Numeric operands of any combination give a Real
+	template <typename OP, typename R>
+	void set_real(binary_row_type& row)
+	{
+		row[INTEGER][INTEGER] = &binary<OP, Real, R, Integer, Integer>;
+		row[INTEGER][REAL] = &binary<OP, Real, R, Integer, Real>;
+		row[REAL][INTEGER] = &binary<OP, Real, R, Real, Integer>;
+		row[REAL][REAL] = &binary<OP, Real, R, Real, Real>;
+	}
+
+	// Numbers compare by value (mixed operands as Reals), Booleans with false < true
+	template <typename OP, typename R>
+	void set_relational(binary_row_type& row)
+	{
+		row[INTEGER][INTEGER] = &integer_relational<OP>;
+		row[INTEGER][REAL] = &binary<OP, Boolean, R, Integer, Real>;
+		row[REAL][INTEGER] = &binary<OP, Boolean, R, Real, Integer>;
+		row[REAL][REAL] = &binary<OP, Boolean, R, Real, Real>;
+		row[BOOLEAN][BOOLEAN] = &binary<OP, Boolean, bool, Boolean, Boolean>;
+	}
+
+	template <typename OP>
+	void set_logical(binary_row_type& row)
+	{
+		row[BOOLEAN][BOOLEAN] = &binary<OP, Boolean, bool, Boolean, Boolean>;
+	}
+
+	template <typename R>
+	binary_table_type make_binary_table()
+	{
+		binary_table_type table = {};
+
+		set_arithmetic<AddOp, R>(table[index_of(opcode_type::ADDITION)]);
+		set_arithmetic<SubtractOp, R>(table[index_of(opcode_type::SUBTRACTION)]);
+		set_arithmetic<MultiplyOp, R>(table[index_of(opcode_type::MULTIPLICATION)]);
+		set_arithmetic<DivideOp, R>(table[index_of(opcode_type::DIVISION)]);
+		table[index_of(opcode_type::MODULUS)][INTEGER][INTEGER] = &integer_arithmetic<ModulusOp>;
+
+		for (opcode_type op : { opcode_type::POWER, opcode_type::POW })
 		{
-			temp1 = 1;
+			set_real<PowerOp, R>(table[index_of(op)]);
+			table[index_of(op)][INTEGER][INTEGER] = &power_integer<R>;
+			table[index_of(op)][REAL][INTEGER] = &power_real_integer<R>;
 		}
 
-		result = (temp2 * 2) + temp1;
-		temp1 = temp2;
-		temp2 = result;
+		set_logical<AndOp>(table[index_of(opcode_type::AND)]);
+		set_logical<NandOp>(table[index_of(opcode_type::NAND)]);
+		set_logical<OrOp>(table[index_of(opcode_type::OR)]);
+		set_logical<NorOp>(table[index_of(opcode_type::NOR)]);
+		set_logical<XorOp>(table[index_of(opcode_type::XOR)]);
+		set_logical<XnorOp>(table[index_of(opcode_type::XNOR)]);
+
+		set_relational<EqualOp, R>(table[index_of(opcode_type::EQUALITY)]);
+		set_relational<NotEqualOp, R>(table[index_of(opcode_type::INEQUALITY)]);
+		set_relational<GreaterOp, R>(table[index_of(opcode_type::GREATER)]);
+		set_relational<GreaterEqualOp, R>(table[index_of(opcode_type::GREATER_EQUAL)]);
+		set_relational<LessOp, R>(table[index_of(opcode_type::LESS)]);
+		set_relational<LessEqualOp, R>(table[index_of(opcode_type::LESS_EQUAL)]);
+
+		set_real<Arctan2Op, R>(table[index_of(opcode_type::ARCTAN2)]);
+		set_arithmetic<MaxOp, R>(table[index_of(opcode_type::MAX)]);
+		set_arithmetic<MinOp, R>(table[index_of(opcode_type::MIN)]);
+
+		return table;
+	}
+
+	array<binary_table_type, PRECISION_COUNT> const binaryTables = { {
+		make_binary_table<Real::double_type>(),
+		make_binary_table<Real::digits50_type>(),
+		make_binary_table<Real::digits100_type>(),
+		make_binary_table<Real::value_type>()
+	} };
+
+
+
+	// Push an operand (literal, constant or variable)
+	void do_operand(Machine& machine, Instruction const& instruction)
+	{
+		machine.operands.push_back(static_pointer_cast<Operand>(instruction.token));
+	}
+
+	// Unary operation: one lookup on the operand kind
+	void do_unary(Machine& machine, Instruction const& instruction)
+	{
+		Operand::pointer_type operand = pop_value(machine);
+		unary_function_type fn = unaryTables[index_of(machine.precision)][index_of(instruction.opcode)][index_of(operand->get_kind())];
+		if (fn == nullptr)
+			cannot_perform(instruction.token);
+		machine.operands.push_back(fn(operand));
+	}
+
+	// Binary operation: one lookup on the pair of operand kinds
+	void do_binary(Machine& machine, Instruction const& instruction)
+	{
+		Operand::pointer_type rhs = pop_value(machine);
+		Operand::pointer_type lhs = pop_value(machine);
+		binary_function_type fn = binaryTables[index_of(machine.precision)][index_of(instruction.opcode)][index_of(lhs->get_kind())][index_of(rhs->get_kind())];
+		if (fn == nullptr)
+			cannot_perform(instruction.token);
+		machine.operands.push_back(fn(lhs, rhs));
+	}
+
+	void do_assignment(Machine& machine, Instruction const&)
+	{
+		Operand::pointer_type value = pop_value(machine);
+		Operand::pointer_type variable = pop(machine);
+		if (variable->get_kind() != operand_kind::VARIABLE)
+			throw runtime_error("Error: assignment to a non-variable.");
+		static_cast<Variable&>(*variable).set_value(value);
+		machine.store = nullptr;		// later reads see the assignment
+		machine.operands.push_back(variable);
+	}
+
+	// Keeps a shared subexpression's value (which stays on the stack) for later LOADs
+	void do_store(Machine& machine, Instruction const& instruction)
+	{
+		if (instruction.temporary >= machine.temporaries.size())
+			machine.temporaries.resize(instruction.temporary + 1);
+		machine.temporaries[instruction.temporary] = machine.operands.back();
 	}
-	return result;
-};
-
-template<typename T>
-T sylvester(T n)
-{
-	// Variable to hold the previous results and the current result
-	T results = 2;
-	T slyTemp1;
-	T slyTemp2;
-
-	// For loop to iterate through the algorithm
-	for (int i = 0; i < n; i++)
+
+	void do_load(Machine& machine, Instruction const& instruction)
 	{
-		if (n == 0)
+		machine.operands.push_back(machine.temporaries[instruction.temporary]);
+	}
+
+	// result(n): the n'th (1-based) result evaluated by this evaluator
+	void do_result(Machine& machine, Instruction const& instruction)
+	{
+		Operand::pointer_type operand = pop_value(machine);
+		if (operand->get_kind() != operand_kind::INTEGER)
+			cannot_perform(instruction.token);
+		Integer const& n = static_cast<Integer const&>(*operand);
+		char const* const error = "Error: no such result.";
+		size_t index = n.is_small() ? numeric_conversion::narrow<size_t>(n.get_small(), error) : numeric_conversion::narrow<size_t>(n.get_value(), error);
+		if (index < 1 || index > machine.forgotten + machine.results.size())
+			throw runtime_error(error);
+		if (index <= machine.forgotten)
+			throw runtime_error("Error: result no longer kept.");
+		machine.operands.push_back(machine.results[index - 1 - machine.forgotten]);
+	}
+
+
+
+	using handler_table_type = array<handler_type, OPCODE_COUNT>;
+
+	// Build the dispatch table.  Opcodes without a handler are unsupported.
+	handler_table_type make_handler_table()
+	{
+		handler_table_type table = {};
+
+		table[index_of(opcode_type::OPERAND)] = &do_operand;
+		table[index_of(opcode_type::ASSIGNMENT)] = &do_assignment;
+		table[index_of(opcode_type::RESULT)] = &do_result;
+		table[index_of(opcode_type::LOAD)] = &do_load;
+		table[index_of(opcode_type::STORE)] = &do_store;
+
+		// Everything else is resolved by the type tables (which have the same shape at every precision)
+		for (size_t op = 0; op < OPCODE_COUNT; ++op)
 		{
-			return results;
+			for (auto const& fn : unaryTables[0][op])
+				if (fn != nullptr)
+					table[op] = &do_unary;
+			for (auto const& row : binaryTables[0][op])
+				for (auto const& fn : row)
+					if (fn != nullptr)
+						table[op] = &do_binary;
 		}
 
-		slyTemp1 = results;
-		slyTemp2 = results;
-		results = pow(slyTemp1, 2) - slyTemp2 + 1;
+		return table;
 	}
-	return results;
-}
 
-Operand::pointer_type RPNEvaluator::evaluate(TokenList const& rpnExpression) {
+	handler_table_type const handlers = make_handler_table();
+
 
-	// ***** postfix algorithm code goes here *****
-	std::vector<Token::pointer_type> operands;
-	Integer::value_type evaluatedNumber = 0;
-	Integer::value_type operandNumberFirst = 0;
-	Integer::value_type operandNumberSecond = 0;
-	
-	Real::value_type operandRealNumberFirst = 0.0;
-	Real::value_type operandRealNumberSecond = 0.0;
-	Real::value_type evaluatedRealNumber = 0.0;
-
-	Variable::pointer_type variable = nullptr;
-	Variable::pointer_type secondVariable = nullptr;
-
-	Boolean::pointer_type boolPtr = nullptr;
-	Boolean::pointer_type boolSecondPtr = nullptr;
-
-	bool evaluated = false;
-	bool isReal = false;
-	bool isSecondNum = false;
-	bool isBoolValue = false;
-	bool isSecondBoolValue = false;
-
-	bool boolRealNumberFirst = false;
-	bool boolRealNumberSecond = false;
-	bool boolNumberFirst = false;
-	bool boolNumberSecond = false;
-	bool boolVariables = false;
-
-	bool variableFirst = false;
-	bool variableSecond = false;
-
-	bool firstBool = false;
-	bool secondBool = false;
-
-	if (rpnExpression.size() == 0)
+
+	// Operations whose value depends only on their arguments.  Assignment writes a variable
+	// and result(n) reads the result history, so neither may be computed ahead of time or shared.
+	bool is_pure(opcode_type opcode)
 	{
-		throw exception("Error: insufficient operands");
+		return opcode != opcode_type::ASSIGNMENT && opcode != opcode_type::RESULT
+			&& opcode != opcode_type::LOAD && opcode != opcode_type::STORE;
 	}
 
-	// Loop through the TokenList 
-	for (auto t : rpnExpression)
+
+
+	// The arithmetic an operand takes part in, for EvaluationStats
+	unsigned const BIG_INTEGER_ARITHMETIC = 1;
+	unsigned const REAL_ARITHMETIC = 2;
+
+	unsigned arithmetic_of(Operand const& operand)
 	{
-		// Reset the flags
-		if (evaluated == true)
+		if (operand.get_kind() == operand_kind::REAL)
+			return REAL_ARITHMETIC;
+		if (operand.get_kind() == operand_kind::INTEGER && !static_cast<Integer const&>(operand).is_small())
+			return BIG_INTEGER_ARITHMETIC;
+		return 0;
+	}
+
+	// Executes one instruction, recording the stack depth and the arithmetic of operations in 'stats'
+	void counted(Machine& machine, Instruction const& instruction, EvaluationStats& stats)
+	{
+		bool const operation = instruction.opcode != opcode_type::OPERAND && is_pure(instruction.opcode);
+		unsigned arithmetic = 0;
+		if (operation)
+			for (auto arg = machine.operands.end() - instruction.number_of_args; arg != machine.operands.end(); ++arg)
+				arithmetic |= arithmetic_of(*value_of(machine, *arg));
+
+		handlers[index_of(instruction.opcode)](machine, instruction);
+
+		if (operation)
 		{
-			boolRealNumberFirst = false;
-			boolRealNumberSecond = false;
-			boolNumberFirst = false;
-			boolNumberSecond = false;
-			boolVariables = false;
-			isBoolValue = false;
-			isSecondBoolValue = false;
-			evaluated = false;
+			arithmetic |= arithmetic_of(*value_of(machine, machine.operands.back()));
+			stats.big_integer_operations += (arithmetic & BIG_INTEGER_ARITHMETIC) != 0;
+			stats.real_operations += (arithmetic & REAL_ARITHMETIC) != 0;
 		}
+		stats.peak_stack_depth = max(stats.peak_stack_depth, machine.operands.size());
+	}
 
-		// If token(t) is a operand(Real or Integer) push onto the stack(vector)
-		if (is<Operand>(t))
+
+
+	size_t const NO_TEMPORARY = numeric_limits<size_t>::max();
+
+	// A node of the expression DAG: one per structurally distinct pure subexpression
+	struct DagNode {
+		Instruction		instruction;
+		vector<size_t>	args;
+		bool			pure;
+		size_t			uses;			// parent edges
+		size_t			temporary;		// NO_TEMPORARY until the node is emitted and stored
+	};
+
+	// Emit the program for a node.  A node used more than once is computed the first time and loaded after.
+	// The tree is walked with a stack of its own: an expression can be far deeper than the call stack allows.
+	void emit(vector<DagNode>& nodes, size_t root, RPNEvaluator::program_type& program, size_t& temporaries)
+	{
+		struct Frame {
+			size_t	id;
+			size_t	next;		// the next argument to emit
+		};
+		vector<Frame> frames{ { root, 0 } };
+
+		while (!frames.empty())
 		{
-			if (is<Pi>(t))
+			Frame& frame = frames.back();
+			DagNode& node = nodes[frame.id];
+			if (frame.next == 0 && node.temporary != NO_TEMPORARY)
 			{
-				operands.push_back(make<Pi>());
+				program.push_back({ opcode_type::LOAD, 0, node.instruction.token, node.temporary });
+				frames.pop_back();
 				continue;
 			}
-			else if (is<E>(t))
+
+			if (frame.next < node.args.size())
 			{
-				operands.push_back(make<E>());
+				size_t const arg = node.args[frame.next++];
+				frames.push_back({ arg, 0 });
 				continue;
 			}
-			else
-				operands.push_back(t);
-		}
-		else
-		{
-			// Cast the token to an Operand token
-			Operation::pointer_type operationPtr = dynamic_pointer_cast<Operation>(t);
-
-			// Return the first and second numbers of both the integer and the real numbers back to 0
-			operandNumberFirst = 0;
-			operandNumberSecond = 0;
-			operandRealNumberFirst = 0.0;
-			operandRealNumberSecond = 0.0;
-
-			// Check if the number of arguments whether it is a Unary operator or a Binary operator
-			// is greater than the number of arguments in the operands stack(vector)
-			// If so throw an exception
-			if (operationPtr->number_of_args() > operands.size())
-			{
-				throw exception("Insufficient number of operands for operation");
-			}
+			program.push_back(node.instruction);
 
-			// Loop through the operands stack(vector) to pop off the same number of operands
-			// as the number of arguments needed for the operator
-			for (size_t i = 1; i <= operationPtr->number_of_args(); ++i)
+			// Operands are pushed again; only computed values are worth keeping
+			if (node.uses > 1 && node.instruction.opcode != opcode_type::OPERAND)
 			{
-				// Check the back of the operands stack if it is a real number or a integer
-				// There should only be a maximum of 2 operands used at anyone time in the evaluation
-				if (is<Integer>(operands.back()))
-				{
-					if (i == 1)
-					{
-						// Cast the pointer at the back of the vector to an Integer pointer type
-						Integer::pointer_type intPtr = dynamic_pointer_cast<Integer>(operands.back());
-
-						// Get the numeric value of the pointer
-						operandNumberFirst = intPtr->get_value();
-						boolNumberFirst = true;
-
-						// Pop the pointer off the vector and continue through the loop
-						operands.pop_back();
-						continue;
-					}
-					else if (i == 2)
-					{
-						// If there are two arguments for the operand then there is a second operand. 
-						// Set this flag to true to say there is two operands.
-						isSecondNum = true;
-
-						// Cast the pointer at the back of the vector to an Integer pointer type
-						Integer::pointer_type intPtr = dynamic_pointer_cast<Integer>(operands.back());
-
-						// Get the numeric value of the pointer
-						operandNumberSecond = intPtr->get_value();
-						boolNumberSecond = true;
-
-						// Pop the pointer off the vector and continue through the loop
-						operands.pop_back();
-						continue;
-					}
-				}
-				else if (is<Real>(operands.back()))
-				{
-					isReal = true;
-
-					if (i == 1)
-					{
-						// Cast the pointer at the back of the vector to an Real number pointer type
-						Real::pointer_type realPtr = dynamic_pointer_cast<Real>(operands.back());
-						
-						// Get the numeric value of the pointer
-						operandRealNumberFirst = realPtr->get_value();
-						boolRealNumberFirst = true;
-
-						// Pop the pointer off the vector and continue through the loop
-						operands.pop_back();
-						continue;
-					}
-					else if (i == 2)
-					{
-						// If there are two arguments for the operand then there is a second operand. 
-						// Set this flag to true to say there is two operands.
-						isSecondNum = true;
-
-						// Cast the pointer at the back of the vector to an Real number pointer type
-						Real::pointer_type realPtr = dynamic_pointer_cast<Real>(operands.back());
-
-						// Get the numeric value of the pointer
-						operandRealNumberSecond = realPtr->get_value();
-						boolRealNumberSecond = true;
-
-						// Pop the pointer off the vector and continue through the loop
-						operands.pop_back();
-						continue;
-					}					
-				}
-				else if (is<Boolean>(operands.back()))
-				{
-					// Flag to say that there is a boolean value
-					isBoolValue = true;
-
-					if (i == 1)
-					{
-						// Cast the pointer at the back of the vector to an Boolean pointer type
-						Boolean::pointer_type boolPtr = dynamic_pointer_cast<Boolean>(operands.back());
-
-						// Get the value of the bool (true or false)
-						firstBool = boolPtr->get_value();
-
-						// Pop the pointer off the vector and continue through the loop
-						operands.pop_back();
-						continue;
-					}
-					else if ( i == 2)
-					{
-						// Flag to say that there are two boolean values
-						isSecondBoolValue = true;
-
-						// Cast the pointer at the back of the vector to an Boolean pointer type
-						Boolean::pointer_type boolPtr = dynamic_pointer_cast<Boolean>(operands.back());
-						
-						// Get the value of the bool (true or false)
-						secondBool = boolPtr->get_value();
-
-						// Pop the pointer off the vector and continue through the loop
-						operands.pop_back();
-						continue;
-					}
-				}
-				else if (is<Variable>(operands.back()))
-				{
-					// Flag to say that it is a variable that may be assigned a value
-					boolVariables = true;
-
-					if (i == 1)
-					{
-						// Flag to say which variable is being used
-						variableFirst = true;
-						
-						// Cast the Variable to variable pointer to be able to empty the stack
-						variable = dynamic_pointer_cast<Variable>(operands.back());
-
-						if (Real::pointer_type real = dynamic_pointer_cast<Real>(variable->get_value()))
-						{
-							isReal = true;
-						}
-
-						// Pop the pointer off the vector(stack) and continue through the loop
-						operands.pop_back();
-						continue;
-					}
-					else if (i == 2)
-					{
-						// Flag to say which variable is being used
-						variableSecond = true;
-
-						// Cast the Variable to variable pointer to be able to empty the stack
-						secondVariable = dynamic_pointer_cast<Variable>(operands.back());
-
-						if (Real::pointer_type real = dynamic_pointer_cast<Real>(secondVariable->get_value()))
-						{
-							isReal = true;
-						}
-
-						// Pop the pointer off the vector(stack) and continue through the loop
-						operands.pop_back();
-						continue;
-					}
-				}
+				node.temporary = temporaries++;
+				program.push_back({ opcode_type::STORE, 1, node.instruction.token, node.temporary });
 			}
+			frames.pop_back();
+		}
+	}
+}
 
-			// If Operation is NonAssociative (i.e a Unary Operator)
-			if (is<NonAssociative>(operationPtr))
-			{
-				if (is<Negation>(operationPtr))
-				{
-					if (boolVariables == false)
-					{
-						// If there is more than one operand, the throw an error stating there
-						// are too many operands
-						if (isSecondNum == true || isBoolValue == true)
-							throw exception("Error: too many operands");
-						else
-						{
-							// Check if it is a Real number or not, multiple by -1 for a sign change
-							// then push back onto the operands vector
-							if (isReal == false)
-							{
-								operandNumberFirst *= -1;
-								operands.push_back(make<Integer>(operandNumberFirst));
-								evaluated = true;
-								continue;
-							}
-							else
-							{
-								operandRealNumberFirst *= -1.0;
-								operands.push_back(make<Real>(operandRealNumberFirst));
-								evaluated = true;
-								continue;
-							}
-						}
-					}
-					else if (boolVariables == true)
-					{
-						if (Integer::pointer_type intPtr = dynamic_pointer_cast<Integer>(variable->get_value()))
-						{
-							Integer::value_type newIntPtr = intPtr->get_value() * -1;
-							Token::pointer_type intToken = make<Integer>(newIntPtr);
-							Integer::pointer_type intPtrVariable = dynamic_pointer_cast<Integer>(intToken);
-							Variable::pointer_type newIntVar = dynamic_pointer_cast<Variable>(intToken);
-							newIntVar->set_value(intPtrVariable);
-							operands.push_back(newIntVar);
-							evaluated = true;
-							continue;
-						}
-						else if (Real::pointer_type realPtr = dynamic_pointer_cast<Real>(variable->get_value()))
-						{
-							Real::value_type newRealPtr = realPtr->get_value() * -1;
-							Token::pointer_type realToken = make<Real>(newRealPtr);
-							Real::pointer_type realPtrVariable = dynamic_pointer_cast<Real>(realToken);
-							Variable::pointer_type newRealVar = dynamic_pointer_cast<Variable>(realToken);
-							newRealVar->set_value(realPtrVariable);
-							operands.push_back(newRealVar);
-							evaluated = true;
-							continue;
-						}
-					}
-				}
-				else if (is<Identity>(operationPtr))
-				{
-					// Check if it is a Real number or not, then push back onto the operands vector
-					if (isReal == false)
-					{
-						operands.push_back(make<Integer>(operandNumberFirst));
-						evaluated = true;
-						continue;
-					}
-					else
-					{
-						operands.push_back(make<Real>(operandRealNumberFirst));
-						evaluated = true;
-						continue;
-					}
-				}
-				else if (is<Not>(operationPtr))
-				{
-					//Variable::pointer_type newVariable = nullptr;
-					// Check that there is only bool value to operate on
-					if (isSecondBoolValue == true)
-					{
-						throw exception("Error: too many operands");
-					}
-					else
-					{
-						// Check to see if there is a bool, or numeric value to operate on
-						// If it is a bool value, then change the value to the opposite of its
-						// current value. If it is a numeric value greater than 0, then the value
-						// will be changed to 0, otherwise if the value is 0, then the value will 
-						// be changed to the value of 1 for Integer or 1.0 for Real
-						if (isBoolValue == true && firstBool == false)
-						{
-							firstBool = true;
-							operands.push_back(make<Boolean>(firstBool));
-							evaluated = true;
-							continue;
-						}
-						else if (isBoolValue == true && firstBool == true)
-						{
-							firstBool = false;
-							operands.push_back(make<Boolean>(firstBool));
-							evaluated = true;
-							continue;
-						}
-						else if (boolVariables == true)
-						{
-							Boolean::pointer_type boolPtr = dynamic_pointer_cast<Boolean>(variable->get_value());
-							if (boolPtr->get_value() == true)
-							{
-								// Convert value to a token pointer, make a New variable token pointer which will then take 
-								// the value of the first token pointer you have converted and sets the New variable token
-								// pointer value to the pointer type that you have converted to.
-								Token::pointer_type boolToken = make<Boolean>(false);
-								Boolean::pointer_type newBoolValue = dynamic_pointer_cast<Boolean>(boolToken);
-								Token::pointer_type newVar = make<Variable>();
-								Variable::pointer_type newVariable = dynamic_pointer_cast<Variable>(newVar);
-								newVariable->set_value(newBoolValue);
-								operands.push_back(newVariable);
-								evaluated = true;
-								continue;
-							}
-							else if (boolPtr->get_value() == false)
-							{
-								// Convert value to a token pointer, make a New variable token pointer which will then take 
-								// the value of the first token pointer you have converted and sets the New variable token
-								// pointer value to the pointer type that you have converted to.
-								Token::pointer_type boolToken = make<Boolean>(true);
-								Boolean::pointer_type newBoolValue = dynamic_pointer_cast<Boolean>(boolToken);
-								Token::pointer_type newVar = make<Variable>();
-								Variable::pointer_type newVariable = dynamic_pointer_cast<Variable>(newVar);
-								newVariable->set_value(newBoolValue);
-								operands.push_back(newVariable);
-								evaluated = true;
-								continue;
-							}
-						}			
-					}
-				}
-				else if (is<PostfixOperator>(operationPtr) || is<Factorial>(operationPtr))
+
+
+/** Lower an RPN token list to a program of opcodes.
+	@return the program.
+	@param rpnExpression [in] the tokens in postfix order.
+	@note Throws if the list contains an operation the evaluator does not support.
+	*/
+RPNEvaluator::program_type RPNEvaluator::compile(TokenList const& rpnExpression) const {
+	program_type program;
+	program.reserve(rpnExpression.size());
+
+	for (auto const& t : rpnExpression)
+	{
+		if (is<Operand>(t))
+		{
+			// Real literals and constants are held at the evaluator's precision
+			if (Real::pointer_type real = dynamic_pointer_cast<Real>(t))
+				if (real->get_precision() != precision_)
 				{
-					// Check that there are not two operands for the postfix(factorial) to operate on
-					if (isSecondNum == true)
-					{
-						throw exception("Error: too many operands");
-					}
-					if (boolVariables == false)
-					{
-						if (isReal == false)
-						{
-							// Factorial Calculation for an Integer. It uses the operandNumberFirst variable
-							// to tell the loop how many times to iterate through the loop.
-							Integer::value_type accumlatedFactorial = 1;
-							for (Integer::value_type i = 2; i <= operandNumberFirst; ++i)
-								accumlatedFactorial *= i;
-
-							// Push the calculated factorial onto the vector
-							operands.push_back(make<Integer>(accumlatedFactorial));
-							evaluated = true;
-							continue;
-						}
-						else if (isReal == true)
-						{
-							// Factorial Calculation for a Real numberr. It uses the operandRealNumberFirst variable
-							// to tell the loop how many times to iterate through the loop.
-							Real::value_type accumlatedRealFactorial = 1.0;
-							for (Real::value_type i = 2.0; i <= operandRealNumberFirst; ++i)
-								accumlatedRealFactorial *= i;
-
-							// Push the calculated factorial onto the vector
-							operands.push_back(make<Real>(accumlatedRealFactorial));
-							evaluated = true;
-							continue;
-						}
-					}
-					else if (boolVariables == true)
-					{
-						if (Integer::pointer_type intPtr = dynamic_pointer_cast<Integer>(variable->get_value()))
-						{
-							Integer::value_type newIntPtr = intPtr->get_value();
-
-							// Factorial Calculation for an Integer. It uses the operandNumberFirst variable
-							// to tell the loop how many times to iterate through the loop.
-							Integer::value_type accumlatedFactorial = 1;
-							for (Integer::value_type i = 2; i <= newIntPtr; ++i)
-								accumlatedFactorial *= i;
-
-							// Convert value to a token pointer, make a New variable token pointer which will then take 
-								// the value of the first token pointer you have converted and sets the New variable token
-								// pointer value to the pointer type that you have converted to.
-							Token::pointer_type intToken = make<Integer>(accumlatedFactorial);
-							Integer::pointer_type intPtrVariable = dynamic_pointer_cast<Integer>(intToken);
-							Variable::pointer_type newIntVar = dynamic_pointer_cast<Variable>(intToken);
-							newIntVar->set_value(intPtrVariable);
-							operands.push_back(newIntVar);
-							evaluated = true;
-							continue;
-						}
-						else if (Real::pointer_type realPtr = dynamic_pointer_cast<Real>(variable->get_value()))
-						{
-							Real::value_type newRealPtr = realPtr->get_value();
-
-							// Factorial Calculation for a Real numberr. It uses the operandRealNumberFirst variable
-							// to tell the loop how many times to iterate through the loop.
-							Real::value_type accumlatedRealFactorial = 1.0;
-							for (Real::value_type i = 2.0; i <= newRealPtr; ++i)
-								accumlatedRealFactorial *= i;
-
-							// Convert value to a token pointer, make a New variable token pointer which will then take 
-								// the value of the first token pointer you have converted and sets the New variable token
-								// pointer value to the pointer type that you have converted to.
-							Token::pointer_type realToken = make<Real>(accumlatedRealFactorial);
-							Real::pointer_type realPtrVariable = dynamic_pointer_cast<Real>(realToken);
-							Variable::pointer_type newRealVar = dynamic_pointer_cast<Variable>(realToken);
-							newRealVar->set_value(realPtrVariable);
-							operands.push_back(newRealVar);
-							evaluated = true;
-							continue;
-						}
-					}
+					program.push_back({ opcode_type::OPERAND, 0, real->to_precision(precision_), 0 });
+					continue;
 				}
+			program.push_back({ opcode_type::OPERAND, 0, t, 0 });
+			continue;
+		}
+
+		Operation::pointer_type operationPtr = dynamic_pointer_cast<Operation>(t);
+		if (operationPtr == nullptr || handlers[index_of(operationPtr->get_opcode())] == nullptr)
+			cannot_perform(t);
+
+		program.push_back({ operationPtr->get_opcode(), operationPtr->number_of_args(), t, 0 });
+	}
+
+	return program;
+}
+
+
+
+/** Fold constant subexpressions.
+	@return the program with every pure operation over literal operands replaced by its value.
+	@param program [in] a program lowered by compile().
+	@note Folding runs at the evaluator's precision, the same precision compile() converted the literals to.
+	*/
+RPNEvaluator::program_type RPNEvaluator::fold(program_type const& program) const {
+	// For each value on the simulated stack: where its subprogram starts and whether it is a literal
+	struct Value {
+		size_t	start;
+		bool	constant;
+	};
+	vector<Value> values;
+	values.reserve(program.size());
+
+	program_type folded;
+	folded.reserve(program.size());
+	result_list_type noResults;
+
+	for (auto it = program.begin(); it != program.end(); ++it)
+	{
+		Instruction const& instruction = *it;
+		if (instruction.opcode == opcode_type::OPERAND)
+		{
+			values.push_back({ folded.size(), static_cast<Operand const&>(*instruction.token).get_kind() != operand_kind::VARIABLE });
+			folded.push_back(instruction);
+			continue;
+		}
+
+		// A malformed program is left as it is for execute() to report
+		if (instruction.number_of_args > values.size())
+		{
+			folded.insert(folded.end(), it, program.end());
+			break;
+		}
+
+		auto first = values.end() - instruction.number_of_args;
+		Value value{ first == values.end() ? folded.size() : first->start, is_pure(instruction.opcode) };
+		for (auto arg = first; arg != values.end(); ++arg)
+			value.constant = value.constant && arg->constant;
+		values.erase(first, values.end());
+		folded.push_back(instruction);
+
+		if (value.constant)
+		{
+			// The arguments are already folded, so this runs the one operation on literals
+			Machine machine{ operand_stack_type(), noResults, 0, precision_, nullptr, nullptr, nullptr, operand_stack_type() };
+			try {
+				for (auto i = folded.begin() + value.start; i != folded.end(); ++i)
+					handlers[index_of(i->opcode)](machine, *i);
+				Operand::pointer_type literal = machine.operands.back();
+				folded.erase(folded.begin() + value.start, folded.end());
+				folded.push_back({ opcode_type::OPERAND, 0, literal, 0 });
+			}
+			catch (std::exception&) {
+				value.constant = false;		// e.g. division by zero: reported when the program runs
 			}
+		}
+		values.push_back(value);
+	}
 
-			// Check if operation is a Binary operator
-			if (is<BinaryOperator>(operationPtr))
-			{
-				// Check if the operator is the Power operation (2^4) = 16
-				if (is<Power>(operationPtr))
-				{
-					// Variables to hold the lexical cast numbers
-					Real::value_type resultRealPower;
-					Real::value_type valueRealFirst;
-					Real::value_type valueRealSecond;
-
-					Integer::value_type resultIntegerPower;
-					Integer::value_type valueIntegerFirst;
-					Integer::value_type valueIntegerSecond;
-
-					// Check to see if the operands are only Integers
-					if (isReal == false)
-					{
-						// Variables to hold the result of the pow operations, and to convert(lexical_cast) the
-						// operand numbers to be able to use the pow() function;					
-						int powerNumber = boost::lexical_cast<int>(operandNumberFirst);
-
-						if (powerNumber < 0)
-						{
-							// Cast the base number to a Real number because if the exponent number(powerNum) is
-							// a negative number then the result will be a Real number
-							valueRealSecond = boost::lexical_cast<Real::value_type>(operandNumberSecond);
-							Token::pointer_type realNumber = make<Real>(valueRealSecond);
-							valueRealSecond = get_value<Real>(realNumber);
-
-							resultRealPower = boost::multiprecision::pow(valueRealSecond, powerNumber);
-
-							// Push the real number result onto the operand stack(vector)
-							operands.push_back(make<Real>(resultRealPower));
-							evaluated = true;
-							continue;
-						}
-						else if (powerNumber > 0)
-						{
-							// Calculate the power
-							resultIntegerPower = boost::multiprecision::pow(operandNumberSecond, powerNumber);
-							
-							// Push the integer Result onto the operand stack(vector)
-							operands.push_back(make<Integer>(resultIntegerPower));
-							evaluated = true;
-							continue;
-						}
-						else if (powerNumber == 0)
-						{
-							// Push the integer Result onto the operand stack(vector)
-							operands.push_back(make<Integer>(1));
-							evaluated = true;
-							continue;
-						}
-					}
-					else if (isReal == true)
-					{
-
-						if (boolRealNumberFirst == true && boolNumberSecond == true)
-						{
-							// Variables to hold the result of the pow operations, and to convert(lexical_cast) the
-							// operand numbers to be able to use the pow() function;
-							int powerNumber = boost::lexical_cast<int>(operandRealNumberFirst);
-
-							valueRealFirst = boost::lexical_cast<Real::value_type>(operandNumberSecond);
-							Token::pointer_type realNumber = make<Real>(valueRealFirst);
-							valueRealFirst = get_value<Real>(realNumber);
-
-							Real::value_type realResult = boost::multiprecision::pow(valueRealFirst, powerNumber);
-
-							// Push the result onto the operands stack(vector)
-							operands.push_back(make<Real>(realResult));
-							evaluated = true;
-							continue;
-						}
-						else if (boolNumberFirst == true && boolRealNumberSecond == true)
-						{
-							// Variables to hold the result of the pow operations, and to convert(lexical_cast) the
-							// operand numbers to be able to use the pow() function;
-							int powerNumber = boost::lexical_cast<int>(operandNumberFirst);
-
-							Real::value_type realResult = pow(operandRealNumberSecond, powerNumber);
-
-							// Push the result onto the operands stack(vector)
-							operands.push_back(make<Real>(realResult));
-							evaluated = true;
-							continue;
-						}
-						else if (boolRealNumberSecond == true && boolRealNumberFirst == true)
-						{
-							// Get the result of the power of 2 real numbers
-							Real::value_type realResult = boost::multiprecision::pow(operandRealNumberSecond, operandRealNumberFirst);
-
-							// Push the result onto the operands stack(vector)
-							operands.push_back(make<Real>(realResult));
-							evaluated = true;
-							continue;
-						}
-						else
-						{
-							// Variables to hold the result of the pow operations, and to convert(lexical_cast) the
-							// operand numbers to be able to use the pow() function;
-							int powerNumber = boost::lexical_cast<int>(operandRealNumberFirst);
-
-							Real::value_type realResult = pow(operandRealNumberSecond, powerNumber);
-
-							// Push the result onto the operands stack(vector)
-							operands.push_back(make<Real>(realResult));
-							evaluated = true;
-							continue;
-						}
-					}
-				}
+	return folded;
+}
 
-				if (is<Assignment>(operationPtr))
-				{
-					if ((boolNumberFirst == true || boolRealNumberFirst == true  ) && 
-						(boolNumberSecond == true || boolRealNumberSecond == true))
-					{
-						throw exception("Error: Cannot assign to a literal value.");
-					}
-
-					if (boolVariables == true)
-					{
-						if (boolNumberFirst == true)
-						{
-							// Convert the operand value to a Token pointer, then to an Integer value
-							Token::pointer_type operandToken = make<Integer>(operandNumberFirst);
-							Integer::pointer_type integerVariable = dynamic_pointer_cast<Integer>(operandToken);
-
-							// Set the variable Variable::pointer_type value to an Integer::pointer_type, because the 
-							// value of the Variable::pointer_type is a Operand::pointer_type
-							if (variableFirst == true)
-							{
-								variable->set_value(integerVariable);
-
-								// Push it onto the operands stack(vector)
-								operands.push_back(variable);
-							}
-							else if (variableSecond == true)
-							{
-								secondVariable->set_value(integerVariable);
-
-								// Push it onto the operands stack(vector)
-								operands.push_back(secondVariable);
-							}
-							continue;
-						}
-						else if (boolRealNumberFirst == true)
-						{
-							// Convert the operand value to a Token pointer, then to an Real number value
-							Token::pointer_type operandToken = make<Real>(operandRealNumberFirst);
-							Real::pointer_type realVariable = dynamic_pointer_cast<Real>(operandToken);
-
-							// Set the variable Variable::pointer_type value to an Real::pointer_type, because the 
-							// value of the Variable::pointer_type is a Operand::pointer_type
-							if (variableFirst == true)
-							{
-								variable->set_value(realVariable);
-
-								// Push it onto the operands stack(vector)
-								operands.push_back(variable);
-							}
-							else if (variableSecond == true)
-							{
-								secondVariable->set_value(realVariable);
-
-								// Push it onto the operands stack(vector)
-								operands.push_back(secondVariable);
-							}
-							continue;
-						}
-						else if (isBoolValue == true)
-						{
-							// Convert the operand value to a Token pointer, then to an Boolean value
-							Token::pointer_type operandToken = make<Boolean>(firstBool);
-							Boolean::pointer_type booleanVariable = dynamic_pointer_cast<Boolean>(operandToken);
-
-							// Set the variable Variable::pointer_type value to an Boolean::pointer_type, because the 
-							// value of the Variable::pointer_type is a Operand::pointer_type
-							if (variableFirst == true)
-							{
-								variable->set_value(booleanVariable);
-
-								// Push it onto the operands stack(vector)
-								operands.push_back(variable);
-							}
-							else if (variableSecond == true)
-							{
-								secondVariable->set_value(booleanVariable);
-
-								// Push it onto the operands stack(vector)
-								operands.push_back(secondVariable);
-							}
-							continue;
-						}
-					}
-					else if (!boolVariables && (boolNumberFirst == true || boolRealNumberFirst == true || isBoolValue == true))
-					{
-						throw exception("Error: assignment to a non-variable.");
-					}
-				}
 
-				if (is<Multiplicative>(operationPtr))
-				{
-					// If operator is multiplication, perform the operation one the operands
-					if (is<Multiplication>(operationPtr))
-					{
-						if ((boolNumberFirst == true||boolRealNumberFirst == true || variableFirst == true) &&
-							(boolNumberSecond == false && boolRealNumberSecond == false && variableSecond == false))
-						{
-							throw exception("Error: Not enough operands.");
-						}
-						
-						if (boolVariables == false)
-						{
-							// If the operands are both Integer's perform the multiplication on it and push the product
-							// onto the stack(vector)
-							if (isReal == false)
-							{
-								Integer::value_type product = operandNumberFirst * operandNumberSecond;
-								operands.push_back(make<Integer>(product));
-								evaluated = true;
-								continue;
-							}
-							else if (isReal == true)
-							{
-								// Variables to hold the real number values
-								Real::value_type productReal;
-								Real::value_type valueFirst;
-								Real::value_type valueSecond;
-
-								if (boolRealNumberFirst == true && boolNumberSecond == true)
-								{
-									// Variables to hold the result of the pow operations, and to convert(lexical_cast) the
-									// operand numbers to be able to use the multiply								
-									valueSecond = boost::lexical_cast<Real::value_type>(operandNumberSecond);
-									Token::pointer_type realNumber = make<Real>(valueSecond);
-									valueSecond = get_value<Real>(realNumber);
-
-									productReal = valueSecond * operandRealNumberFirst;
-
-									// Push the result onto the operands stack(vector)
-									operands.push_back(make<Real>(productReal));
-									evaluated = true;
-									continue;
-								}
-								else if (boolNumberFirst == true && boolRealNumberSecond == true)
-								{
-									// Variables to hold the result of the pow operations, and to convert(lexical_cast) the
-									// operand numbers to be able to multiply
-									valueFirst = boost::lexical_cast<Real::value_type>(operandNumberFirst);
-									Token::pointer_type realNumber = make<Real>(valueFirst);
-									valueFirst = get_value<Real>(realNumber);
-
-									productReal = valueFirst * operandRealNumberSecond;
-
-									// Push the result onto the operands stack(vector)
-									operands.push_back(make<Real>(productReal));
-									evaluated = true;
-									continue;
-								}
-								else
-								{
-									// Variables to hold the result of the pow operations, and to convert(lexical_cast) the
-									// operand numbers to be able to multiply
-									productReal = operandRealNumberSecond * operandRealNumberFirst;
-
-									// Push the result onto the operands stack(vector)
-									operands.push_back(make<Real>(productReal));
-									evaluated = true;
-									continue;
-								}
-							}
-						}
-						else if (boolVariables == true)
-						{
-							if (isReal == false )
-							{ //*****
-								if (boolNumberFirst == true && variableSecond == true)
-								{
-									Integer::pointer_type integerPtr = dynamic_pointer_cast<Integer>(secondVariable->get_value());
-									Integer::value_type product = operandNumberFirst * integerPtr->get_value();
-									operands.push_back(make<Integer>(product));
-									evaluated = true;
-									continue;
-								}
-								else if (boolNumberSecond == true && variableFirst == true)
-								{
-									Integer::pointer_type integerPtr = dynamic_pointer_cast<Integer>(variable->get_value());
-									Integer::value_type product = operandNumberSecond * integerPtr->get_value();
-									operands.push_back(make<Integer>(product));
-									evaluated = true;
-									continue;
-								}
-							}
-							else if (isReal == true)
-							{
-								// Variables to hold the real number values
-								Real::value_type product;
-
-								if ((boolRealNumberFirst == true || boolNumberFirst == true) && variableSecond == true)
-								{
-									// Variables to hold the result of the pow operations, and to convert(lexical_cast) the
-									// operand numbers to be able to use the multiply								
-									Real::pointer_type realPtr = dynamic_pointer_cast<Real>(secondVariable->get_value());
-
-									// If both oerands are real numbers than just multiply, else if one is a integer
-									// and one is a real convert the integer to a real number
-									if(boolRealNumberFirst == true)
-										product = operandRealNumberFirst * realPtr->get_value();
-									else if (boolNumberFirst == true)
-									{
-										Real::value_type valueFirst = boost::lexical_cast<Real::value_type>(operandNumberFirst);
-										Token::pointer_type realNumber = make<Real>(valueFirst);
-										valueFirst = get_value<Real>(realNumber);
-										product = valueFirst * realPtr->get_value();
-									}
-
-									// Push the result onto the operands stack(vector)
-									operands.push_back(make<Real>(product));
-									evaluated = true;
-									continue;
-								}
-								else if (variableFirst == true && (boolRealNumberSecond == true || boolNumberSecond== true))
-								{
-									// Variables to hold the result of the pow operations, and to convert(lexical_cast) the
-									// operand numbers to be able to multiply
-									Real::pointer_type realPtr = dynamic_pointer_cast<Real>(variable->get_value());
-
-
-									// If both oerands are real numbers than just multiply, else if one is a integer
-									// and one is a real convert the integer to a real number
-									if (boolRealNumberSecond == true)
-										product = operandRealNumberSecond * realPtr->get_value();
-									else if (boolNumberSecond == true)
-									{
-										Real::value_type valueSecond = boost::lexical_cast<Real::value_type>(operandNumberSecond);
-										Token::pointer_type realNumber = make<Real>(valueSecond);
-										valueSecond = get_value<Real>(realNumber);
-										product = valueSecond * realPtr->get_value();
-									}
-
-									// Push the result onto the operands stack(vector)
-									operands.push_back(make<Real>(product));
-									evaluated = true;
-									continue;
-								}
-								else
-								{
-									// Variables to hold the result of the pow operations, and to convert(lexical_cast) the
-									// operand numbers to be able to multiply
-									Real::pointer_type realPtr = dynamic_pointer_cast<Real>(variable->get_value());
-									Real::pointer_type realPtrSecond = dynamic_pointer_cast<Real>(secondVariable->get_value());
-									Real::value_type product = realPtrSecond->get_value() * realPtr->get_value();
-
-									// Push the result onto the operands stack(vector)
-									operands.push_back(make<Real>(product));
-									evaluated = true;
-									continue;
-								}
-							}
-						}
-					}
-					
-					// If operator is divison, perform the operation on the operands
-					if (is<Division>(operationPtr))
-					{
-						if ((boolNumberFirst == true || boolRealNumberFirst == true || variableFirst == true) &&
-							(boolNumberSecond == false && boolRealNumberSecond == false && variableSecond == false))
-						{
-							throw exception("Error: Not enough operands.");
-						}
-						if (boolVariables == false)
-						{
-							// If the operands are both Integer's perform the divison on it and push the quotient
-							// onto the stack(vector)
-							if (isReal == false)
-							{
-								Integer::value_type quotient = operandNumberSecond / operandNumberFirst;
-								operands.push_back(make<Integer>(quotient));
-								continue;
-							}
-							else if (isReal == true)
-							{
-								// Variables to hold the real number values
-								Real::value_type valueFirst;
-								Real::value_type valueSecond;
-								Real::value_type quotientReal;
-
-								if (boolRealNumberFirst == true && boolNumberSecond == true)
-								{
-									// Variables to hold the result of the divison operations, and to convert(lexical_cast) the
-									// operand numbers to be able to use divison;
-									valueSecond = boost::lexical_cast<Real::value_type>(operandNumberSecond);
-									Token::pointer_type realNumber = make<Real>(valueSecond);
-									valueSecond = get_value<Real>(realNumber);
-
-									quotientReal = valueSecond / operandRealNumberFirst;
-
-									// Push the result onto the operands stack(vector)
-									operands.push_back(make<Real>(quotientReal));
-									continue;
-								}
-								else if (boolNumberFirst == true && boolRealNumberSecond == true)
-								{
-									// Variables to hold the result of the divison operations, and to convert(lexical_cast) the
-									// operand numbers to be able to use divison;
-									valueFirst = boost::lexical_cast<Real::value_type>(operandNumberFirst);
-									Token::pointer_type realNumber = make<Real>(valueFirst);
-									valueFirst = get_value<Real>(realNumber);
-
-									quotientReal = operandRealNumberSecond / valueFirst;
-
-									// Push the result onto the operands stack(vector)
-									operands.push_back(make<Real>(quotientReal));
-									continue;
-								}
-								else
-								{
-									// Variables to hold the result of the divison operations, and to convert(lexical_cast) the
-									// operand numbers to be able to divison;
-									quotientReal = operandRealNumberSecond / operandRealNumberFirst;
-
-									// Push the result onto the operands stack(vector)
-									operands.push_back(make<Real>(quotientReal));
-									continue;
-								}
-							}
-						}
-						else if (boolVariables == true)
-						{
-							if (isReal == false)
-							{ //*****
-								if (boolNumberFirst == true && variableSecond == true)
-								{
-									Integer::pointer_type integerPtr = dynamic_pointer_cast<Integer>(secondVariable->get_value());
-									Integer::value_type product = integerPtr->get_value() / operandNumberFirst;
-									operands.push_back(make<Integer>(product));
-									evaluated = true;
-									continue;
-								}
-								else if (boolNumberSecond == true && variableFirst == true)
-								{
-									Integer::pointer_type integerPtr = dynamic_pointer_cast<Integer>(variable->get_value());
-									Integer::value_type product = operandNumberSecond / integerPtr->get_value();
-									operands.push_back(make<Integer>(product));
-									evaluated = true;
-									continue;
-								}
-							}
-							else if (isReal == true)
-							{
-								// Variables to hold the real number values
-								Real::value_type product;
-
-								if ((boolRealNumberFirst == true || boolNumberFirst == true) && variableSecond == true)
-								{
-									// Variables to hold the result of the pow operations, and to convert(lexical_cast) the
-									// operand numbers to be able to use the multiply								
-									Real::pointer_type realPtr = dynamic_pointer_cast<Real>(secondVariable->get_value());
-
-									// If both oerands are real numbers than just multiply, else if one is a integer
-									// and one is a real convert the integer to a real number
-									if (boolRealNumberFirst == true)
-										product = realPtr->get_value() / operandRealNumberFirst;
-									else if (boolNumberFirst == true)
-									{
-										Real::value_type valueFirst = boost::lexical_cast<Real::value_type>(operandNumberFirst);
-										Token::pointer_type realNumber = make<Real>(valueFirst);
-										valueFirst = get_value<Real>(realNumber);
-										product = realPtr->get_value() / valueFirst;
-									}
-
-									// Push the result onto the operands stack(vector)
-									operands.push_back(make<Real>(product));
-									evaluated = true;
-									continue;
-								}
-								else if (variableFirst == true && (boolRealNumberSecond == true || boolNumberSecond == true))
-								{
-									// Variables to hold the result of the pow operations, and to convert(lexical_cast) the
-									// operand numbers to be able to multiply
-									Real::pointer_type realPtr = dynamic_pointer_cast<Real>(variable->get_value());
-
-
-									// If both oerands are real numbers than just multiply, else if one is a integer
-									// and one is a real convert the integer to a real number
-									if (boolRealNumberSecond == true)
-										product = operandRealNumberSecond * realPtr->get_value();
-									else if (boolNumberSecond == true)
-									{
-										Real::value_type valueSecond = boost::lexical_cast<Real::value_type>(operandNumberSecond);
-										Token::pointer_type realNumber = make<Real>(valueSecond);
-										valueSecond = get_value<Real>(realNumber);
-										product = valueSecond * realPtr->get_value();
-									}
-
-									// Push the result onto the operands stack(vector)
-									operands.push_back(make<Real>(product));
-									evaluated = true;
-									continue;
-								}
-								else
-								{
-									// Variables to hold the result of the pow operations, and to convert(lexical_cast) the
-									// operand numbers to be able to multiply
-									Real::pointer_type realPtr = dynamic_pointer_cast<Real>(variable->get_value());
-									Real::pointer_type realPtrSecond = dynamic_pointer_cast<Real>(secondVariable->get_value());
-									Real::value_type product = realPtrSecond->get_value() * realPtr->get_value();
-
-									// Push the result onto the operands stack(vector)
-									operands.push_back(make<Real>(product));
-									evaluated = true;
-									continue;
-								}
-							}
-						}
-					}
-
-					// If operator is modulus, perform the operation on the operands
-					if (is<Modulus>(operationPtr))
-					{
-						if (boolVariables == false)
-						{
-							// If the operands are both Integer's perform the modulus on it and push the reslt
-							// onto the stack(vector)
-							if (isReal == false)
-							{
-								Integer::value_type modulus = operandNumberSecond % operandNumberFirst;
-								operands.push_back(make<Integer>(modulus));
-								evaluated = true;
-								continue;
-							}
-							else if (isReal == true)
-							{
-								throw exception("Error: cannot perform <Modulus>");
-							}
-						}
-						else if (boolVariables == true)
-						{
-							// If the operands are both Integer's perform the modulus on it and push the reslt
-							// onto the stack(vector)
-							if (isReal == false)
-							{
-								Integer::value_type modulus;
-
-								if (boolNumberFirst == true )
-								{
-									if (Integer::pointer_type intPtr = dynamic_pointer_cast<Integer>(secondVariable->get_value()))
-									{
-										modulus = intPtr->get_value() % operandNumberFirst;
-										operands.push_back(make<Integer>(modulus));
-										evaluated = true;
-										continue;
-									}
-								}
-								else if (boolNumberSecond == true)
-								{
-									if (Integer::pointer_type intPtr = dynamic_pointer_cast<Integer>(variable->get_value()))
-									{
-										modulus = operandNumberSecond & intPtr->get_value();
-										operands.push_back(make<Integer>(modulus));
-										evaluated = true;
-										continue;
-									}
-								}
-							}
-							else if (isReal == true)
-							{
-								throw exception("Error: cannot perform <Modulus>");
-							}
-						}
-					}
-				}
 
-				if (is<Additive>(operationPtr))
-				{
-					if ((boolNumberFirst == true || boolRealNumberFirst == true || variableFirst == true) &&
-						(boolNumberSecond == false && boolRealNumberSecond == false && variableSecond == false))
-					{
-						throw exception("Error: Not enough operands.");
-					}
-
-					if (is<Addition>(operationPtr))
-					{
-						if (boolVariables == false)
-						{
-							// If the operands are both Integer's perform the addition on it and push the result
-								// onto the stack(vector)
-							if (isReal == false)
-							{
-								Integer::value_type result = operandNumberFirst + operandNumberSecond;
-								operands.push_back(make<Integer>(result));
-								evaluated = true;
-								continue;
-							}
-							else if (isReal == true)
-							{
-								Real::value_type resultReal;
-								Real::value_type valueFirst;
-								Real::value_type valueSecond;
-
-								if (boolRealNumberFirst == true && boolNumberSecond == true)
-								{
-									// Variables to hold the result of the addition operations, and to convert(lexical_cast) the
-									// operand numbers to be able to use addition properly;
-									valueSecond = boost::lexical_cast<Real::value_type>(operandNumberSecond);
-									Token::pointer_type realNumber = make<Real>(valueSecond);
-									valueSecond = get_value<Real>(realNumber);
-
-									resultReal = valueSecond + operandRealNumberFirst;
-
-									// Push the result onto the operands stack(vector)
-									operands.push_back(make<Real>(resultReal));
-									evaluated = true;
-									continue;
-								}
-								else if (boolNumberFirst == true && boolRealNumberSecond == true)
-								{
-									// Variables to hold the result of the addition operations, and to convert(lexical_cast) the
-									// operand numbers to be able to use addition properly;
-									valueFirst = boost::lexical_cast<Real::value_type>(operandNumberFirst);
-									Token::pointer_type realNumber = make<Real>(valueFirst);
-									valueFirst = get_value<Real>(realNumber);
-
-									resultReal = operandRealNumberSecond + valueFirst;
-
-									// Push the result onto the operands stack(vector)
-									operands.push_back(make<Real>(resultReal));
-									evaluated = true;
-									continue;
-								}
-								else
-								{
-									// Variables to hold the result of the addition operations, and to convert(lexical_cast) the
-									// operand numbers to be able to use addition properly;
-									resultReal = operandRealNumberSecond + operandRealNumberFirst;
-
-									// Push the result onto the operands stack(vector)
-									operands.push_back(make<Real>(resultReal));
-									evaluated = true;
-									continue;
-								}
-							}
-						}
-						else if (boolVariables == true)
-						{
-							if (isReal == false)
-							{ 
-								if (boolNumberFirst == true && variableSecond == true)
-								{
-									Integer::pointer_type integerPtr = dynamic_pointer_cast<Integer>(secondVariable->get_value());
-									Integer::value_type product = operandNumberFirst + integerPtr->get_value();
-									operands.push_back(make<Integer>(product));
-									evaluated = true;
-									continue;
-								}
-								else if (boolNumberSecond == true && variableFirst == true)
-								{
-									Integer::pointer_type integerPtr = dynamic_pointer_cast<Integer>(variable->get_value());
-									Integer::value_type product = operandNumberSecond + integerPtr->get_value();
-									operands.push_back(make<Integer>(product));
-									evaluated = true;
-									continue;
-								}
-							}
-							else if (isReal == true)
-							{
-								// Variables to hold the real number values
-								Real::value_type productReal;
-								Real::value_type product;
-
-								if ((boolRealNumberFirst == true || boolNumberFirst == true)&& variableSecond == true)
-								{
-									// Variables to hold the result of the pow operations, and to convert(lexical_cast) the
-									// operand numbers to be able to use the multiply								
-									Real::pointer_type realPtr = dynamic_pointer_cast<Real>(secondVariable->get_value());
-
-									// If both oerands are real numbers than just multiply, else if one is a integer
-									// and one is a real convert the integer to a real number
-									if (boolRealNumberFirst == true)
-										product = realPtr->get_value() + operandRealNumberFirst;
-									else if (boolNumberFirst == true)
-									{
-										Real::value_type valueFirst = boost::lexical_cast<Real::value_type>(operandNumberFirst);
-										Token::pointer_type realNumber = make<Real>(valueFirst);
-										valueFirst = get_value<Real>(realNumber);
-										product = realPtr->get_value() + valueFirst;
-									}
-
-									// Push the result onto the operands stack(vector)
-									operands.push_back(make<Real>(product));
-									evaluated = true;
-									continue;
-								}
-								else if (variableFirst == true && (boolRealNumberSecond == true || boolNumberSecond == true))
-								{
-									// Variables to hold the result of the pow operations, and to convert(lexical_cast) the
-									// operand numbers to be able to multiply
-									Real::pointer_type realPtr = dynamic_pointer_cast<Real>(variable->get_value());
-									
-									// If both oerands are real numbers than just multiply, else if one is a integer
-									// and one is a real convert the integer to a real number
-									if (boolRealNumberSecond == true)
-										product = operandRealNumberSecond + realPtr->get_value();
-									else if (boolNumberSecond == true)
-									{
-										Real::value_type valueSecond = boost::lexical_cast<Real::value_type>(operandNumberSecond);
-										Token::pointer_type realNumber = make<Real>(valueSecond);
-										valueSecond = get_value<Real>(realNumber);
-										product = valueSecond + realPtr->get_value();
-									}
-
-									// Push the result onto the operands stack(vector)
-									operands.push_back(make<Real>(product));
-									evaluated = true;
-									continue;
-								}
-								else
-								{
-									// Variables to hold the result of the pow operations, and to convert(lexical_cast) the
-									// operand numbers to be able to multiply
-									Real::pointer_type realPtr = dynamic_pointer_cast<Real>(variable->get_value());
-									Real::pointer_type realPtrSecond = dynamic_pointer_cast<Real>(secondVariable->get_value());
-									Real::value_type product = realPtrSecond->get_value() + realPtr->get_value();
-
-									// Push the result onto the operands stack(vector)
-									operands.push_back(make<Real>(product));
-									evaluated = true;
-									continue;
-								}
-							}
-						}
-					}
-
-					if (is<Subtraction>(operationPtr))
-					{
-						if ((boolNumberFirst == true || boolRealNumberFirst == true || variableFirst == true) &&
-							(boolNumberSecond == false && boolRealNumberSecond == false && variableSecond == false))
-						{
-							throw exception("Error: Not enough operands.");
-						}
-
-						if (boolVariables == false)
-						{
-							// If the operands are both Integer's perform the subtraction on it and push the result
-								// onto the stack(vector)
-							if (isReal == false)
-							{
-								Integer::value_type result = operandNumberSecond - operandNumberFirst;
-								operands.push_back(make<Integer>(result));
-								evaluated = true;
-								continue;
-							}
-							else if (isReal == true)
-							{
-								Real::value_type resultReal;
-								Real::value_type valueFirst;
-								Real::value_type valueSecond;
-
-								if (boolRealNumberFirst == true && boolNumberSecond == true)
-								{
-									// Variables to hold the result of the subtraction operations, and to convert(lexical_cast) the
-									// operand numbers to be able to use subtraction properly;
-									valueSecond = boost::lexical_cast<Real::value_type>(operandNumberSecond);
-									Token::pointer_type realNumber = make<Real>(valueSecond);
-									valueSecond = get_value<Real>(realNumber);
-
-									resultReal = valueSecond - operandRealNumberFirst;
-
-									// Push the result onto the operands stack(vector)
-									operands.push_back(make<Real>(resultReal));
-									evaluated = true;
-									continue;
-								}
-								else if (boolNumberFirst == true && boolRealNumberSecond == true)
-								{
-									// Variables to hold the result of the addition operations, and to convert(lexical_cast) the
-									// operand numbers to be able to use addition properly;
-									valueFirst = boost::lexical_cast<Real::value_type>(operandNumberFirst);
-									Token::pointer_type realNumber = make<Real>(valueFirst);
-									valueFirst = get_value<Real>(realNumber);
-
-									resultReal = operandRealNumberSecond - valueFirst;
-
-									// Push the result onto the operands stack(vector)
-									operands.push_back(make<Real>(resultReal));
-									evaluated = true;
-									continue;
-								}
-								else
-								{
-									// Variables to hold the result of the addition operations, and to convert(lexical_cast) the
-									// operand numbers to be able to use addition properly;
-									resultReal = operandRealNumberSecond - operandRealNumberFirst;
-
-									// Push the result onto the operands stack(vector)
-									operands.push_back(make<Real>(resultReal));
-									evaluated = true;
-									continue;
-								}
-							}
-						}
-						else if (boolVariables == true)
-						{
-							if (isReal == false)
-							{ //*****
-								if (boolNumberFirst == true && variableSecond == true)
-								{
-									Integer::pointer_type integerPtr = dynamic_pointer_cast<Integer>(secondVariable->get_value());
-									Integer::value_type product = operandNumberFirst - integerPtr->get_value();
-									operands.push_back(make<Integer>(product));
-									evaluated = true;
-									continue;
-								}
-								else if (boolNumberSecond == true && variableFirst == true)
-								{
-									Integer::pointer_type integerPtr = dynamic_pointer_cast<Integer>(variable->get_value());
-									Integer::value_type product = operandNumberSecond - integerPtr->get_value();
-									operands.push_back(make<Integer>(product));
-									evaluated = true;
-									continue;
-								}
-							}
-							else if (isReal == true)
-							{
-								// Variables to hold the real number values
-								Real::value_type productReal;
-								Real::value_type product;
-
-								if ((boolRealNumberFirst == true || boolNumberFirst == true)&& variableSecond == true)
-								{
-									// Variables to hold the result of the pow operations, and to convert(lexical_cast) the
-									// operand numbers to be able to use the multiply								
-									Real::pointer_type realPtr = dynamic_pointer_cast<Real>(secondVariable->get_value());
-
-									// If both oerands are real numbers than just multiply, else if one is a integer
-									// and one is a real convert the integer to a real number
-									if (boolRealNumberFirst == true)
-										product = realPtr->get_value() + operandRealNumberFirst;
-									else if (boolNumberFirst == true)
-									{
-										Real::value_type valueFirst = boost::lexical_cast<Real::value_type>(operandNumberFirst);
-										Token::pointer_type realNumber = make<Real>(valueFirst);
-										valueFirst = get_value<Real>(realNumber);
-										product = realPtr->get_value() + valueFirst;
-									}
-
-									// Push the result onto the operands stack(vector)
-									operands.push_back(make<Real>(product));
-									evaluated = true;
-									continue;
-								}
-								else if (variableFirst == true && (boolRealNumberSecond == true || boolNumberSecond == true))
-								{
-									// Variables to hold the result of the pow operations, and to convert(lexical_cast) the
-									// operand numbers to be able to multiply
-									Real::pointer_type realPtr = dynamic_pointer_cast<Real>(variable->get_value());
-									
-									// If both oerands are real numbers than just multiply, else if one is a integer
-									// and one is a real convert the integer to a real number
-									if (boolRealNumberSecond == true)
-										product = operandRealNumberSecond * realPtr->get_value();
-									else if (boolNumberSecond == true)
-									{
-										Real::value_type valueSecond = boost::lexical_cast<Real::value_type>(operandNumberSecond);
-										Token::pointer_type realNumber = make<Real>(valueSecond);
-										valueSecond = get_value<Real>(realNumber);
-										product = valueSecond * realPtr->get_value();
-									}
-
-									// Push the result onto the operands stack(vector)
-									operands.push_back(make<Real>(product));
-									evaluated = true;
-									continue;
-								}
-								else
-								{
-									// Variables to hold the result of the pow operations, and to convert(lexical_cast) the
-									// operand numbers to be able to multiply
-									Real::pointer_type realPtr = dynamic_pointer_cast<Real>(variable->get_value());
-									Real::pointer_type realPtrSecond = dynamic_pointer_cast<Real>(secondVariable->get_value());
-									Real::value_type product = realPtrSecond->get_value() - realPtr->get_value();
-
-									// Push the result onto the operands stack(vector)
-									operands.push_back(make<Real>(product));
-									evaluated = true;
-									continue;
-								}
-							}
-						}
-					}
-				}
+/** Share common subexpressions.
+	@return the program with each repeated pure subexpression computed once.
+	@param program [in] a program lowered by compile() (and possibly folded).
+	@param deduplicated [out] the number of operations that are no longer computed.
+	@note Literals are identical when their values are; variables when they are the same variable.
+		When the program assigns, subexpressions that read variables are not shared.
+	*/
+RPNEvaluator::program_type RPNEvaluator::share(program_type const& program, size_t& deduplicated) const {
+	deduplicated = 0;
+	bool const assigns = any_of(program.begin(), program.end(), [](Instruction const& i) { return i.opcode == opcode_type::ASSIGNMENT; });
 
-				// If comparing Boolean values
-				if (is<LogOr>(operationPtr) || is<LogXor>(operationPtr) || is<LogAnd>(operationPtr))
-				{
-					if (is<And>(operationPtr))
-					{
-						if (boolVariables == false)
-						{
-							// Check the boolean values, both must be true to return true,
-							// push result onto operands stack(vector)
-							if (firstBool == true && secondBool == true)
-							{
-								operands.push_back(make<Boolean>(true));
-								evaluated = true;
-								continue;
-							}
-							else if (firstBool == true && secondBool == false)
-							{
-								operands.push_back(make<Boolean>(false));
-								evaluated = true;
-								continue;
-							}
-							else if (firstBool == false && secondBool == true)
-							{
-								operands.push_back(make<Boolean>(false));
-								evaluated = true;
-								continue;
-							}
-							else if (firstBool == false && secondBool == false)
-							{
-								operands.push_back(make<Boolean>(false));
-								evaluated = true;
-								continue;
-							}
-						}
-						else if (boolVariables == true)
-						{
-							Boolean::pointer_type boolPtr = dynamic_pointer_cast<Boolean>(variable->get_value());
-							Boolean::pointer_type boolSecondPtr = dynamic_pointer_cast<Boolean>(secondVariable->get_value());
-
-							if (boolPtr->get_value() == true && boolSecondPtr->get_value() == true)
-							{
-								Token::pointer_type boolToken = make<Boolean>(true);
-								Boolean::pointer_type newBoolValue = dynamic_pointer_cast<Boolean>(boolToken);
-								variable->set_value(newBoolValue);
-								
-								if(operands.size() > 0)
-									operands.push_back(variable);
-								else if (operands.size() == 0)
-								{
-									operands.push_back(newBoolValue);
-								}
-
-								evaluated = true;
-								continue;
-							}
-							else if (boolPtr->get_value() == false && boolSecondPtr->get_value() == true)
-							{
-								Token::pointer_type boolToken = make<Boolean>(false);
-								Boolean::pointer_type newBoolValue = dynamic_pointer_cast<Boolean>(boolToken);
-								variable->set_value(newBoolValue);
-								operands.push_back(variable);
-								evaluated = true;
-								continue;
-							}
-							else if (boolPtr->get_value() == true && boolSecondPtr->get_value() == false)
-							{
-								Token::pointer_type boolToken = make<Boolean>(false);
-								Boolean::pointer_type newBoolValue = dynamic_pointer_cast<Boolean>(boolToken);
-								variable->set_value(newBoolValue);
-								
-								if (operands.size() > 0)
-									operands.push_back(variable);
-								else if (operands.size() == 0)
-								{
-									operands.push_back(newBoolValue);
-								}
-
-								evaluated = true;
-								continue;
-							}
-							else if (boolPtr->get_value() == false && boolSecondPtr->get_value() == false)
-							{
-								Token::pointer_type boolToken = make<Boolean>(false);
-								Boolean::pointer_type newBoolValue = dynamic_pointer_cast<Boolean>(boolToken);
-								variable->set_value(newBoolValue);
-								
-								if (operands.size() > 0)
-									operands.push_back(variable);
-								else if (operands.size() == 0)
-								{
-									operands.push_back(newBoolValue);
-								}
-
-								evaluated = true;
-								continue;
-							}
-						}
-					}
-
-					if (is<Nand>(operationPtr))
-					{
-						if (boolVariables == false)
-						{
-							// Check the boolean values, both must be true to return false,
-							// push result onto operands stack(vector)
-							if (firstBool == true && secondBool == true)
-							{
-								operands.push_back(make<Boolean>(false));
-								evaluated = true;
-								continue;
-							}
-							else if (firstBool == true && secondBool == false)
-							{
-								operands.push_back(make<Boolean>(true));
-								evaluated = true;
-								continue;
-							}
-							else if (firstBool == false && secondBool == true)
-							{
-								operands.push_back(make<Boolean>(true));
-								evaluated = true;
-								continue;
-							}
-							else if (firstBool == false && secondBool == false)
-							{
-								operands.push_back(make<Boolean>(true));
-								evaluated = true;
-								continue;
-							}
-						}
-						else if (boolVariables == true)
-						{
-							Boolean::pointer_type boolPtr = dynamic_pointer_cast<Boolean>(variable->get_value());
-							Boolean::pointer_type boolSecondPtr = dynamic_pointer_cast<Boolean>(secondVariable->get_value());
-
-							if (boolPtr->get_value() == true && boolSecondPtr->get_value() == true)
-							{
-								Token::pointer_type boolToken = make<Boolean>(false);
-								Boolean::pointer_type newBoolValue = dynamic_pointer_cast<Boolean>(boolToken);
-								variable->set_value(newBoolValue);
-
-								if (operands.size() > 0)
-									operands.push_back(variable);
-								else if (operands.size() == 0)
-								{
-									operands.push_back(newBoolValue);
-								}
-
-								evaluated = true;
-								continue;
-							}
-							else if (boolPtr->get_value() == false && boolSecondPtr->get_value() == true)
-							{
-								Token::pointer_type boolToken = make<Boolean>(true);
-								Boolean::pointer_type newBoolValue = dynamic_pointer_cast<Boolean>(boolToken);
-								variable->set_value(newBoolValue);
-								operands.push_back(variable);
-								evaluated = true;
-								continue;
-							}
-							else if (boolPtr->get_value() == true && boolSecondPtr->get_value() == false)
-							{
-								Token::pointer_type boolToken = make<Boolean>(true);
-								Boolean::pointer_type newBoolValue = dynamic_pointer_cast<Boolean>(boolToken);
-								variable->set_value(newBoolValue);
-
-								if (operands.size() > 0)
-									operands.push_back(variable);
-								else if (operands.size() == 0)
-								{
-									operands.push_back(newBoolValue);
-								}
-
-								evaluated = true;
-								continue;
-							}
-							else if (boolPtr->get_value() == false && boolSecondPtr->get_value() == false)
-							{
-								Token::pointer_type boolToken = make<Boolean>(true);
-								Boolean::pointer_type newBoolValue = dynamic_pointer_cast<Boolean>(boolToken);
-								variable->set_value(newBoolValue);
-
-								if (operands.size() > 0)
-									operands.push_back(variable);
-								else if (operands.size() == 0)
-								{
-									operands.push_back(newBoolValue);
-								}
-
-								evaluated = true;
-								continue;
-							}
-						}
-					}
-
-					if (is<Nor>(operationPtr))
-					{
-						if (boolVariables == false)
-						{
-							// Check the boolean values, both must be false to return true,
-							// push result onto operands stack(vector)
-							if (firstBool == true && secondBool == true)
-							{
-								operands.push_back(make<Boolean>(false));
-								evaluated = true;
-								continue;
-							}
-							else if (firstBool == true && secondBool == false)
-							{
-								operands.push_back(make<Boolean>(false));
-								evaluated = true;
-								continue;
-							}
-							else if (firstBool == false && secondBool == true)
-							{
-								operands.push_back(make<Boolean>(false));
-								evaluated = true;
-								continue;
-							}
-							else if (firstBool == false && secondBool == false)
-							{
-								operands.push_back(make<Boolean>(true));
-								evaluated = true;
-								continue;
-							}
-						}
-						else if (boolVariables == true)
-						{
-							Boolean::pointer_type boolPtr = dynamic_pointer_cast<Boolean>(variable->get_value());
-							Boolean::pointer_type boolSecondPtr = dynamic_pointer_cast<Boolean>(secondVariable->get_value());
-
-							if (boolPtr->get_value() == true && boolSecondPtr->get_value() == true)
-							{
-								Token::pointer_type boolToken = make<Boolean>(false);
-								Boolean::pointer_type newBoolValue = dynamic_pointer_cast<Boolean>(boolToken);
-								variable->set_value(newBoolValue);
-
-								if (operands.size() > 0)
-									operands.push_back(variable);
-								else if (operands.size() == 0)
-								{
-									operands.push_back(newBoolValue);
-								}
-
-								evaluated = true;
-								continue;
-							}
-							else if (boolPtr->get_value() == false && boolSecondPtr->get_value() == true)
-							{
-								Token::pointer_type boolToken = make<Boolean>(false);
-								Boolean::pointer_type newBoolValue = dynamic_pointer_cast<Boolean>(boolToken);
-								variable->set_value(newBoolValue);
-								operands.push_back(variable);
-								evaluated = true;
-								continue;
-							}
-							else if (boolPtr->get_value() == true && boolSecondPtr->get_value() == false)
-							{
-								Token::pointer_type boolToken = make<Boolean>(false);
-								Boolean::pointer_type newBoolValue = dynamic_pointer_cast<Boolean>(boolToken);
-								variable->set_value(newBoolValue);
-
-								if (operands.size() > 0)
-									operands.push_back(variable);
-								else if (operands.size() == 0)
-								{
-									operands.push_back(newBoolValue);
-								}
-
-								evaluated = true;
-								continue;
-							}
-							else if (boolPtr->get_value() == false && boolSecondPtr->get_value() == false)
-							{
-								Token::pointer_type boolToken = make<Boolean>(true);
-								Boolean::pointer_type newBoolValue = dynamic_pointer_cast<Boolean>(boolToken);
-								variable->set_value(newBoolValue);
-
-								if (operands.size() > 0)
-									operands.push_back(variable);
-								else if (operands.size() == 0)
-								{
-									operands.push_back(newBoolValue);
-								}
-
-								evaluated = true;
-								continue;
-							}
-						}
-					}
-
-					if (is<Or>(operationPtr))
-					{
-						if (isBoolValue == true)
-						{
-							// Check the boolean values, one must be true to return true,
-							// push result onto operands stack(vector)
-							if (firstBool == true && secondBool == true)
-							{
-								operands.push_back(make<Boolean>(true));
-								evaluated = true;
-								continue;
-							}
-							else if (firstBool == true && secondBool == false)
-							{
-								operands.push_back(make<Boolean>(true));
-								evaluated = true;
-								continue;
-							}
-							else if (firstBool == false && secondBool == true)
-							{
-								operands.push_back(make<Boolean>(true));
-								evaluated = true;
-								continue;
-							}
-							else if (firstBool == false && secondBool == false)
-							{
-								operands.push_back(make<Boolean>(false));
-								evaluated = true;
-								continue;
-							}
-						}
-						else if (boolVariables == true)
-						{
-							Boolean::pointer_type boolPtr = dynamic_pointer_cast<Boolean>(variable->get_value());
-							Boolean::pointer_type boolSecondPtr = dynamic_pointer_cast<Boolean>(secondVariable->get_value());
-							
-							if (boolPtr->get_value() == true && boolSecondPtr->get_value() == true)
-							{
-								Token::pointer_type boolToken = make<Boolean>(true);
-								Boolean::pointer_type newBoolValue = dynamic_pointer_cast<Boolean>(boolToken);
-								variable->set_value(newBoolValue);
-								operands.push_back(variable);
-								evaluated = true;
-								continue;
-							}
-							else if (boolPtr->get_value() == false && boolSecondPtr->get_value() == true)
-							{
-								Token::pointer_type boolToken = make<Boolean>(true);
-								Boolean::pointer_type newBoolValue = dynamic_pointer_cast<Boolean>(boolToken);
-								variable->set_value(newBoolValue);
-								operands.push_back(variable);
-								evaluated = true;
-								continue;
-							}
-							else if (boolPtr->get_value() == true && boolSecondPtr->get_value() == false)
-							{
-								Token::pointer_type boolToken = make<Boolean>(true);
-								Boolean::pointer_type newBoolValue = dynamic_pointer_cast<Boolean>(boolToken);
-								variable->set_value(newBoolValue);
-								operands.push_back(variable);
-								evaluated = true;
-								continue;
-							}
-							else if (boolPtr->get_value() == false && boolSecondPtr->get_value() == false)
-							{
-								Token::pointer_type boolToken = make<Boolean>(false);
-								Boolean::pointer_type newBoolValue = dynamic_pointer_cast<Boolean>(boolToken);
-								variable->set_value(newBoolValue);
-								operands.push_back(variable);
-								evaluated = true;
-								continue;
-							}
-						}
-					}
-
-					if (is<Xor>(operationPtr))
-					{
-						if (boolVariables == false)
-						{
-							// Check the boolean values, one must be true and one must be false
-							// to return true, push result onto operands stack(vector)
-							if (firstBool == true && secondBool == true)
-							{
-								operands.push_back(make<Boolean>(false));
-								evaluated = true;
-								continue;
-							}
-							else if (firstBool == true && secondBool == false)
-							{
-								operands.push_back(make<Boolean>(true));
-								evaluated = true;
-								continue;
-							}
-							else if (firstBool == false && secondBool == true)
-							{
-								operands.push_back(make<Boolean>(true));
-								evaluated = true;
-								continue;
-							}
-							else if (firstBool == false && secondBool == false)
-							{
-								operands.push_back(make<Boolean>(false));
-								evaluated = true;
-								continue;
-							}
-						}
-						else if (boolVariables == true)
-						{
-							Boolean::pointer_type boolPtr = dynamic_pointer_cast<Boolean>(variable->get_value());
-							Boolean::pointer_type boolSecondPtr = dynamic_pointer_cast<Boolean>(secondVariable->get_value());
-
-							if (boolPtr->get_value() == true && boolSecondPtr->get_value() == true)
-							{
-								Token::pointer_type boolToken = make<Boolean>(false);
-								Boolean::pointer_type newBoolValue = dynamic_pointer_cast<Boolean>(boolToken);
-								variable->set_value(newBoolValue);
-
-								if (operands.size() > 0)
-									operands.push_back(variable);
-								else if (operands.size() == 0)
-								{
-									operands.push_back(newBoolValue);
-								}
-
-								evaluated = true;
-								continue;
-							}
-							else if (boolPtr->get_value() == false && boolSecondPtr->get_value() == true)
-							{
-								Token::pointer_type boolToken = make<Boolean>(false);
-								Boolean::pointer_type newBoolValue = dynamic_pointer_cast<Boolean>(boolToken);
-								variable->set_value(newBoolValue);
-								operands.push_back(variable);
-								evaluated = true;
-								continue;
-							}
-							else if (boolPtr->get_value() == true && boolSecondPtr->get_value() == false)
-							{
-								Token::pointer_type boolToken = make<Boolean>(true);
-								Boolean::pointer_type newBoolValue = dynamic_pointer_cast<Boolean>(boolToken);
-								variable->set_value(newBoolValue);
-
-								if (operands.size() > 0)
-									operands.push_back(variable);
-								else if (operands.size() == 0)
-								{
-									operands.push_back(newBoolValue);
-								}
-
-								evaluated = true;
-								continue;
-							}
-							else if (boolPtr->get_value() == false && boolSecondPtr->get_value() == false)
-							{
-								Token::pointer_type boolToken = make<Boolean>(false);
-								Boolean::pointer_type newBoolValue = dynamic_pointer_cast<Boolean>(boolToken);
-								variable->set_value(newBoolValue);
-
-								if (operands.size() > 0)
-									operands.push_back(variable);
-								else if (operands.size() == 0)
-								{
-									operands.push_back(newBoolValue);
-								}
-
-								evaluated = true;
-								continue;
-							}
-						}
-					}
-					if (is<Xnor>(operationPtr))
-					{
-						if (boolVariables == false)
-						{
-							// Check the boolean values, one must be true and one must be false
-							// to return true, push result onto operands stack(vector)
-							if (firstBool == true && secondBool == true)
-							{
-								operands.push_back(make<Boolean>(true));
-								evaluated = true;
-								continue;
-							}
-							else if (firstBool == true && secondBool == false)
-							{
-								operands.push_back(make<Boolean>(false));
-								evaluated = true;
-								continue;
-							}
-							else if (firstBool == false && secondBool == true)
-							{
-								operands.push_back(make<Boolean>(false));
-								evaluated = true;
-								continue;
-							}
-							else if (firstBool == false && secondBool == false)
-							{
-								operands.push_back(make<Boolean>(true));
-								evaluated = true;
-								continue;
-							}
-						}
-						else if (boolVariables == true)
-						{
-							Boolean::pointer_type boolPtr = dynamic_pointer_cast<Boolean>(variable->get_value());
-							Boolean::pointer_type boolSecondPtr = dynamic_pointer_cast<Boolean>(secondVariable->get_value());
-
-							if (boolPtr->get_value() == true && boolSecondPtr->get_value() == true)
-							{
-								Token::pointer_type boolToken = make<Boolean>(true);
-								Boolean::pointer_type newBoolValue = dynamic_pointer_cast<Boolean>(boolToken);
-								variable->set_value(newBoolValue);
-
-								if (operands.size() > 0)
-									operands.push_back(variable);
-								else if (operands.size() == 0)
-								{
-									operands.push_back(newBoolValue);
-								}
-
-								evaluated = true;
-								continue;
-							}
-							else if (boolPtr->get_value() == false && boolSecondPtr->get_value() == true)
-							{
-								Token::pointer_type boolToken = make<Boolean>(false);
-								Boolean::pointer_type newBoolValue = dynamic_pointer_cast<Boolean>(boolToken);
-								variable->set_value(newBoolValue);
-								operands.push_back(variable);
-								evaluated = true;
-								continue;
-							}
-							else if (boolPtr->get_value() == true && boolSecondPtr->get_value() == false)
-							{
-								Token::pointer_type boolToken = make<Boolean>(false);
-								Boolean::pointer_type newBoolValue = dynamic_pointer_cast<Boolean>(boolToken);
-								variable->set_value(newBoolValue);
-
-								if (operands.size() > 0)
-									operands.push_back(variable);
-								else if (operands.size() == 0)
-								{
-									operands.push_back(newBoolValue);
-								}
-
-								evaluated = true;
-								continue;
-							}
-							else if (boolPtr->get_value() == false && boolSecondPtr->get_value() == false)
-							{
-								Token::pointer_type boolToken = make<Boolean>(true);
-								Boolean::pointer_type newBoolValue = dynamic_pointer_cast<Boolean>(boolToken);
-								variable->set_value(newBoolValue);
-
-								if (operands.size() > 0)
-									operands.push_back(variable);
-								else if (operands.size() == 0)
-								{
-									operands.push_back(newBoolValue);
-								}
-
-								evaluated = true;
-								continue;
-							}
-						}
-					}
-				}
+	// Hash-cons the expression tree: a pure node is keyed by its opcode and argument node ids
+	vector<DagNode> nodes;
+	map<string, size_t> ids;
+	vector<size_t> stack;
+	size_t operations = 0;
 
-				if (is<Equality>(operationPtr))
-				{
-					Real::value_type resultReal;
-					Real::value_type valueFirst;
-					Real::value_type valueSecond;
-
-					if (isBoolValue == true)
-					{
-						// Check the boolean values, both must be the same value 
-						// to return true, push result onto operands stack(vector)
-						if ((firstBool == true && secondBool == true) || (firstBool == false && secondBool == false))
-						{
-							operands.push_back(make<Boolean>(true));
-							evaluated = true;
-							continue;
-						}
-						else if (firstBool == false || secondBool == false)
-						{
-							operands.push_back(make<Boolean>(false));
-							evaluated = true;
-							continue;
-						}
-					}
-					else if (isReal == false && boolVariables == false)
-					{
-						if (operandNumberFirst == operandNumberSecond)
-						{
-							operands.push_back(make<Boolean>(true));
-							evaluated = true;
-							continue;
-						}
-						else if (operandNumberFirst != operandNumberSecond)
-						{
-							operands.push_back(make<Boolean>(false));
-							evaluated = true;
-							continue;
-						}
-					}
-					else if (isReal == true)
-					{
-						if (boolRealNumberFirst == true && boolNumberSecond == true)
-						{
-							// Variables to hold the result of the equality operation, and to convert(lexical_cast) the
-							// operand numbers to be able to use the equality operation;
-							valueSecond = boost::lexical_cast<Real::value_type>(operandNumberSecond);
-							Token::pointer_type realNumber = make<Real>(valueSecond);
-							valueSecond = get_value<Real>(realNumber);
-
-							if (operandRealNumberFirst == valueSecond)
-							{
-								operands.push_back(make<Boolean>(true));
-								evaluated = true;
-								continue;
-							}
-							else
-							{
-								operands.push_back(make<Boolean>(false));
-								evaluated = true;
-								continue;
-							}
-						}
-						else if (boolRealNumberSecond == true && boolNumberFirst == true)
-						{
-							// Variables to hold the result of the equality operation, and to convert(lexical_cast) the
-							// operand numbers to be able to use the equality operation;
-							valueFirst = boost::lexical_cast<Real::value_type>(operandNumberFirst);
-							Token::pointer_type realNumber = make<Real>(valueFirst);
-							valueFirst = get_value<Real>(realNumber);
-
-							if (valueFirst == operandRealNumberSecond)
-							{
-								operands.push_back(make<Boolean>(true));
-								evaluated = true;
-								continue;
-							}
-							else
-							{
-								operands.push_back(make<Boolean>(false));
-								evaluated = true;
-								continue;
-							}
-						}
-						else if (operandRealNumberFirst == operandRealNumberSecond)
-						{
-							operands.push_back(make<Boolean>(true));
-							evaluated = true;
-							continue;
-						}
-						else
-						{
-							operands.push_back(make<Boolean>(false));
-							evaluated = true;
-							continue;
-						}
-					}
-					else if (boolVariables == true)
-					{
-						Boolean::pointer_type boolPtr = nullptr;
-						Boolean::pointer_type boolSecondPtr = nullptr;
-						
-						if(variableFirst == true)
-							boolPtr = dynamic_pointer_cast<Boolean>(variable->get_value());
-						if(variableSecond == true)
-							boolSecondPtr = dynamic_pointer_cast<Boolean>(secondVariable->get_value());
-
-						if (variableFirst == true && variableSecond == true)
-						{
-							if ((boolPtr->get_value() == true && boolSecondPtr->get_value() == true) ||
-								(boolPtr->get_value() == false && boolSecondPtr->get_value() == false))
-							{
-								Token::pointer_type boolToken = make<Boolean>(true);
-								Boolean::pointer_type newBoolValue = dynamic_pointer_cast<Boolean>(boolToken);
-								variable->set_value(newBoolValue);
-								operands.push_back(variable);
-								evaluated = true;
-								continue;
-							}
-							else
-							{
-								Token::pointer_type boolToken = make<Boolean>(false);
-								Boolean::pointer_type newBoolValue = dynamic_pointer_cast<Boolean>(boolToken);
-								variable->set_value(newBoolValue);
-								operands.push_back(variable);
-								evaluated = true;
-								continue;
-							}
-						}
-						else if (variableFirst == true && secondBool == true)
-						{
-							if ((boolPtr->get_value() == true && secondBool == true) ||
-								(boolPtr->get_value() == false && secondBool == false))
-							{
-								Token::pointer_type boolToken = make<Boolean>(true);
-								Boolean::pointer_type newBoolValue = dynamic_pointer_cast<Boolean>(boolToken);
-								variable->set_value(newBoolValue);
-								operands.push_back(variable);
-								evaluated = true;
-								continue;
-							}
-							else
-							{
-								Token::pointer_type boolToken = make<Boolean>(false);
-								Boolean::pointer_type newBoolValue = dynamic_pointer_cast<Boolean>(boolToken);
-								variable->set_value(newBoolValue);
-								operands.push_back(variable);
-								evaluated = true;
-								continue;
-							}
-						}
-						else if (variableSecond == true && firstBool == true)
-						{
-							if ((boolSecondPtr->get_value() == true && firstBool == true) ||
-								(boolSecondPtr->get_value() == false && firstBool == false))
-							{
-								Token::pointer_type boolToken = make<Boolean>(true);
-								Boolean::pointer_type newBoolValue = dynamic_pointer_cast<Boolean>(boolToken);
-								variable->set_value(newBoolValue);
-								operands.push_back(variable);
-								evaluated = true;
-								continue;
-							}
-							else
-							{
-								Token::pointer_type boolToken = make<Boolean>(false);
-								Boolean::pointer_type newBoolValue = dynamic_pointer_cast<Boolean>(boolToken);
-								variable->set_value(newBoolValue);
-								operands.push_back(variable);
-								evaluated = true;
-								continue;
-							}
-						}
-					}
-				}
+	for (auto const& instruction : program)
+	{
+		// A malformed program is left as it is for execute() to report
+		if (instruction.number_of_args > stack.size())
+			return program;
 
-				if (is<Inequality>(operationPtr))
-				{
-					// Variables to hold the lexical_cast numbers
-					Real::value_type resultReal;
-					Real::value_type valueFirst;
-					Real::value_type valueSecond;
-
-					if (boolVariables == false)
-					{
-						if (isBoolValue == true)
-						{
-							// Check the boolean values, both must be the same value 
-							// to return true, push result onto operands stack(vector)
-							if ((firstBool == true && secondBool == true) || (firstBool == false && secondBool == false))
-							{
-								operands.push_back(make<Boolean>(false));
-								evaluated = true;
-								continue;
-							}
-							else if ((firstBool == false && secondBool == true) || (firstBool == true && secondBool == false))
-							{
-								operands.push_back(make<Boolean>(true));
-								evaluated = true;
-								continue;
-							}
-						}
-						else if (isReal == false)
-						{
-							if (operandNumberFirst != operandNumberSecond)
-							{
-								operands.push_back(make<Boolean>(true));
-								evaluated = true;
-								continue;
-							}
-							else if (operandNumberFirst == operandNumberSecond)
-							{
-								operands.push_back(make<Boolean>(false));
-								evaluated = true;
-								continue;
-							}
-						}
-						else if (isReal == true)
-						{
-							if (boolRealNumberFirst == true && boolNumberSecond == true)
-							{
-								// Variables to hold the result of the inequality operation, and to convert(lexical_cast) the
-								// operand numbers to be able to use the inequality operation;
-								valueSecond = boost::lexical_cast<Real::value_type>(operandNumberSecond);
-								Token::pointer_type realNumber = make<Real>(valueSecond);
-								valueSecond = get_value<Real>(realNumber);
-
-								if (operandRealNumberFirst != valueSecond)
-								{
-									operands.push_back(make<Boolean>(true));
-									evaluated = true;
-									continue;
-								}
-								else
-								{
-									operands.push_back(make<Boolean>(false));
-									evaluated = true;
-									continue;
-								}
-							}
-							else if (boolRealNumberSecond == true && boolNumberFirst == true)
-							{
-								// Variables to hold the result of the inequality operation, and to convert(lexical_cast) the
-								// operand numbers to be able to use the inequality operation;
-								valueFirst = boost::lexical_cast<Real::value_type>(operandNumberFirst);
-								Token::pointer_type realNumber = make<Real>(valueFirst);
-								valueFirst = get_value<Real>(realNumber);
-
-								if (valueFirst != operandRealNumberSecond)
-								{
-									operands.push_back(make<Boolean>(true));
-									evaluated = true;
-									continue;
-								}
-								else
-								{
-									operands.push_back(make<Boolean>(false));
-									evaluated = true;
-									continue;
-								}
-							}
-							else if (operandRealNumberFirst != operandRealNumberSecond)
-							{
-								operands.push_back(make<Boolean>(true));
-								evaluated = true;
-								continue;
-							}
-							else
-							{
-								operands.push_back(make<Boolean>(false));
-								evaluated = true;
-								continue;
-							}
-						}
-					}
-					else if (boolVariables == true)
-					{
-						Boolean::pointer_type boolPtr = dynamic_pointer_cast<Boolean>(variable->get_value());
-						Boolean::pointer_type boolSecondPtr = dynamic_pointer_cast<Boolean>(secondVariable->get_value());
-
-						if ((boolPtr->get_value() == true && boolSecondPtr->get_value() == true) ||
-							(boolPtr->get_value() == false && boolSecondPtr->get_value() == false))
-						{
-							Token::pointer_type boolToken = make<Boolean>(false);
-							Boolean::pointer_type newBoolValue = dynamic_pointer_cast<Boolean>(boolToken);
-							variable->set_value(newBoolValue);
-							operands.push_back(variable);
-							evaluated = true;
-							continue;
-						}
-						else
-						{
-							Token::pointer_type boolToken = make<Boolean>(true);
-							Boolean::pointer_type newBoolValue = dynamic_pointer_cast<Boolean>(boolToken);
-							variable->set_value(newBoolValue);
-							operands.push_back(variable);
-							evaluated = true;
-							continue;
-						}
-					}
-				}
+		DagNode node{ instruction, vector<size_t>(stack.end() - instruction.number_of_args, stack.end()), true, 0, NO_TEMPORARY };
+		stack.resize(stack.size() - instruction.number_of_args);
 
-				// If the boolean values are being related to eachother >, <, <=, >=
-				if (is<Relational>(operationPtr))
-				{
-					// Variables to hold the lexical_cast numbers
-					Real::value_type resultReal;
-					Real::value_type valueFirst;
-					Real::value_type valueSecond;
-
-					// Returns true only when user inputs true > false, or a value1 > value2
-					if (is<Greater>(operationPtr))
-					{
-						if (boolVariables == false)
-						{
-							if (isBoolValue == true)
-							{
-								if ((firstBool == true && secondBool == true) || (firstBool == false && secondBool == false)
-									|| (firstBool == true && secondBool == false))
-								{
-									operands.push_back(make<Boolean>(false));
-									evaluated = true;
-									continue;
-								}
-								else
-								{
-									operands.push_back(make<Boolean>(true));
-									evaluated = true;
-									continue;
-								}
-							}
-							else if (isReal == false)
-							{
-								// check the integer values are greater than
-								if (operandNumberSecond > operandNumberFirst)
-								{
-									operands.push_back(make<Boolean>(true));
-									evaluated = true;
-									continue;
-								}
-								else
-								{
-									operands.push_back(make<Boolean>(false));
-									evaluated = true;
-									continue;
-								}
-							}
-							else if (isReal == true)
-							{
-								if (boolRealNumberFirst == true && boolNumberSecond == true)
-								{
-									// Variables to hold the result of the greater than operation, and to convert(lexical_cast) the
-									// operand numbers to be able to use the greater than operation;
-									valueSecond = boost::lexical_cast<Real::value_type>(operandNumberSecond);
-									Token::pointer_type realNumber = make<Real>(valueSecond);
-									valueSecond = get_value<Real>(realNumber);
-
-									if (valueSecond > operandRealNumberFirst)
-									{
-										operands.push_back(make<Boolean>(true));
-										evaluated = true;
-										continue;
-									}
-									else
-									{
-										operands.push_back(make<Boolean>(false));
-										evaluated = true;
-										continue;
-									}
-								}
-								else if (boolRealNumberSecond == true && boolNumberFirst == true)
-								{
-									// Variables to hold the result of the greater than operation, and to convert(lexical_cast) the
-									// operand numbers to be able to use the greater than operation;
-									valueFirst = boost::lexical_cast<Real::value_type>(operandNumberFirst);
-									Token::pointer_type realNumber = make<Real>(valueFirst);
-									valueFirst = get_value<Real>(realNumber);
-
-									if (operandRealNumberSecond > valueFirst)
-									{
-										operands.push_back(make<Boolean>(true));
-										evaluated = true;
-										continue;
-									}
-									else
-									{
-										operands.push_back(make<Boolean>(false));
-										evaluated = true;
-										continue;
-									}
-								}
-								else if (operandRealNumberSecond > operandRealNumberFirst)
-								{
-									operands.push_back(make<Boolean>(true));
-									evaluated = true;
-									continue;
-								}
-								else
-								{
-									operands.push_back(make<Boolean>(false));
-									evaluated = true;
-									continue;
-								}
-							}
-						}
-						if (boolVariables == true)
-						{
-							if (isBoolValue == true)
-							{
-								Boolean::pointer_type boolPtr = dynamic_pointer_cast<Boolean>(variable->get_value());
-								Boolean::pointer_type boolSecondPtr = dynamic_pointer_cast<Boolean>(secondVariable->get_value());
-
-								if ((firstBool == true && boolSecondPtr->get_value() == true) || (firstBool == false && boolSecondPtr->get_value() == false)
-									|| (firstBool == true && boolSecondPtr->get_value() == false) ||(secondBool == true && boolPtr->get_value() == true) 
-									|| (secondBool == false && boolPtr->get_value() == false) || (secondBool == false && boolPtr->get_value() == true))
-								{
-									operands.push_back(make<Boolean>(false));
-									evaluated = true;
-									continue;
-								}
-								else
-								{
-									operands.push_back(make<Boolean>(true));
-									evaluated = true;
-									continue;
-								}
-							}
-						}
-					}
-					else if (is<GreaterEqual>(operationPtr))
-					{
-						// Check if the boolean values are greater than or equal to each other(true is > than false)
-						if (isBoolValue == true)
-						{
-							if ((firstBool == true && secondBool == true) || (secondBool == true && firstBool == false)
-								|| (secondBool == false && firstBool == false))
-							{
-								operands.push_back(make<Boolean>(true));
-								evaluated = true;
-								continue;
-							}
-							else
-							{
-								operands.push_back(make<Boolean>(false));
-								evaluated = true;
-								continue;
-							}
-						}
-						else if (isReal == false)
-						{
-							// check the integer values are greater than or equal
-							if (operandNumberSecond >= operandNumberFirst)
-							{
-								operands.push_back(make<Boolean>(true));
-								evaluated = true;
-								continue;
-							}
-							else
-							{
-								operands.push_back(make<Boolean>(false));
-								evaluated = true;
-								continue;
-							}
-						}
-						else if (isReal == true)
-						{
-							if (boolRealNumberFirst == true && boolNumberSecond == true)
-							{
-								// Variables to hold the result of the inequality operation, and to convert(lexical_cast) the
-								// operand numbers to be able to use the inequality operation;
-								valueSecond = boost::lexical_cast<Real::value_type>(operandNumberSecond);
-								Token::pointer_type realNumber = make<Real>(valueSecond);
-								valueSecond = get_value<Real>(realNumber);
-
-								if (valueSecond >= operandRealNumberFirst)
-								{
-									operands.push_back(make<Boolean>(true));
-									evaluated = true;
-									continue;
-								}
-								else
-								{
-									operands.push_back(make<Boolean>(false));
-									evaluated = true;
-									continue;
-								}
-							}
-							else if (boolRealNumberSecond == true && boolNumberFirst == true)
-							{
-								// Variables to hold the result of the inequality operation, and to convert(lexical_cast) the
-								// operand numbers to be able to use the inequality operation;
-								valueFirst = boost::lexical_cast<Real::value_type>(operandNumberFirst);
-								Token::pointer_type realNumber = make<Real>(valueFirst);
-								valueFirst = get_value<Real>(realNumber);
-
-								if (operandRealNumberSecond >= valueFirst)
-								{
-									operands.push_back(make<Boolean>(true));
-									evaluated = true;
-									continue;
-								}
-								else
-								{
-									operands.push_back(make<Boolean>(false));
-									evaluated = true;
-									continue;
-								}
-							}
-							else if (operandRealNumberSecond >= operandRealNumberFirst)
-							{
-								operands.push_back(make<Boolean>(true));
-								evaluated = true;
-								continue;
-							}
-							else
-							{
-								operands.push_back(make<Boolean>(false));
-								evaluated = true;
-								continue;
-							}
-						}
-					}
-					else if (is<Less>(operationPtr))
-					{
-						if (isBoolValue == true)
-						{
-							// Check the boolean values if they are less than. Only false is less than true
-							if ((firstBool == true && secondBool == true) || (firstBool == false && secondBool == true)
-								|| (firstBool == false && secondBool == false))
-							{
-								operands.push_back(make<Boolean>(false));
-								evaluated = true;
-								continue;
-							}
-							else if (secondBool == false && firstBool == true)
-							{
-								operands.push_back(make<Boolean>(true));
-								evaluated = true;
-								continue;
-							}
-						}
-						else if (isReal == false)
-						{
-							// check the integer values are less than
-							if (operandNumberSecond < operandNumberFirst)
-							{
-								operands.push_back(make<Boolean>(true));
-								evaluated = true;
-								continue;
-							}
-							else
-							{
-								operands.push_back(make<Boolean>(false));
-								evaluated = true;
-								continue;
-							}
-						}
-						else if (isReal == true)
-						{
-							if (boolRealNumberFirst == true && boolNumberSecond == true)
-							{
-								// Variables to hold the result of the less than operation, and to convert(lexical_cast) the
-								// operand numbers to be able to use the less than operation;
-								valueSecond = boost::lexical_cast<Real::value_type>(operandNumberSecond);
-								Token::pointer_type realNumber = make<Real>(valueSecond);
-								valueSecond = get_value<Real>(realNumber);
-
-								if (valueSecond < operandRealNumberFirst)
-								{
-									operands.push_back(make<Boolean>(true));
-									evaluated = true;
-									continue;
-								}
-								else
-								{
-									operands.push_back(make<Boolean>(false));
-									evaluated = true;
-									continue;
-								}
-							}
-							else if (boolRealNumberSecond == true && boolNumberFirst == true)
-							{
-								// Variables to hold the result of the less than operation, and to convert(lexical_cast) the
-								// operand numbers to be able to use the less than operation;
-								valueFirst = boost::lexical_cast<Real::value_type>(operandNumberFirst);
-								Token::pointer_type realNumber = make<Real>(valueFirst);
-								valueFirst = get_value<Real>(realNumber);
-
-								if (operandRealNumberSecond < valueFirst)
-								{
-									operands.push_back(make<Boolean>(true));
-									evaluated = true;
-									continue;
-								}
-								else
-								{
-									operands.push_back(make<Boolean>(false));
-									evaluated = true;
-									continue;
-								}
-							}
-							else if (operandRealNumberSecond < operandRealNumberFirst)
-							{
-								operands.push_back(make<Boolean>(true));
-								evaluated = true;
-								continue;
-							}
-							else
-							{
-								operands.push_back(make<Boolean>(false));
-								evaluated = true;
-								continue;
-							}
-						}
-					}
-					else if (is<LessEqual>(operationPtr))
-					{
-						if (isBoolValue == true)
-						{
-							if ((secondBool == false && firstBool == true) || (firstBool == false && secondBool == false)
-								|| (firstBool == true && secondBool == true))
-							{
-								operands.push_back(make<Boolean>(true));
-								evaluated = true;
-								continue;
-							}
-							else if (firstBool == false && secondBool == true)
-							{
-								operands.push_back(make<Boolean>(false));
-								evaluated = true;
-								continue;
-							}
-						}
-						else if (isReal == false)
-						{
-							// check the integer values are less than or equal
-							if (operandNumberSecond <= operandNumberFirst)
-							{
-								operands.push_back(make<Boolean>(true));
-								evaluated = true;
-								continue;
-							}
-							else
-							{
-								operands.push_back(make<Boolean>(false));
-								evaluated = true;
-								continue;
-							}
-						}
-						else if (isReal == true)
-						{
-							if (boolRealNumberFirst == true && boolNumberSecond == true)
-							{
-								// Variables to hold the result of the less than or equal to operation, and to convert(lexical_cast) the
-								// operand numbers to be able to use the less than or equal to operation;
-								valueSecond = boost::lexical_cast<Real::value_type>(operandNumberSecond);
-								Token::pointer_type realNumber = make<Real>(valueSecond);
-								valueSecond = get_value<Real>(realNumber);
-
-								if (valueSecond <= operandRealNumberFirst)
-								{
-									operands.push_back(make<Boolean>(true));
-									evaluated = true;
-									continue;
-								}
-								else
-								{
-									operands.push_back(make<Boolean>(false));
-									evaluated = true;
-									continue;
-								}
-							}
-							else if (operandRealNumberSecond > 0.0 && operandNumberFirst > 0)
-							{
-								// Variables to hold the result of the less than or equal to operation, and to convert(lexical_cast) the
-								// operand numbers to be able to use the less than or equal to operation;
-								valueFirst = boost::lexical_cast<Real::value_type>(operandNumberFirst);
-								Token::pointer_type realNumber = make<Real>(valueFirst);
-								valueFirst = get_value<Real>(realNumber);
-
-								if (operandRealNumberSecond <= valueFirst)
-								{
-									operands.push_back(make<Boolean>(true));
-									evaluated = true;
-									continue;
-								}
-								else
-								{
-									operands.push_back(make<Boolean>(false));
-									evaluated = true;
-									continue;
-								}
-							}
-							else if (operandRealNumberSecond <= operandRealNumberFirst)
-							{
-								operands.push_back(make<Boolean>(true));
-								evaluated = true;
-								continue;
-							}
-							else
-							{
-								operands.push_back(make<Boolean>(false));
-								evaluated = true;
-								continue;
-							}
-						}
-					}
-				}
+		string key;
+		if (instruction.opcode == opcode_type::OPERAND)
+		{
+			Operand const& operand = static_cast<Operand const&>(*instruction.token);
+			if (operand.get_kind() == operand_kind::VARIABLE)
+			{
+				node.pure = !assigns;
+				key = "v" + to_string(reinterpret_cast<uintptr_t>(instruction.token.get()));
 			}
-			// Check if the operation is a function
-			if (is<Function>(operationPtr))
+			else
+				key = "c" + to_string(static_cast<unsigned>(operand.get_kind())) + operand.to_string();
+		}
+		else
+		{
+			++operations;
+			node.pure = is_pure(instruction.opcode);
+			key = to_string(index_of(instruction.opcode));
+			for (size_t arg : node.args)
 			{
-				// If it is Absolute value perform the operation on it.
-				if (is<Abs>(operationPtr))
-				{
-					if (isReal == false)
-					{
-						if (operandNumberFirst > 0)
-						{
-							operands.push_back(make<Integer>(operandNumberFirst));
-							evaluated = true;
-							continue;
-						}
-						else if (operandNumberFirst < 0)
-						{
-							operandNumberFirst *= -1;
-							operands.push_back(make<Integer>(operandNumberFirst));
-							evaluated = true;
-							continue;
-						}
-					}
-					else if (isReal == true)
-					{
-						if (operandRealNumberFirst > 0)
-						{
-							operands.push_back(make<Real>(operandRealNumberFirst));
-							evaluated = true;
-							continue;
-						}
-						else if (operandRealNumberFirst < 0)
-						{
-							operandRealNumberFirst *= -1.0;
-							operands.push_back(make<Real>(operandRealNumberFirst));
-							evaluated = true;
-							continue;
-						}
-					}
-				}
-				else if (is<Fib>(operationPtr))
-				{
-					if (isReal == false)
-					{
-						// Variable to hold the returned value from the ifibonacci function
-						Integer::value_type result = ifibonacci(operandNumberFirst);
-
-						// Push result onto the operands stack(vector)
-						operands.push_back(make<Integer>(result));
-						evaluated = true;
-						continue;
-					}
-					else if (isReal == true)
-					{
-						// Variable to hold the returned value from the ifibonacci function
-						Real::value_type resultReal = ifibonacci(operandRealNumberFirst);
-
-						// Push result onto the operands stack(vector)
-						operands.push_back(make<Real>(resultReal));
-						evaluated = true;
-						continue;
-					}
-				}
-				else if (is<Pel>(operationPtr))
-				{
-					if (isReal == false)
-					{
-						// Variable to hold the returned value from the pell function
-						Integer::value_type result = pell(operandNumberFirst);
-
-						// Push result onto the operands stack(vector)
-						operands.push_back(make<Integer>(result));
-						evaluated = true;
-						continue;
-					}
-					else if (isReal == true)
-					{
-						// Variable to hold the returned value from the pell function
-						Real::value_type resultReal = pell(operandRealNumberFirst);
-
-						// Push result onto the operands stack(vector)
-						operands.push_back(make<Real>(resultReal));
-						evaluated = true;
-						continue;
-					}
-				}
-				else if (is<Syl>(operationPtr))
-				{
-					if (isReal == false)
-					{
-						// Variable to hold the returned value from the sylvester function
-						Integer::value_type result = sylvester(operandNumberFirst);
-
-						// Push result onto the operands stack(vector)
-						operands.push_back(make<Integer>(result));
-						evaluated = true;
-						continue;
-					}
-					else if (isReal == true)
-					{
-						// Variable to hold the returned value from the pell function
-						Real::value_type resultReal = sylvester(operandRealNumberFirst);
-
-						// Push result onto the operands stack(vector)
-						operands.push_back(make<Real>(resultReal));
-						evaluated = true;
-						continue;
-					}
-				}
-				else if (is<Arccos>(operationPtr))
-				{
-					if (isReal == true)
-					{
-						// Variable to hold the cast value and the returned value from the acos function
-						Real::value_type result = acos(operandRealNumberFirst);
-
-						// Push result onto the operands stack(vector)
-						operands.push_back(make<Real>(result));
-						evaluated = true;
-						continue;
-					}
-				}
-				else if (is<Arcsin>(operationPtr))
-				{
-					if (isReal == true)
-					{
-						// Variable to hold the cast value and the returned value from the acos function
-						Real::value_type result = asin(operandRealNumberFirst);
-
-						// Push result onto the operands stack(vector)
-						operands.push_back(make<Real>(result));
-						evaluated = true;
-						continue;
-					}
-				}
-				else if (is<Arctan>(operationPtr))
-				{
-					if (isReal == true)
-					{
-						// Variable to hold the cast value and the returned value from the acos function
-						Real::value_type result = atan(operandRealNumberFirst);
-
-						// Push result onto the operands stack(vector)
-						operands.push_back(make<Real>(result));
-						evaluated = true;
-						continue;
-					}
-				}
-				else if (is<Ceil>(operationPtr))
-				{
-					if (isReal == true)
-					{
-						// Variable to hold the cast value and the returned value from the acos function
-						Real::value_type result = ceil(operandRealNumberFirst);
-
-						// Push result onto the operands stack(vector)
-						operands.push_back(make<Real>(result));
-						evaluated = true;
-						continue;
-					}
-				}
-				else if (is<Cos>(operationPtr))
-				{
-					if (isReal == true)
-					{
-						// Variable to hold the cast value and the returned value from the acos function
-						Real::value_type result = cos(operandRealNumberFirst);
-
-						// Push result onto the operands stack(vector)
-						operands.push_back(make<Real>(result));
-						evaluated = true;
-						continue;
-					}
-				}
-				else if (is<Exp>(operationPtr))
-				{
-					 if (isReal == true)
-					{
-						// Variable to hold the cast value and the returned value from the acos function
-						Real::value_type result = exp(operandRealNumberFirst);
-
-						// Push result onto the operands stack(vector)
-						operands.push_back(make<Real>(result));
-						evaluated = true;
-						continue;
-					}
-				}
-				else if (is<Floor>(operationPtr))
-				{
-					if (isReal == true)
-					{
-						// Variable to hold the cast value and the returned value from the acos function
-						Real::value_type result = floor(operandRealNumberFirst);
-
-						// Push result onto the operands stack(vector)
-						operands.push_back(make<Real>(result));
-						evaluated = true;
-						continue;
-					}
-				}
-				else if (is<Lb>(operationPtr))
-				{
-					if (isReal == true)
-					{
-						// Variable to hold the cast value and the returned value from the acos function
-						Real::value_type result = log2(operandRealNumberFirst);
-
-						// Push result onto the operands stack(vector)
-						operands.push_back(make<Real>(result));
-						evaluated = true;
-						continue;
-					}
-				}
-				else if (is<Ln>(operationPtr))
-				{
-					if (isReal == true)
-					{
-						// Variable to hold the cast value and the returned value from the acos function
-						Real::value_type result = log10(operandRealNumberFirst);
-
-						// Push result onto the operands stack(vector)
-						operands.push_back(make<Real>(result));
-						evaluated = true;
-						continue;
-					}
-				}
-				else if (is<Sin>(operationPtr))
-				{
-					if (isReal == true)
-					{
-						// Variable to hold the cast value and the returned value from the acos function
-						Real::value_type result = sin(operandRealNumberFirst);
-
-						// Push result onto the operands stack(vector)
-						operands.push_back(make<Real>(result));
-						evaluated = true;
-						continue;
-					}
-				}
-				else if (is<Sqrt>(operationPtr))
-				{
-					if (isReal == true)
-					{
-						// Variable to hold the cast value and the returned value from the acos function
-						Real::value_type result = sqrt(operandRealNumberFirst);
-
-						// Push result onto the operands stack(vector)
-						operands.push_back(make<Real>(result));
-						evaluated = true;
-						continue;
-					}
-				}
-				else if (is<Sin>(operationPtr))
-				{
-					if (isReal == true)
-					{
-						// Variable to hold the cast value and the returned value from the acos function
-						//double tempFirstNum = boost::lexical_cast<double>(operandRealNumberFirst);
-						Real::value_type result = sin(operandRealNumberFirst);
-
-						// Push result onto the operands stack(vector)
-						operands.push_back(make<Real>(result));
-						evaluated = true;
-						continue;
-					}
-				}
-				else if (is<Tan>(operationPtr))
-				{
-					if (isReal == true)
-					{
-						// Variable to hold the cast value and the returned value from the acos function
-						Real::value_type result = tan(operandRealNumberFirst);
-
-						// Push result onto the operands stack(vector)
-						operands.push_back(make<Real>(result));
-						evaluated = true;
-						continue;
-					}
-				}
-				else if (is<Arctan2>(operationPtr))
-				{
-				if (isReal == true)
-				{
-					// Variable to hold the cast value and the returned value from the acos function
-					Real::value_type result = atan2(operandRealNumberSecond,operandRealNumberFirst);
+				node.pure = node.pure && nodes[arg].pure;
+				key += "," + to_string(arg);
+			}
+		}
 
-					// Push result onto the operands stack(vector)
-					operands.push_back(make<Real>(result));
-					evaluated = true;
-					continue;
-				}
-				}
-				else if (is<Max>(operationPtr))
-				{
-					// Variables to hold the lexical_cast numbers
-					Real::value_type resultReal;
-					Real::value_type valueFirst;
-					Real::value_type valueSecond;
-					
-					if(boolNumberFirst == true)
-					{
-						// Convert the first number to a real to be able to compare then values
-						valueFirst = boost::lexical_cast<Real::value_type>(operandNumberFirst);
-						Token::pointer_type realNumber = make<Real>(valueFirst);
-						valueFirst = get_value<Real>(realNumber);
-					}
-					
-					if (boolNumberSecond == true)
-					{
-						valueSecond = boost::lexical_cast<Real::value_type>(operandNumberSecond);
-						Token::pointer_type realNumber = make<Real>(valueSecond);
-						valueSecond = get_value<Real>(realNumber);
-					}
-
-
-					if (isReal == false)
-					{
-						if (operandNumberSecond > operandNumberFirst)
-						{
-							operands.push_back(make<Integer>(operandNumberSecond));
-							evaluated = true;
-							continue;
-						}
-						else if (operandNumberFirst > operandNumberSecond)
-						{
-							operands.push_back(make<Integer>(operandNumberFirst));
-							evaluated = true;
-							continue;
-						}
-						else if (operandNumberSecond == operandNumberFirst)
-						{
-							operands.push_back(make<Integer>(operandNumberFirst));
-							evaluated = true;
-							continue;
-						}
-
-					}
-					else if (isReal == true)
-					{
-						if(boolRealNumberFirst == true && boolRealNumberSecond == true)
-						{
-							if (operandRealNumberSecond > operandRealNumberFirst)
-							{
-								operands.push_back(make<Real>(operandRealNumberSecond));
-								evaluated = true;
-								continue;
-							}
-							else if (operandRealNumberSecond < operandRealNumberFirst)
-							{
-								operands.push_back(make<Real>(operandRealNumberFirst));
-								evaluated = true;
-								continue;
-							}
-							else if (operandRealNumberSecond == operandRealNumberFirst)
-							{
-								operands.push_back(make<Real>(operandRealNumberSecond));
-								evaluated = true;
-								continue;
-							}
-						}
-						
-						if(boolRealNumberSecond == true && boolNumberFirst == true)
-						{
-							if (operandRealNumberSecond > valueFirst)
-							{
-								operands.push_back(make<Real>(operandRealNumberSecond));
-								evaluated = true;
-								continue;
-							}
-							else if (operandRealNumberSecond < valueFirst)
-							{
-								operands.push_back(make<Real>(valueFirst));
-								evaluated = true;
-								continue;
-							}
-							else if (valueFirst == operandRealNumberSecond)
-							{
-								operands.push_back(make<Real>(valueFirst));
-								evaluated = true;
-								continue;
-							}
-						}
-						
-						if (boolNumberSecond == true && boolRealNumberFirst == true)
-						{
-							if (valueSecond > operandRealNumberFirst)
-							{
-								operands.push_back(make<Real>(valueSecond));
-								evaluated = true;
-								continue;
-							}
-							else if (valueSecond < operandRealNumberFirst)
-							{
-								operands.push_back(make<Real>(operandRealNumberFirst));
-								evaluated = true;
-								continue;
-							}
-							else if ((valueSecond == operandRealNumberFirst))
-							{
-								operands.push_back(make<Real>(valueSecond));
-								evaluated = true;
-								continue;
-							}
-						}	
-					}
-				}
-				else if (is<Min>(operationPtr))
-				{
-					// Variables to hold the lexical_cast numbers
-					Real::value_type resultReal;
-					Real::value_type valueFirst;
-					Real::value_type valueSecond;
-
-					if (boolNumberFirst == true)
-					{
-						// Convert the first number to a real to be able to compare then values
-						valueFirst = boost::lexical_cast<Real::value_type>(operandNumberFirst);
-						Token::pointer_type realNumber = make<Real>(valueFirst);
-						valueFirst = get_value<Real>(realNumber);
-					}
-
-					if (boolNumberSecond == true)
-					{
-						// Convert the first number to a real to be able to compare then values
-						valueSecond = boost::lexical_cast<Real::value_type>(operandNumberSecond);
-						Token::pointer_type realNumber = make<Real>(valueSecond);
-						valueSecond = get_value<Real>(realNumber);
-					}
-
-					if (isReal == false)
-					{
-						if (operandNumberSecond < operandNumberFirst)
-						{
-							operands.push_back(make<Integer>(operandNumberSecond));
-							evaluated = true;
-							continue;
-						}
-						else if (operandNumberFirst < operandNumberSecond)
-						{
-							operands.push_back(make<Integer>(operandNumberFirst));
-							evaluated = true;
-							continue;
-						}
-						else if (operandNumberSecond == operandNumberFirst)
-						{
-							operands.push_back(make<Integer>(operandNumberFirst));
-							evaluated = true;
-							continue;
-						}
-
-					}
-					else if (isReal == true)
-					{
-						if (boolRealNumberFirst == true && boolRealNumberSecond == true)
-						{
-							if (operandRealNumberSecond < operandRealNumberFirst)
-							{
-								operands.push_back(make<Real>(operandRealNumberSecond));
-								evaluated = true;
-								continue;
-							}
-							else if (operandRealNumberSecond > operandRealNumberFirst)
-							{
-								operands.push_back(make<Real>(operandRealNumberFirst));
-								evaluated = true;
-								continue;
-							}
-							else if (operandRealNumberSecond == operandRealNumberFirst)
-							{
-								operands.push_back(make<Real>(operandRealNumberSecond));
-								evaluated = true;
-								continue;
-							}
-						}
-
-						if (boolRealNumberFirst == true && boolNumberSecond == true)
-						{
-							if (operandRealNumberFirst < valueSecond)
-							{
-								operands.push_back(make<Real>(operandRealNumberFirst));
-								evaluated = true;
-								continue;
-							}
-							else if (operandRealNumberFirst > valueSecond)
-							{
-								operands.push_back(make<Real>(valueSecond));
-								evaluated = true;
-								continue;
-							}
-							else if (valueSecond == operandRealNumberFirst)
-							{
-								operands.push_back(make<Real>(valueSecond));
-								evaluated = true;
-								continue;
-							}
-						}
-						if (boolNumberFirst == true && boolRealNumberSecond == true)
-						{
-							if (valueFirst < operandRealNumberSecond)
-							{
-								operands.push_back(make<Real>(valueFirst));
-								evaluated = true;
-								continue;
-							}
-							else if (valueFirst > operandRealNumberSecond)
-							{
-								operands.push_back(make<Real>(operandRealNumberSecond));
-								evaluated = true;
-								continue;
-							}
-							else if ((valueFirst == operandRealNumberSecond))
-							{
-								operands.push_back(make<Real>(valueFirst));
-								evaluated = true;
-								continue;
-							}
-						}
-					}
-				}
-				// Check if the operator is the Power operation (2^4) = 16
-				if (is<Pow>(operationPtr))
-				{
-					// Variables to hold the lexical cast numbers
-					Real::value_type resultRealPower;
-					Real::value_type valueRealFirst;
-					Real::value_type valueRealSecond;
-
-					Integer::value_type resultIntegerPower;
-					Integer::value_type valueIntegerFirst;
-					Integer::value_type valueIntegerSecond;
-
-					// Check to see if the operands are only Integers
-					if (isReal == false)
-					{
-						// Variables to hold the result of the pow operations, and to convert(lexical_cast) the
-						// operand numbers to be able to use the pow() function;					
-						int powerNumber = boost::lexical_cast<int>(operandNumberFirst);
-
-						if (powerNumber < 0)
-						{
-							// Cast the base number to a Real number because if the exponent number(powerNum) is
-							// a negative number then the result will be a Real number
-							valueRealSecond = boost::lexical_cast<Real::value_type>(operandNumberSecond);
-							Token::pointer_type realNumber = make<Real>(valueRealSecond);
-							valueRealSecond = get_value<Real>(realNumber);
-
-							resultRealPower = boost::multiprecision::pow(valueRealSecond, powerNumber);
-
-							// Push the real number result onto the operand stack(vector)
-							operands.push_back(make<Real>(resultRealPower));
-							evaluated = true;
-							continue;
-						}
-						else if (powerNumber > 0)
-						{
-							// Calculate the power
-							resultIntegerPower = boost::multiprecision::pow(operandNumberSecond, powerNumber);
-
-							// Push the integer Result onto the operand stack(vector)
-							operands.push_back(make<Integer>(resultIntegerPower));
-							evaluated = true;
-							continue;
-						}
-						else if (powerNumber == 0)
-						{
-							// Push the integer Result onto the operand stack(vector)
-							operands.push_back(make<Integer>(1));
-							evaluated = true;
-							continue;
-						}
-					}
-					else if (isReal == true)
-					{
-
-						if (boolRealNumberFirst == true && boolNumberSecond == true)
-						{
-							// Variables to hold the result of the pow operations, and to convert(lexical_cast) the
-							// operand numbers to be able to use the pow() function;
-							int powerNumber = boost::lexical_cast<int>(operandRealNumberFirst);
-
-							valueRealFirst = boost::lexical_cast<Real::value_type>(operandNumberSecond);
-							Token::pointer_type realNumber = make<Real>(valueRealFirst);
-							valueRealFirst = get_value<Real>(realNumber);
-
-							Real::value_type realResult = boost::multiprecision::pow(valueRealFirst, powerNumber);
-
-							// Push the result onto the operands stack(vector)
-							operands.push_back(make<Real>(realResult));
-							evaluated = true;
-							continue;
-						}
-						else if (boolNumberFirst == true && boolRealNumberSecond == true)
-						{
-							// Variables to hold the result of the pow operations, and to convert(lexical_cast) the
-							// operand numbers to be able to use the pow() function;
-							int powerNumber = boost::lexical_cast<int>(operandNumberFirst);
-
-							Real::value_type realResult = pow(operandRealNumberSecond, powerNumber);
-
-							// Push the result onto the operands stack(vector)
-							operands.push_back(make<Real>(realResult));
-							evaluated = true;
-							continue;
-						}
-						else if (boolRealNumberSecond == true && boolRealNumberFirst == true)
-						{
-							// Get the result of the power of 2 real numbers
-							Real::value_type realResult = boost::multiprecision::pow(operandRealNumberSecond, operandRealNumberFirst);
-
-							// Push the result onto the operands stack(vector)
-							operands.push_back(make<Real>(realResult));
-							evaluated = true;
-							continue;
-						}
-						else
-						{
-							// Variables to hold the result of the pow operations, and to convert(lexical_cast) the
-							// operand numbers to be able to use the pow() function;
-							int powerNumber = boost::lexical_cast<int>(operandRealNumberFirst);
-
-							Real::value_type realResult = pow(operandRealNumberSecond, powerNumber);
-
-							// Push the result onto the operands stack(vector)
-							operands.push_back(make<Real>(realResult));
-							evaluated = true;
-							continue;
-						}
-					}
-				}
-				else if (is<Result>(operationPtr))
-				{
-				// Variables to hold the lexical cast numbers
-					Real::value_type resultRealPower;
-					Real::value_type valueRealFirst;
-					Real::value_type valueRealSecond;
-
-					Integer::value_type resultIntegerPower;
-					Integer::value_type valueIntegerFirst;
-					Integer::value_type valueIntegerSecond;
-
-					if (isReal == false)
-					{
-						if (boolNumberFirst == true)
-						{
-							operandNumberFirst *= 2;
-							operands.push_back(make<Integer>(operandNumberFirst));
-							evaluated = true;
-							continue;
-						}
-						else if (boolNumberSecond == true)
-						{
-							operandNumberSecond *= 2;
-							operands.push_back(make<Integer>(operandNumberSecond));
-							evaluated = true;
-							continue;
-						}
-					}
-					else if (isReal == true)
-					{
-						if (boolRealNumberFirst == true)
-						{
-							operandRealNumberFirst *= 2.0;
-							operands.push_back(make<Real>(operandRealNumberFirst));
-							evaluated = true;
-							continue;
-						}
-						else if (boolRealNumberSecond == true)
-						{
-							operandRealNumberSecond *= 2.0;
-							operands.push_back(make<Real>(operandRealNumberSecond));
-							evaluated = true;
-							continue;
-						}
-					}
-				}
+		if (node.pure)
+		{
+			auto found = ids.find(key);
+			if (found != ids.end())
+			{
+				stack.push_back(found->second);
+				continue;
 			}
+			ids.emplace(key, nodes.size());
 		}
+		stack.push_back(nodes.size());
+		nodes.push_back(move(node));
+	}
+
+	if (stack.size() != 1)
+		return program;
+
+	for (auto const& node : nodes)
+	{
+		if (node.instruction.opcode != opcode_type::OPERAND)
+			--operations;
+		for (size_t arg : node.args)
+			++nodes[arg].uses;
+	}
+	if (operations == 0)
+		return program;
+
+	program_type shared;
+	shared.reserve(program.size());
+	size_t temporaries = 0;
+	emit(nodes, stack.back(), shared, temporaries);
+	deduplicated = operations;
+	return shared;
+}
+
+
+
+/** Execute a program.
+	@return the final operand.
+	@param program [in] a program lowered by compile().
+	*/
+Operand::pointer_type RPNEvaluator::execute(program_type const& program) {
+	if (program.empty())
+	{
+		throw runtime_error("Error: insufficient operands");
+	}
+
+	Machine machine{ operand_stack_type(), results_, forgotten_, precision_, nullptr, nullptr, &reader_, operand_stack_type() };
+	machine.operands.reserve(program.size());
+
+	// One table lookup per instruction, regardless of the operation
+	for (auto const& instruction : program)
+	{
+		if (instruction.number_of_args > machine.operands.size())
+		{
+			throw runtime_error("Insufficient number of operands for operation");
+		}
+		if (stats_ == nullptr)
+			handlers[index_of(instruction.opcode)](machine, instruction);
+		else
+			counted(machine, instruction, *stats_);
 	}
 
 	// Throw exception if more than one operand is left after all of the evaluations
-	if (operands.size() > 1)
+	if (machine.operands.size() > 1)
 	{
-		throw exception("Error: too many operands");
+		throw runtime_error("Error: too many operands");
 	}
 
+	Operand::pointer_type finalResult = machine.operands.back();
+	results_.push_back(value_of(machine, finalResult));
+	forget();
+
+	return finalResult; // final evaluated result
+}
+
+
+
+Operand::pointer_type RPNEvaluator::evaluate(TokenList const& rpnExpression) {
+	return execute(compile(rpnExpression));
+}
+
 
-	Operand::pointer_type finalResult = dynamic_pointer_cast<Operand>(operands.back());
 
-	return  finalResult; // final evaluated result
+void RPNEvaluator::set_history_limit(size_t limit) {
+	historyLimit_ = limit;
+	forget();
 }
 
 
+
+/** Drop the oldest results beyond the history limit. */
+void RPNEvaluator::forget() {
+	while (results_.size() > historyLimit_)
+	{
+		results_.pop_front();
+		++forgotten_;
+	}
+}
+
+
+
 /*=============================================================
 
 Revision History
 
+Version 0.14.0: 2026-10-18
+The result history can be limited with set_history_limit(); result(n) keeps counting dropped results.
+
+Version 0.13.1: 2026-10-18
+share() emits the shared program with an explicit stack, so a deep expression cannot overflow the call stack.
+
+Version 0.13.0: 2026-10-18
+execute() takes the variables' snapshot through the evaluator's VariableStore::Reader.
+
+Version 0.12.0: 2026-10-18
+execute() records the operand stack depth and big integer/real operations when set_stats() is given.
+
+Version 0.11.0: 2026-10-18
+Errors are thrown as std::runtime_error (std::exception(const char*) is a Visual C++ extension).
+
+Version 0.10.0: 2026-10-18
+Integer and Real promotion, and power exponents, through numeric_conversion (range checked).
+
+Version 0.9.0: 2026-10-18
+Factorial by (parallel) product tree instead of a running product.
+
+Version 0.8.0: 2026-10-18
+fib and pel in O(log n) multiplications (fast doubling, Pell matrix squaring); syl updated in place.
+fib, pel and syl accept Real arguments.
+
+Version 0.7.0: 2026-10-18
+Added share(): repeated subexpressions are computed once and reused through LOAD/STORE temporaries.
+
+Version 0.6.0: 2026-10-18
+Added fold(): constant subexpressions are computed once, ahead of execution.
+
+Version 0.5.0: 2026-10-18
+Environment variables are read from one snapshot of their VariableStore per execution.
+
+Version 0.4.0: 2026-10-18
+Integer arithmetic and comparison on inline 64-bit values, promoted to cpp_int on overflow.
+
+Version 0.3.0: 2026-10-18
+One set of type tables per Real precision tier; literals and constants are converted to the evaluator's tier.
+
+Version 0.2.0: 2026-10-18
+Operand types resolved by [opcode][kind][kind] tables instead of is<T>() probes.
+
+Version 0.1.0: 2026-10-18
+Replaced the is<T>() if-chain with a program of opcodes dispatched through a lookup table.
+Implemented result(n) from the result history, Ln as the natural log and Log.
+
 Version 0.0.1: 2012-11-13
 C++ 11 cleanup
 
@@ -0,0 +1,71 @@
+/** @file: allocation_hooks.cpp
+	@author Chris Pollock
+	@version 0.0.0
+	@date 2026-10-18
+	@note Compiles under Visual C++ 15.4.4
+
+	@brief Replacement global operator new and delete that report to allocation_tracking.
+
+	Only the programs that count heap allocations link this file; see allocation_hooks.hpp.
+	*/
+
+#include "../inc/allocation_hooks.hpp"
+#include <cstdlib>
+#include <new>
+
+namespace {
+	void* tracked_allocate(std::size_t bytes) {
+		if (allocation_tracking::enabled())
+			allocation_tracking::record_heap(bytes);
+		if (void* block = std::malloc(bytes == 0 ? 1 : bytes))
+			return block;
+		throw std::bad_alloc();
+	}
+}
+
+
+
+bool allocation_tracking::hooks_linked() noexcept {
+	return true;
+}
+
+
+
+void* operator new(std::size_t bytes) { return tracked_allocate(bytes); }
+void* operator new[](std::size_t bytes) { return tracked_allocate(bytes); }
+void* operator new(std::size_t bytes, std::nothrow_t const&) noexcept {
+	try { return tracked_allocate(bytes); }
+	catch (...) { return nullptr; }
+}
+void* operator new[](std::size_t bytes, std::nothrow_t const&) noexcept {
+	try { return tracked_allocate(bytes); }
+	catch (...) { return nullptr; }
+}
+void operator delete(void* block) noexcept { std::free(block); }
+void operator delete[](void* block) noexcept { std::free(block); }
+void operator delete(void* block, std::size_t) noexcept { std::free(block); }
+void operator delete[](void* block, std::size_t) noexcept { std::free(block); }
+void operator delete(void* block, std::nothrow_t const&) noexcept { std::free(block); }
+void operator delete[](void* block, std::nothrow_t const&) noexcept { std::free(block); }
+
+
+
+/*=============================================================
+
+Revision History
+
+Version 0.0.0: 2026-10-18
+Alpha release.
+
+=============================================================
+
+Copyright Garth Santor/Trinh Han
+
+The copyright to the computer program(s) herein
+is the property of Garth Santor/Trinh Han of Canada.
+The program(s) may be used and/or copied only with
+the written permission of Garth Santor/Trinh Han
+or in accordance with the terms and conditions
+stipulated in the agreement/contract under which
+the program(s) have been supplied.
+=============================================================*/
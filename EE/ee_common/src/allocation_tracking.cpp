@@ -0,0 +1,182 @@
+/** @file: allocation_tracking.cpp
+	@author Chris Pollock
+	@version 0.0.0
+	@date 2026-10-18
+	@note Compiles under Visual C++ 15.4.4
+
+	@brief Allocation accounting implementation.
+	*/
+
+#include "../inc/allocation_tracking.hpp"
+#include <algorithm>
+#include <boost/core/demangle.hpp>
+using namespace std;
+using namespace allocation_tracking;
+
+
+
+char const* phase_name(allocation_phase phase) {
+	static char const* const names[ALLOCATION_PHASE_COUNT] = { "other", "tokenize", "parse", "compile", "evaluate", "format" };
+	return names[index_of(phase)];
+}
+
+
+
+atomic<bool> allocation_tracking::detail::isEnabled(false);
+
+namespace {
+	struct AtomicCounts {
+		atomic<uint64_t>	allocations;
+		atomic<uint64_t>	bytes;
+
+		void add(size_t size) {
+			allocations.fetch_add(1, memory_order_relaxed);
+			bytes.fetch_add(size, memory_order_relaxed);
+		}
+		Counts load() const { return Counts{ allocations.load(memory_order_relaxed), bytes.load(memory_order_relaxed) }; }
+		void clear() {
+			allocations.store(0, memory_order_relaxed);
+			bytes.store(0, memory_order_relaxed);
+		}
+	};
+
+	// A token type's counters.  A slot is claimed by the first allocation of its type and keeps it.
+	struct TypeSlot {
+		atomic<type_info const*>	type;
+		AtomicCounts				counts;
+	};
+
+	// Enough for every token class; allocations of types beyond it are counted by phase only
+	size_t const TYPE_SLOTS = 64;
+
+	// Zero initialized before any dynamic initialization, so allocations made during start up can be counted
+	AtomicCounts	heapCounts[ALLOCATION_PHASE_COUNT];
+	AtomicCounts	tokenCounts[ALLOCATION_PHASE_COUNT];
+	TypeSlot		typeSlots[TYPE_SLOTS];
+
+	thread_local allocation_phase currentPhase = allocation_phase::OTHER;
+
+	// Finds the slot of 'type', claiming a free one the first time
+	TypeSlot* slot_of(type_info const& type) {
+		for (auto& slot : typeSlots) {
+			type_info const* claimed = slot.type.load(memory_order_acquire);
+			if (claimed == nullptr && slot.type.compare_exchange_strong(claimed, &type, memory_order_acq_rel))
+				return &slot;
+			if (*claimed == type)
+				return &slot;
+		}
+		return nullptr;
+	}
+
+	// Visual C++ names are "class X", other compilers' are mangled
+	string type_name(type_info const& type) {
+		string name = boost::core::demangle(type.name());
+		string const prefix("class ");
+		if (name.compare(0, prefix.size(), prefix) == 0)
+			name.erase(0, prefix.size());
+		return name;
+	}
+
+	Counts sum(array<Counts, ALLOCATION_PHASE_COUNT> const& counts) {
+		Counts total = { 0, 0 };
+		for (auto const& c : counts) {
+			total.allocations += c.allocations;
+			total.bytes += c.bytes;
+		}
+		return total;
+	}
+}
+
+
+
+Counts PhaseCounts::heap_total() const { return sum(heap); }
+Counts PhaseCounts::tokens_total() const { return sum(tokens); }
+
+
+
+void allocation_tracking::enable(bool enable) noexcept {
+	detail::isEnabled.store(enable, memory_order_relaxed);
+}
+
+void allocation_tracking::reset() noexcept {
+	for (size_t phase = 0; phase < ALLOCATION_PHASE_COUNT; ++phase) {
+		heapCounts[phase].clear();
+		tokenCounts[phase].clear();
+	}
+	for (auto& slot : typeSlots)
+		slot.counts.clear();
+}
+
+PhaseCounts allocation_tracking::by_phase() noexcept {
+	PhaseCounts counts;
+	for (size_t phase = 0; phase < ALLOCATION_PHASE_COUNT; ++phase) {
+		counts.heap[phase] = heapCounts[phase].load();
+		counts.tokens[phase] = tokenCounts[phase].load();
+	}
+	return counts;
+}
+
+vector<TypeCounts> allocation_tracking::by_token_type() {
+	vector<TypeCounts> types;
+	for (auto const& slot : typeSlots) {
+		type_info const* type = slot.type.load(memory_order_acquire);
+		if (type == nullptr)
+			break;
+		Counts const counts = slot.counts.load();
+		if (counts.allocations != 0)
+			types.push_back(TypeCounts{ type_name(*type), counts });
+	}
+	sort(types.begin(), types.end(), [](TypeCounts const& a, TypeCounts const& b) { return a.name < b.name; });
+	return types;
+}
+
+allocation_phase allocation_tracking::current_phase() noexcept {
+	return currentPhase;
+}
+
+void allocation_tracking::record_heap(size_t bytes) noexcept {
+	heapCounts[index_of(currentPhase)].add(bytes);
+}
+
+void allocation_tracking::record_token(type_info const& type, size_t bytes) noexcept {
+	tokenCounts[index_of(currentPhase)].add(bytes);
+	if (TypeSlot* slot = slot_of(type))
+		slot->counts.add(bytes);
+}
+
+
+
+PhaseScope::PhaseScope(allocation_phase phase) noexcept
+	: previous_(currentPhase) {
+	currentPhase = phase;
+}
+
+PhaseScope::~PhaseScope() {
+	currentPhase = previous_;
+}
+
+void PhaseScope::enter(allocation_phase phase) noexcept {
+	currentPhase = phase;
+}
+
+
+
+/*=============================================================
+
+Revision History
+
+Version 0.0.0: 2026-10-18
+Alpha release.
+
+=============================================================
+
+Copyright Garth Santor/Trinh Han
+
+The copyright to the computer program(s) herein
+is the property of Garth Santor/Trinh Han of Canada.
+The program(s) may be used and/or copied only with
+the written permission of Garth Santor/Trinh Han
+or in accordance with the terms and conditions
+stipulated in the agreement/contract under which
+the program(s) have been supplied.
+=============================================================*/
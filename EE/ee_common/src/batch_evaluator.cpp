@@ -0,0 +1,637 @@
+/** @file: batch_evaluator.cpp
+	@author Chris Pollock
+	@version 0.3.0
+	@date 2026-10-18
+	@note Compiles under Visual C++ 15.4.4
+
+	@brief BatchEvaluator class implementation.
+	*/
+
+#include "../inc/batch_evaluator.hpp"
+#include "../inc/boolean.hpp"
+#include "../inc/integer.hpp"
+#include "../inc/real.hpp"
+#include "../inc/variable.hpp"
+#include "../inc/variable_store.hpp"
+#include <algorithm>
+#include <array>
+#include <cstring>
+#include <exception>
+#include <limits>
+#include <stdexcept>
+using namespace std;
+
+namespace {
+	std::size_t const KIND_COUNT = 3;
+
+	std::size_t index_of(column_kind kind) { return static_cast<std::size_t>(kind); }
+
+	std::size_t element_size(column_kind kind)
+	{
+		return kind == column_kind::INTEGER ? sizeof(column_integer_type) : kind == column_kind::REAL ? sizeof(column_real_type) : sizeof(column_boolean_type);
+	}
+
+
+
+	/** Block kernel: computes 'count' rows of 'out' from the rows of 'lhs' (and 'rhs' for binary operations).
+		'out' may be the same block as 'lhs'.
+		*/
+	using kernel_type = void(*)(void const* lhs, void const* rhs, void* out, std::size_t count);
+
+	struct Kernel {
+		kernel_type	fn;
+		column_kind	kind;	// of the result
+	};
+
+
+
+	// The kernels are plain loops over contiguous rows with no branches in the loop body,
+	// so that the compiler vectorizes them for the target instruction set.
+	template <typename OP, typename V, typename L, typename T>
+	void unary_kernel(void const* operand, void const*, void* out, std::size_t count)
+	{
+		L const* x = static_cast<L const*>(operand);
+		T* o = static_cast<T*>(out);
+		for (std::size_t i = 0; i < count; ++i)
+			o[i] = static_cast<T>(OP()(static_cast<V>(x[i])));
+	}
+
+	template <typename OP, typename V, typename L, typename R, typename T>
+	void binary_kernel(void const* lhs, void const* rhs, void* out, std::size_t count)
+	{
+		L const* l = static_cast<L const*>(lhs);
+		R const* r = static_cast<R const*>(rhs);
+		T* o = static_cast<T*>(out);
+		for (std::size_t i = 0; i < count; ++i)
+			o[i] = static_cast<T>(OP()(static_cast<V>(l[i]), static_cast<V>(r[i])));
+	}
+
+	// 64-bit Integer arithmetic.  OP::checked() sets the sign bit of 'overflow' if a row's result does not fit.
+	using small_type = column_integer_type;
+	small_type const SMALL_MIN = (numeric_limits<small_type>::min)();
+
+	[[noreturn]] void integer_overflow()
+	{
+		throw runtime_error("Error: integer overflow or division by zero.");
+	}
+
+	template <typename OP>
+	void integer_kernel(void const* lhs, void const* rhs, void* out, std::size_t count)
+	{
+		small_type const* l = static_cast<small_type const*>(lhs);
+		small_type const* r = static_cast<small_type const*>(rhs);
+		small_type* o = static_cast<small_type*>(out);
+		small_type overflow = 0;
+		for (std::size_t i = 0; i < count; ++i)
+			o[i] = OP::checked(l[i], r[i], overflow);
+		if (overflow < 0)
+			integer_overflow();
+	}
+
+	void integer_negate_kernel(void const* operand, void const*, void* out, std::size_t count)
+	{
+		small_type const* x = static_cast<small_type const*>(operand);
+		small_type* o = static_cast<small_type*>(out);
+		small_type overflow = 0;
+		for (std::size_t i = 0; i < count; ++i)
+		{
+			overflow |= -small_type(x[i] == SMALL_MIN);
+			o[i] = small_type(0 - static_cast<uint64_t>(x[i]));
+		}
+		if (overflow < 0)
+			integer_overflow();
+	}
+
+	void copy_kernel_integer(void const* operand, void const*, void* out, std::size_t count) { memmove(out, operand, count * sizeof(column_integer_type)); }
+	void copy_kernel_real(void const* operand, void const*, void* out, std::size_t count) { memmove(out, operand, count * sizeof(column_real_type)); }
+
+
+
+	// Arithmetic
+	struct AddOp {
+		template <typename T> T operator()(T lhs, T rhs) const { return lhs + rhs; }
+		static small_type checked(small_type lhs, small_type rhs, small_type& overflow) {
+			small_type result = small_type(static_cast<uint64_t>(lhs) + static_cast<uint64_t>(rhs));
+			overflow |= (lhs ^ result) & (rhs ^ result);
+			return result;
+		}
+	};
+	struct SubtractOp {
+		template <typename T> T operator()(T lhs, T rhs) const { return lhs - rhs; }
+		static small_type checked(small_type lhs, small_type rhs, small_type& overflow) {
+			small_type result = small_type(static_cast<uint64_t>(lhs) - static_cast<uint64_t>(rhs));
+			overflow |= (lhs ^ rhs) & (lhs ^ result);
+			return result;
+		}
+	};
+	struct MultiplyOp {
+		template <typename T> T operator()(T lhs, T rhs) const { return lhs * rhs; }
+		static small_type checked(small_type lhs, small_type rhs, small_type& overflow) {
+			small_type result;
+#if defined(__GNUC__) || defined(__clang__)
+			overflow |= -small_type(__builtin_mul_overflow(lhs, rhs, &result));
+#else
+			small_type const SMALL_MAX = (numeric_limits<small_type>::max)();
+			bool const overflows = lhs > 0 ? (rhs > 0 ? lhs > SMALL_MAX / rhs : rhs < SMALL_MIN / lhs)
+										   : (rhs > 0 ? lhs < SMALL_MIN / rhs : lhs != 0 && rhs < SMALL_MAX / lhs);
+			overflow |= -small_type(overflows);
+			result = small_type(static_cast<uint64_t>(lhs) * static_cast<uint64_t>(rhs));
+#endif
+			return result;
+		}
+	};
+	struct DivideOp {
+		template <typename T> T operator()(T lhs, T rhs) const { return lhs / rhs; }
+		static small_type checked(small_type lhs, small_type rhs, small_type& overflow) {
+			bool const bad = rhs == 0 || (lhs == SMALL_MIN && rhs == -1);
+			overflow |= -small_type(bad);
+			return lhs / (bad ? 1 : rhs);
+		}
+	};
+	struct ModulusOp {
+		static small_type checked(small_type lhs, small_type rhs, small_type& overflow) {
+			bool const bad = rhs == 0 || (lhs == SMALL_MIN && rhs == -1);
+			overflow |= -small_type(bad);
+			return lhs % (bad ? 1 : rhs);
+		}
+	};
+	struct NegateOp { template <typename T> T operator()(T x) const { return -x; } };
+
+	// Comparisons
+	struct EqualOp { template <typename T> bool operator()(T lhs, T rhs) const { return lhs == rhs; } };
+	struct NotEqualOp { template <typename T> bool operator()(T lhs, T rhs) const { return lhs != rhs; } };
+	struct GreaterOp { template <typename T> bool operator()(T lhs, T rhs) const { return lhs > rhs; } };
+	struct GreaterEqualOp { template <typename T> bool operator()(T lhs, T rhs) const { return lhs >= rhs; } };
+	struct LessOp { template <typename T> bool operator()(T lhs, T rhs) const { return lhs < rhs; } };
+	struct LessEqualOp { template <typename T> bool operator()(T lhs, T rhs) const { return lhs <= rhs; } };
+
+	// Logical operations on 0/1 bytes, without branches
+	using boolean_type = column_boolean_type;
+	struct AndOp { boolean_type operator()(boolean_type lhs, boolean_type rhs) const { return lhs & rhs; } };
+	struct NandOp { boolean_type operator()(boolean_type lhs, boolean_type rhs) const { return (lhs & rhs) ^ 1; } };
+	struct OrOp { boolean_type operator()(boolean_type lhs, boolean_type rhs) const { return lhs | rhs; } };
+	struct NorOp { boolean_type operator()(boolean_type lhs, boolean_type rhs) const { return (lhs | rhs) ^ 1; } };
+	struct XorOp { boolean_type operator()(boolean_type lhs, boolean_type rhs) const { return lhs ^ rhs; } };
+	struct XnorOp { boolean_type operator()(boolean_type lhs, boolean_type rhs) const { return (lhs ^ rhs) ^ 1; } };
+	struct NotOp { boolean_type operator()(boolean_type x) const { return x ^ 1; } };
+
+
+
+	/** Kernels of the unary operations, indexed by [opcode][operand kind]. */
+	using unary_row_type = array<Kernel, KIND_COUNT>;
+	using unary_table_type = array<unary_row_type, OPCODE_COUNT>;
+
+	std::size_t const INTEGER = index_of(column_kind::INTEGER);
+	std::size_t const REAL = index_of(column_kind::REAL);
+	std::size_t const BOOLEAN = index_of(column_kind::BOOLEAN);
+
+	using integer_type = column_integer_type;
+	using real_type = column_real_type;
+
+	unary_table_type make_unary_table()
+	{
+		unary_table_type table = {};
+
+		table[index_of(opcode_type::IDENTITY)][INTEGER] = { &copy_kernel_integer, column_kind::INTEGER };
+		table[index_of(opcode_type::IDENTITY)][REAL] = { &copy_kernel_real, column_kind::REAL };
+		table[index_of(opcode_type::NEGATION)][INTEGER] = { &integer_negate_kernel, column_kind::INTEGER };
+		table[index_of(opcode_type::NEGATION)][REAL] = { &unary_kernel<NegateOp, real_type, real_type, real_type>, column_kind::REAL };
+		table[index_of(opcode_type::NOT)][BOOLEAN] = { &unary_kernel<NotOp, boolean_type, boolean_type, boolean_type>, column_kind::BOOLEAN };
+
+		return table;
+	}
+
+	unary_table_type const unaryKernels = make_unary_table();
+
+
+
+	/** Kernels of the binary operations, indexed by [opcode][lhs kind][rhs kind]. */
+	using binary_row_type = array<array<Kernel, KIND_COUNT>, KIND_COUNT>;
+	using binary_table_type = array<binary_row_type, OPCODE_COUNT>;
+
+	// Integer op Integer is an Integer, any other numeric combination is a Real
+	template <typename OP>
+	void set_arithmetic(binary_row_type& row)
+	{
+		row[INTEGER][INTEGER] = { &integer_kernel<OP>, column_kind::INTEGER };
+		row[INTEGER][REAL] = { &binary_kernel<OP, real_type, integer_type, real_type, real_type>, column_kind::REAL };
+		row[REAL][INTEGER] = { &binary_kernel<OP, real_type, real_type, integer_type, real_type>, column_kind::REAL };
+		row[REAL][REAL] = { &binary_kernel<OP, real_type, real_type, real_type, real_type>, column_kind::REAL };
+	}
+
+	// Numbers compare by value (mixed operands as Reals), Booleans with false < true
+	template <typename OP>
+	void set_relational(binary_row_type& row)
+	{
+		row[INTEGER][INTEGER] = { &binary_kernel<OP, integer_type, integer_type, integer_type, boolean_type>, column_kind::BOOLEAN };
+		row[INTEGER][REAL] = { &binary_kernel<OP, real_type, integer_type, real_type, boolean_type>, column_kind::BOOLEAN };
+		row[REAL][INTEGER] = { &binary_kernel<OP, real_type, real_type, integer_type, boolean_type>, column_kind::BOOLEAN };
+		row[REAL][REAL] = { &binary_kernel<OP, real_type, real_type, real_type, boolean_type>, column_kind::BOOLEAN };
+		row[BOOLEAN][BOOLEAN] = { &binary_kernel<OP, boolean_type, boolean_type, boolean_type, boolean_type>, column_kind::BOOLEAN };
+	}
+
+	template <typename OP>
+	void set_logical(binary_row_type& row)
+	{
+		row[BOOLEAN][BOOLEAN] = { &binary_kernel<OP, boolean_type, boolean_type, boolean_type, boolean_type>, column_kind::BOOLEAN };
+	}
+
+	binary_table_type make_binary_table()
+	{
+		binary_table_type table = {};
+
+		set_arithmetic<AddOp>(table[index_of(opcode_type::ADDITION)]);
+		set_arithmetic<SubtractOp>(table[index_of(opcode_type::SUBTRACTION)]);
+		set_arithmetic<MultiplyOp>(table[index_of(opcode_type::MULTIPLICATION)]);
+		set_arithmetic<DivideOp>(table[index_of(opcode_type::DIVISION)]);
+		table[index_of(opcode_type::MODULUS)][INTEGER][INTEGER] = { &integer_kernel<ModulusOp>, column_kind::INTEGER };
+
+		set_logical<AndOp>(table[index_of(opcode_type::AND)]);
+		set_logical<NandOp>(table[index_of(opcode_type::NAND)]);
+		set_logical<OrOp>(table[index_of(opcode_type::OR)]);
+		set_logical<NorOp>(table[index_of(opcode_type::NOR)]);
+		set_logical<XorOp>(table[index_of(opcode_type::XOR)]);
+		set_logical<XnorOp>(table[index_of(opcode_type::XNOR)]);
+
+		set_relational<EqualOp>(table[index_of(opcode_type::EQUALITY)]);
+		set_relational<NotEqualOp>(table[index_of(opcode_type::INEQUALITY)]);
+		set_relational<GreaterOp>(table[index_of(opcode_type::GREATER)]);
+		set_relational<GreaterEqualOp>(table[index_of(opcode_type::GREATER_EQUAL)]);
+		set_relational<LessOp>(table[index_of(opcode_type::LESS)]);
+		set_relational<LessEqualOp>(table[index_of(opcode_type::LESS_EQUAL)]);
+
+		return table;
+	}
+
+	binary_table_type const binaryKernels = make_binary_table();
+
+
+
+	// Throw the 'cannot perform' error for an operation token
+	[[noreturn]] void cannot_perform(Token::pointer_type const& operation)
+	{
+		string message = "Error: cannot perform " + operation->to_string();
+		throw runtime_error(message.c_str());
+	}
+
+	// Per block working storage for one stack slot, one block for each kind
+	struct Scratch {
+		column_integer_type	integers[BatchEvaluator::BLOCK_SIZE];
+		column_real_type	reals[BatchEvaluator::BLOCK_SIZE];
+		column_boolean_type	booleans[BatchEvaluator::BLOCK_SIZE];
+
+		void* block(column_kind kind) {
+			return kind == column_kind::INTEGER ? static_cast<void*>(integers) : kind == column_kind::REAL ? static_cast<void*>(reals) : static_cast<void*>(booleans);
+		}
+	};
+
+	void const* element(ColumnView const& column, std::size_t row)
+	{
+		switch (column.get_kind())
+		{
+		case column_kind::INTEGER:	return column.integers() + row;
+		case column_kind::REAL:		return column.reals() + row;
+		default:					return column.booleans() + row;
+		}
+	}
+
+	void const* element(Column const& column, std::size_t row)
+	{
+		switch (column.get_kind())
+		{
+		case column_kind::INTEGER:	return column.integers().data() + row;
+		case column_kind::REAL:		return column.reals().data() + row;
+		default:					return column.booleans().data() + row;
+		}
+	}
+
+	void* element(Column& column, std::size_t row)
+	{
+		switch (column.get_kind())
+		{
+		case column_kind::INTEGER:	return column.integers().data() + row;
+		case column_kind::REAL:		return column.reals().data() + row;
+		default:					return column.booleans().data() + row;
+		}
+	}
+}
+
+
+
+std::size_t const BatchEvaluator::BLOCK_SIZE;
+
+
+
+/** The program typed against the bound columns. */
+struct BatchEvaluator::Plan {
+	enum class action_type : unsigned char { COLUMN, CONSTANT, UNARY, BINARY, STORE, LOAD };
+
+	struct Step {
+		action_type			action;
+		column_kind			kind;		// of the result
+		std::size_t			slot;		// stack slot of the result (the first argument's slot)
+		kernel_type			kernel;		// UNARY, BINARY
+		ColumnView const*	column;		// COLUMN
+		std::size_t			constant;	// CONSTANT: index into constants; STORE, LOAD: index of the temporary
+	};
+
+	std::vector<Step>	steps;
+	std::vector<Column>	constants;		// one block of each broadcast constant
+	std::size_t			temporaries;	// blocks kept for shared subexpressions
+	std::size_t			depth;			// stack slots needed
+	column_kind			kind;			// of the result
+};
+
+
+
+/** Create a batch evaluator for a compiled expression.
+	@param compiled [in] the expression.  Its variables can be bound to columns by name.
+	*/
+BatchEvaluator::BatchEvaluator(CompiledExpression const& compiled)
+	: program_(compiled.get_program())
+	, names_(compiled.get_program().size())
+{
+	for (auto const& binding : compiled.get_bindings())
+		names_[binding.position] = binding.name;
+}
+
+
+
+/** Bind a variable to a column.
+	@param name [in] the variable's name.
+	@param column [in] the column.  Must stay valid while the evaluator is used.
+	@note Throws if the column's length differs from the columns already bound.
+	*/
+void BatchEvaluator::bind(string_type const& name, ColumnView column) {
+	for (auto const& bound : columns_)
+		if (bound.first != name && bound.second.size() != column.size())
+			throw runtime_error("Error: column length differs from the bound columns.");
+	auto found = columns_.find(name);
+	if (found != columns_.end())
+		found->second = column;
+	else
+		columns_.emplace(name, column);
+}
+
+
+
+std::size_t BatchEvaluator::rows() const {
+	return columns_.empty() ? 0 : columns_.begin()->second.size();
+}
+
+
+
+column_kind BatchEvaluator::result_kind() const {
+	return make_plan().kind;
+}
+
+
+
+/** Type the program against the bound columns.
+	@return the steps, each with its kernel and result kind.
+	@note Throws if an operation has no batch kernel for its operand kinds.
+	*/
+BatchEvaluator::Plan BatchEvaluator::make_plan() const {
+	Plan plan;
+	plan.depth = 0;
+	plan.temporaries = 0;
+	vector<column_kind> temporaries;	// kind of each shared subexpression
+	vector<column_kind> kinds;	// the operand stack, by kind
+
+	// Unbound environment variables are read from one snapshot of their store
+	VariableStore* store = nullptr;
+	VariableStore::snapshot_pointer snapshot;
+
+	for (size_t i = 0; i < program_.size(); ++i)
+	{
+		RPNEvaluator::Instruction const& instruction = program_[i];
+		Plan::Step step = { Plan::action_type::CONSTANT, column_kind::REAL, kinds.size(), nullptr, nullptr, 0 };
+
+		if (instruction.opcode == opcode_type::OPERAND)
+		{
+			auto bound = names_[i].empty() ? columns_.end() : columns_.find(names_[i]);
+			if (bound != columns_.end())
+			{
+				step.action = Plan::action_type::COLUMN;
+				step.kind = bound->second.get_kind();
+				step.column = &bound->second;
+			}
+			else
+			{
+				// Anything else is the same for every row: a block of copies is built once
+				Operand::pointer_type value = static_pointer_cast<Operand>(instruction.token);
+				if (value->get_kind() == operand_kind::VARIABLE)
+				{
+					Variable const& variable = static_cast<Variable const&>(*value);
+					if (variable.get_store() == nullptr)
+						value = variable.get_value();
+					else
+					{
+						if (variable.get_store() != store)
+						{
+							store = variable.get_store();
+							snapshot = store->snapshot();
+						}
+						value = snapshot->value(variable.get_slot());
+					}
+				}
+				if (!value)
+					throw runtime_error("Error: variable not initialized.");
+
+				Column constant;
+				switch (value->get_kind())
+				{
+				case operand_kind::INTEGER:
+				{
+					Integer const& integer = static_cast<Integer const&>(*value);
+					if (!integer.is_small())
+						throw runtime_error("Error: integer too large for a batch column.");
+					constant.reset(column_kind::INTEGER, BLOCK_SIZE);
+					fill(constant.integers().begin(), constant.integers().end(), integer.get_small());
+					break;
+				}
+				case operand_kind::REAL:
+					constant.reset(column_kind::REAL, BLOCK_SIZE);
+					fill(constant.reals().begin(), constant.reals().end(), static_cast<Real const&>(*value).get_value_as<double>());
+					break;
+				case operand_kind::BOOLEAN:
+					constant.reset(column_kind::BOOLEAN, BLOCK_SIZE);
+					fill(constant.booleans().begin(), constant.booleans().end(), column_boolean_type(static_cast<Boolean const&>(*value).get_value()));
+					break;
+				default:
+					cannot_perform(instruction.token);
+				}
+				step.kind = constant.get_kind();
+				step.constant = plan.constants.size();
+				plan.constants.push_back(move(constant));
+			}
+			kinds.push_back(step.kind);
+		}
+		else if (instruction.opcode == opcode_type::LOAD)
+		{
+			step.action = Plan::action_type::LOAD;
+			step.kind = temporaries[instruction.temporary];
+			step.constant = instruction.temporary;
+			kinds.push_back(step.kind);
+		}
+		else if (instruction.opcode == opcode_type::STORE)
+		{
+			if (kinds.empty())
+				throw runtime_error("Insufficient number of operands for operation");
+			if (instruction.temporary >= temporaries.size())
+				temporaries.resize(instruction.temporary + 1);
+			temporaries[instruction.temporary] = kinds.back();
+			step.action = Plan::action_type::STORE;
+			step.kind = kinds.back();
+			step.slot = kinds.size() - 1;
+			step.constant = instruction.temporary;
+		}
+		else
+		{
+			if (instruction.number_of_args > kinds.size())
+				throw runtime_error("Insufficient number of operands for operation");
+
+			Kernel kernel = {};
+			if (instruction.number_of_args == 1)
+			{
+				step.action = Plan::action_type::UNARY;
+				kernel = unaryKernels[index_of(instruction.opcode)][index_of(kinds.back())];
+			}
+			else if (instruction.number_of_args == 2)
+			{
+				step.action = Plan::action_type::BINARY;
+				kernel = binaryKernels[index_of(instruction.opcode)][index_of(kinds[kinds.size() - 2])][index_of(kinds.back())];
+			}
+			if (kernel.fn == nullptr)
+				cannot_perform(instruction.token);
+
+			kinds.resize(kinds.size() - instruction.number_of_args);
+			step.slot = kinds.size();
+			step.kind = kernel.kind;
+			step.kernel = kernel.fn;
+			kinds.push_back(kernel.kind);
+		}
+
+		plan.depth = (max)(plan.depth, kinds.size());
+		plan.steps.push_back(step);
+	}
+
+	if (kinds.empty())
+		throw runtime_error("Error: insufficient operands");
+	if (kinds.size() > 1)
+		throw runtime_error("Error: too many operands");
+
+	plan.kind = kinds.back();
+	plan.temporaries = temporaries.size();
+	return plan;
+}
+
+
+
+/** Evaluate every row.
+	@param out [out] the result column, one row per input row.
+	*/
+void BatchEvaluator::evaluate(Column& out) const {
+	Plan plan = make_plan();
+	out.reset(plan.kind, rows());
+	run(plan, 0, rows(), out);
+}
+
+
+
+/** Evaluate a range of rows.
+	@param first [in] the first row.
+	@param last [in] one past the last row.
+	@param out [in,out] the result column.  Only rows [first, last) are written.
+	*/
+void BatchEvaluator::evaluate(std::size_t first, std::size_t last, Column& out) const {
+	Plan plan = make_plan();
+	if (first > last || last > rows())
+		throw runtime_error("Error: row range out of bounds.");
+	if (out.get_kind() != plan.kind || out.size() < last)
+		throw runtime_error("Error: output column does not match the expression.");
+	run(plan, first, last, out);
+}
+
+
+
+/** Run the plan a block at a time.
+	Slot n of the operand stack is a pointer to a block: rows of a bound column, a constant block,
+	or the result block of an earlier step.  The last step writes straight into 'out'.
+	*/
+void BatchEvaluator::run(Plan const& plan, std::size_t first, std::size_t last, Column& out) const {
+	struct Slot {
+		column_kind	kind;
+		void const*	block;
+	};
+	vector<Scratch> scratch(plan.depth);
+	vector<Scratch> temporaries(plan.temporaries);
+	vector<Slot> slots(plan.depth);
+
+	for (size_t row = first; row < last; row += BLOCK_SIZE)
+	{
+		size_t const count = (min)(BLOCK_SIZE, last - row);
+
+		for (size_t i = 0; i < plan.steps.size(); ++i)
+		{
+			Plan::Step const& step = plan.steps[i];
+			Slot& slot = slots[step.slot];
+			switch (step.action)
+			{
+			case Plan::action_type::COLUMN:
+				slot = { step.kind, element(*step.column, row) };
+				break;
+			case Plan::action_type::CONSTANT:
+				slot = { step.kind, element(plan.constants[step.constant], 0) };
+				break;
+			case Plan::action_type::STORE:
+				// the slot's block is overwritten by later steps, so the value is copied out
+				memcpy(temporaries[step.constant].block(step.kind), slot.block, count * element_size(step.kind));
+				break;
+			case Plan::action_type::LOAD:
+				slot = { step.kind, temporaries[step.constant].block(step.kind) };
+				break;
+			default:
+			{
+				void* result = i + 1 == plan.steps.size() ? element(out, row) : scratch[step.slot].block(step.kind);
+				step.kernel(slot.block, step.action == Plan::action_type::BINARY ? slots[step.slot + 1].block : nullptr, result, count);
+				slot = { step.kind, result };
+			}
+			}
+		}
+
+		// A lone operand is copied out
+		if (plan.steps.back().action == Plan::action_type::COLUMN || plan.steps.back().action == Plan::action_type::CONSTANT)
+			memcpy(element(out, row), slots[0].block, count * element_size(plan.kind));
+	}
+}
+
+
+/*=============================================================
+
+Revision History
+
+Version 0.3.0: 2026-10-18
+Errors are thrown as std::runtime_error (std::exception(const char*) is a Visual C++ extension).
+
+Version 0.2.0: 2026-10-18
+Shared subexpressions (LOAD/STORE) are kept in per-block temporaries.
+
+Version 0.1.0: 2026-10-18
+Unbound variables are read from one snapshot of their environment.
+
+Version 0.0.0: 2026-10-18
+Alpha release.
+
+=============================================================
+
+Copyright Garth Santor/Trinh Han
+
+The copyright to the computer program(s) herein
+is the property of Garth Santor/Trinh Han of Canada.
+The program(s) may be used and/or copied only with
+the written permission of Garth Santor/Trinh Han
+or in accordance with the terms and conditions
+stipulated in the agreement/contract under which
+the program(s) have been supplied.
+=============================================================*/
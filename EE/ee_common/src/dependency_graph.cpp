@@ -0,0 +1,143 @@
+/** @file: dependency_graph.cpp
+	@author Chris Pollock
+	@version 0.0.0
+	@date 2026-10-18
+	@note Compiles under Visual C++ 15.4.4
+
+	@brief DependencyGraph class implementation.
+	*/
+
+#include "../inc/dependency_graph.hpp"
+#include <algorithm>
+using namespace std;
+
+
+
+/** Define a variable by a formula.
+	@return false if the formula reads 'name', directly or through other formulas.
+	@param name [in] the variable assigned.
+	@param reads [in] the variables the formula reads.
+	@note Only the variables downstream of 'name' are visited to detect a cycle.
+	*/
+bool DependencyGraph::define(string_type const& name, name_list const& reads) {
+	undefine(name);
+
+	name_set targets(reads.begin(), reads.end());
+	if (targets.empty())
+		return true;
+	if (targets.count(name) != 0 || reaches(name, targets))
+		return false;
+
+	for (auto const& read : targets)
+		dependents_[read].insert(name);
+	reads_.emplace(name, move(targets));
+	return true;
+}
+
+
+
+/** Drop the formula of a variable.
+	@param name [in] the variable.
+	*/
+void DependencyGraph::undefine(string_type const& name) {
+	auto found = reads_.find(name);
+	if (found == reads_.end())
+		return;
+
+	for (auto const& read : found->second)
+	{
+		auto edges = dependents_.find(read);
+		edges->second.erase(name);
+		if (edges->second.empty())
+			dependents_.erase(edges);
+	}
+	reads_.erase(found);
+}
+
+
+
+/** Get the transitive dependents of a variable.
+	@return the dependents in topological order: each after every variable it reads.
+	@param name [in] the variable that changed (not included).
+	*/
+DependencyGraph::name_list DependencyGraph::dependents(string_type const& name) const {
+	// Reverse post-order of a depth-first walk along the dependent edges
+	static name_set const none;
+	auto edges_of = [this](string_type const& node) -> name_set const& {
+		auto found = dependents_.find(node);
+		return found == dependents_.end() ? none : found->second;
+	};
+
+	struct Frame {
+		string_type const*			node;
+		name_set::const_iterator	next, end;
+	};
+	name_list order;
+	name_set visited{ name };
+	vector<Frame> stack{ { &name, edges_of(name).begin(), edges_of(name).end() } };
+
+	while (!stack.empty())
+	{
+		Frame& top = stack.back();
+		if (top.next == top.end)
+		{
+			order.push_back(*top.node);
+			stack.pop_back();
+			continue;
+		}
+		string_type const& next = *top.next++;
+		if (visited.insert(next).second)
+			stack.push_back({ &next, edges_of(next).begin(), edges_of(next).end() });
+	}
+
+	order.pop_back();		// 'name' itself
+	reverse(order.begin(), order.end());
+	return order;
+}
+
+
+
+/** Test if any of 'targets' depends on 'from'.
+	@return true if a target is reachable from 'from' along the dependent edges.
+	*/
+bool DependencyGraph::reaches(string_type const& from, name_set const& targets) const {
+	name_set visited{ from };
+	vector<string_type const*> stack{ &from };
+	while (!stack.empty())
+	{
+		auto edges = dependents_.find(*stack.back());
+		stack.pop_back();
+		if (edges == dependents_.end())
+			continue;
+		for (auto const& next : edges->second)
+		{
+			if (targets.count(next) != 0)
+				return true;
+			if (visited.insert(next).second)
+				stack.push_back(&next);
+		}
+	}
+	return false;
+}
+
+
+
+/*=============================================================
+
+Revision History
+
+Version 0.0.0: 2026-10-18
+Alpha release.
+
+=============================================================
+
+Copyright Garth Santor/Trinh Han
+
+The copyright to the computer program(s) herein
+is the property of Garth Santor/Trinh Han of Canada.
+The program(s) may be used and/or copied only with
+the written permission of Garth Santor/Trinh Han
+or in accordance with the terms and conditions
+stipulated in the agreement/contract under which
+the program(s) have been supplied.
+=============================================================*/
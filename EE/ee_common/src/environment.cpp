@@ -0,0 +1,87 @@
+/** @file: environment.cpp
+	@author Chris Pollock
+	@version 0.1.0
+	@date 2026-10-18
+	@note Compiles under Visual C++ 15.4.4
+
+	@brief Environment class implementation.
+	*/
+
+#include "../inc/environment.hpp"
+#include "../inc/token_allocator.hpp"
+using namespace std;
+
+
+
+/** Get the variable token bound to a name.
+	@return the existing variable token, or a new one (in the next free slot) if 'name' has not been seen before.
+	@param name [in] the variable name.
+	*/
+Token::pointer_type Environment::get_variable(view_type name) {
+	lock_guard<mutex> lock(mutex_);
+	auto found = variables_.find(name);
+	if (found != variables_.end())
+		return found->second;
+
+	Token::pointer_type variable = allocate_shared<Variable>(TokenAllocator<Variable>(), store_, names_.size());
+	names_.push_back(variables_.emplace(string_type(name.data(), name.size()), variable).first);
+	return names_.back()->second;
+}
+
+
+
+/** Reverse lookup of a variable token's name.
+	@return the name of the variable, or an empty string if the token is not in the dictionary.
+	@param variable [in] the variable token to look for.
+	@note A variable of ours is found through its slot, without searching.
+	*/
+Environment::string_type Environment::find_variable_name(Token::pointer_type const& variable) const {
+	if (!is<Variable>(variable))
+		return string_type();
+	Variable const& candidate = static_cast<Variable const&>(*variable);
+	if (candidate.get_store() != store_.get())
+		return string_type();
+
+	lock_guard<mutex> lock(mutex_);
+	if (candidate.get_slot() < names_.size() && names_[candidate.get_slot()]->second.get() == variable.get())
+		return names_[candidate.get_slot()]->first;
+
+	return string_type();
+}
+
+
+
+/** Set variables.
+	@param bindings [in] names and their new values.  Readers see either none or all of them.
+	*/
+void Environment::publish(binding_list const& bindings) {
+	vector<VariableStore::binding_type> slots;
+	slots.reserve(bindings.size());
+	for (auto const& binding : bindings)
+		slots.emplace_back(static_cast<Variable const&>(*get_variable(binding.first)).get_slot(), binding.second);
+	store_->publish(slots);
+}
+
+
+/*=============================================================
+
+Revision History
+
+Version 0.1.0: 2026-10-18
+Variables are indexed by slot, so find_variable_name() does not scan the dictionary.
+
+Version 0.0.0: 2026-10-18
+Alpha release.
+
+=============================================================
+
+Copyright Garth Santor/Trinh Han
+
+The copyright to the computer program(s) herein
+is the property of Garth Santor/Trinh Han of Canada.
+The program(s) may be used and/or copied only with
+the written permission of Garth Santor/Trinh Han
+or in accordance with the terms and conditions
+stipulated in the agreement/contract under which
+the program(s) have been supplied.
+=============================================================*/
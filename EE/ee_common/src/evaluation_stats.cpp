@@ -0,0 +1,103 @@
+/** @file: evaluation_stats.cpp
+	@author Chris Pollock
+	@version 0.0.0
+	@date 2026-10-18
+	@note Compiles under Visual C++ 15.4.4
+
+	@brief EvaluationStats implementation.
+	*/
+
+#include "../inc/evaluation_stats.hpp"
+#include <cstdio>
+#include <fstream>
+#include <sstream>
+#include <stdexcept>
+using namespace std;
+
+
+
+char const* phase_name(phase_type phase) {
+	static char const* const names[PHASE_COUNT] = { "tokenize", "parse", "compile", "evaluate" };
+	return names[index_of(phase)];
+}
+
+
+
+void EvaluationStats::reset() {
+	expressions = 0;
+	evaluations = 0;
+	nanoseconds.fill(0);
+	tokens = 0;
+	instructions = 0;
+	peak_stack_depth = 0;
+	big_integer_operations = 0;
+	real_operations = 0;
+}
+
+
+
+namespace {
+	// One metric: its HELP and TYPE lines, then its sample
+	void metric(ostream& os, char const* name, char const* type, char const* help, uint64_t value) {
+		os << "# HELP " << name << ' ' << help << '\n'
+			<< "# TYPE " << name << ' ' << type << '\n'
+			<< name << ' ' << value << '\n';
+	}
+}
+
+string EvaluationStats::to_prometheus() const {
+	ostringstream os;
+	metric(os, "ee_expressions_total", "counter", "Expressions compiled.", expressions);
+	metric(os, "ee_evaluations_total", "counter", "Compiled expressions evaluated.", evaluations);
+
+	os << "# HELP ee_phase_seconds_total Wall time spent in each phase.\n"
+		<< "# TYPE ee_phase_seconds_total counter\n";
+	os.precision(9);
+	for (size_t phase = 0; phase < PHASE_COUNT; ++phase)
+		os << "ee_phase_seconds_total{phase=\"" << phase_name(static_cast<phase_type>(phase)) << "\"} "
+			<< fixed << nanoseconds[phase] / 1e9 << '\n';
+
+	metric(os, "ee_tokens_total", "counter", "Tokens produced by the tokenizer.", tokens);
+	metric(os, "ee_instructions_total", "counter", "Instructions of the compiled RPN programs.", instructions);
+	metric(os, "ee_operand_stack_peak", "gauge", "Deepest operand stack of any evaluation.", peak_stack_depth);
+	metric(os, "ee_big_integer_operations_total", "counter", "Operations on or giving Integers outside 64 bits.", big_integer_operations);
+	metric(os, "ee_real_operations_total", "counter", "Operations on or giving Reals.", real_operations);
+	return os.str();
+}
+
+
+
+void EvaluationStats::write_prometheus(string const& path) const {
+	string const temporary = path + ".tmp";
+	{
+		ofstream out(temporary, ios::binary | ios::trunc);
+		out << to_prometheus();
+		if (!out)
+			throw runtime_error("Error: cannot write " + temporary);
+	}
+	// rename() does not replace an existing file everywhere
+	if (rename(temporary.c_str(), path.c_str()) != 0 && (remove(path.c_str()) != 0 || rename(temporary.c_str(), path.c_str()) != 0))
+		throw runtime_error("Error: cannot write " + path);
+}
+
+
+
+/*=============================================================
+
+Revision History
+
+Version 0.0.0: 2026-10-18
+Alpha release.
+
+=============================================================
+
+Copyright Garth Santor/Trinh Han
+
+The copyright to the computer program(s) herein
+is the property of Garth Santor/Trinh Han of Canada.
+The program(s) may be used and/or copied only with
+the written permission of Garth Santor/Trinh Han
+or in accordance with the terms and conditions
+stipulated in the agreement/contract under which
+the program(s) have been supplied.
+=============================================================*/
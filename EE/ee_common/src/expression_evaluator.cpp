@@ -1,8 +1,8 @@
 /** @file: expression_evaluator.cpp
 	@author Garth Santor/Trinh Han
 	@author http://www.gats.ca/
-	@version 0.0.1
-	@date 2012-11-13
+	@version 0.10.0
+	@date 2026-10-18
 	@note Compiles under Visual C++ v110
 
 	@brief ExpressionEvaluator class implementation.
@@ -12,19 +12,276 @@
 	*/
 
 #include "../inc/expression_evaluator.hpp"
+#include "../inc/allocation_tracking.hpp"
 
+#include <atomic>
+#include <chrono>
+
+namespace {
+	// Source of unique session ids, so a CompiledExpression can tell which evaluator built it.
+	std::atomic<CompiledExpression::session_type> nextSession(1);
+
+	// Adds the wall time of consecutive phases to EvaluationStats; does nothing without stats.
+	class PhaseTimer {
+		using clock_type = std::chrono::steady_clock;
+		EvaluationStats*		stats_;
+		clock_type::time_point	start_;
+	public:
+		explicit PhaseTimer(EvaluationStats* stats) : stats_(stats) {
+			if (stats_ != nullptr)
+				start_ = clock_type::now();
+		}
+
+		// Ends 'phase' and starts the next one
+		void lap(phase_type phase) {
+			if (stats_ == nullptr)
+				return;
+			clock_type::time_point const now = clock_type::now();
+			stats_->nanoseconds[index_of(phase)] += std::chrono::duration_cast<std::chrono::nanoseconds>(now - start_).count();
+			start_ = now;
+		}
+	};
+}
+
+ExpressionEvaluator::ExpressionEvaluator()
+	: session_(nextSession++)
+	, statsEnabled_(false) { }
+
+ExpressionEvaluator::ExpressionEvaluator(std::shared_ptr<Environment> environment)
+	: tokenizer_(std::move(environment))
+	, session_(nextSession++)
+	, statsEnabled_(false) { }
+
+/** Start or stop recording stats().
+	@param enable [in] true to record.
+	@note The counters are kept while recording is stopped; reset_stats() clears them.
+	*/
+void ExpressionEvaluator::enable_stats(bool enable)
+{
+	statsEnabled_ = enable;
+	rpn_.set_stats(enable ? &stats_ : nullptr);
+}
+
+/** Compile an expression.
+	@return the RPN program with its constant subexpressions folded and its common subexpressions shared,
+		and its variables recorded by name.
+	@param expr [in] the expression to compile.
+	@note Tokenizer dictionary may be updated if expression contains variables.
+	*/
+CompiledExpression ExpressionEvaluator::compile(view_type expr)
+{
+	PhaseTimer timer(statsEnabled_ ? &stats_ : nullptr);
+	allocation_tracking::PhaseScope allocations(allocation_phase::TOKENIZE);
+	TokenList tokenVec = tokenizer_.tokenize(expr);
+	timer.lap(phase_type::TOKENIZE);
+	allocations.enter(allocation_phase::PARSE);
+	TokenList parsedVec = parser_.parse(tokenVec);
+	timer.lap(phase_type::PARSE);
+	allocations.enter(allocation_phase::COMPILE);
+
+	size_t deduplicated = 0;
+	CompiledExpression::program_type program = rpn_.share(rpn_.fold(rpn_.compile(parsedVec)), deduplicated);
+	timer.lap(phase_type::COMPILE);
+	if (statsEnabled_)
+	{
+		++stats_.expressions;
+		stats_.tokens += tokenVec.size();
+		stats_.instructions += program.size();
+	}
+
+	// Record where each variable sits in the program so another evaluator can re-bind it
+	CompiledExpression::binding_list bindings;
+	for (size_t i = 0; i < program.size(); ++i)
+		if (is<Variable>(program[i].token))
+		{
+			expression_type name = tokenizer_.find_variable_name(program[i].token);
+			if (!name.empty())
+				bindings.push_back({ i, name });
+		}
+
+	return CompiledExpression(std::move(program), std::move(bindings), session_, deduplicated);
+}
+
+/** Evaluate an expression.
+	@return the result of the expression.
+	@param expr [in] the expression.
+	@note The expression is compiled only if its normalized text is not in the parse cache.  A cached
+		program binds the same variable tokens as a fresh compile would, so each variable is read when the
+		program runs; its only difference is that stats() do not count it as an expression.
+	*/
 ExpressionEvaluator::result_type ExpressionEvaluator::evaluate(expression_type const& expr)
 {
-	std::vector<Token::pointer_type> tokenVec = ExpressionEvaluator::tokenizer_.tokenize(expr);
-	std::vector<Token::pointer_type> parsedVec = ExpressionEvaluator::parser_.parse(tokenVec);
-	Token::pointer_type evaluatedOperand = ExpressionEvaluator::rpn_.evaluate(parsedVec);
+	if (cache_.get_capacity() == 0)
+		return evaluate(compile(expr));
+
+	ParseCache::string_type key = ParseCache::normalize(expr);
+	if (CompiledExpression const* cached = cache_.find(key))
+		return evaluate(*cached);
+	return evaluate(cache_.insert(key, compile(expr)));
+}
+
+/** Evaluate a compiled expression.
+	@return the result of the expression.
+	@param compiled [in] an expression compiled by this or any other ExpressionEvaluator.
+	@note Variables are resolved by name against this evaluator's variables.
+		The formulas that depend on an assigned variable are recomputed.
+	*/
+ExpressionEvaluator::result_type ExpressionEvaluator::evaluate(CompiledExpression const& compiled)
+{
+	refreshed_.clear();
+	PhaseTimer timer(statsEnabled_ ? &stats_ : nullptr);
+	allocation_tracking::PhaseScope allocations(allocation_phase::EVALUATE);
+	if (statsEnabled_)
+		++stats_.evaluations;
+
+	// Our own program is already bound to our variables
+	if (compiled.get_session() == session_ || compiled.get_bindings().empty())
+	{
+		result_type result = rpn_.execute(compiled.get_program());
+		track(compiled.get_bindings(), compiled.get_program());
+		timer.lap(phase_type::EVALUATE);
+		return result;
+	}
+
+	CompiledExpression::program_type program = compiled.get_program();
+	for (auto const& binding : compiled.get_bindings())
+		program[binding.position].token = tokenizer_.get_variable(binding.name);
+
+	result_type result = rpn_.execute(program);
+	track(compiled.get_bindings(), program);
+	timer.lap(phase_type::EVALUATE);
+	return result;
+}
+
+/** Set a variable.
+	@param name [in] the variable's name.
+	@param value [in] the value to bind to it.
+	*/
+void ExpressionEvaluator::set_variable(expression_type const& name, Operand::pointer_type value)
+{
+	refreshed_.clear();
+	allocation_tracking::PhaseScope allocations(allocation_phase::EVALUATE);
+	std::static_pointer_cast<Variable>(tokenizer_.get_variable(name))->set_value(value);
+
+	dependencies_.undefine(name);
+	formulas_.erase(name);
+	refresh(name);
+}
+
+/** Track the assignments of an executed program.
+	@param bindings [in] the program's variables, by position.
+	@param program [in] the program, bound to our variables.
+	@note A program that is a single assignment `name = expression`, where the expression reads other
+		variables and does not use result(n), defines 'name' as a formula.  Any other assignment makes
+		its variable a plain value.  Either way, the variable's dependents are recomputed.
+	*/
+void ExpressionEvaluator::track(CompiledExpression::binding_list const& bindings, CompiledExpression::program_type const& program)
+{
+	// The target of an assignment is the instruction that pushed its first argument
+	std::vector<size_t> producers;
+	std::vector<size_t> targets;
+	bool pure = true;
+	for (size_t i = 0; i < program.size(); ++i)
+	{
+		auto const& instruction = program[i];
+		if (instruction.number_of_args > producers.size())
+			return;
+		size_t first = producers.size() - instruction.number_of_args;
+		if (instruction.opcode == opcode_type::ASSIGNMENT)
+			targets.push_back(producers[first]);
+		else if (instruction.opcode == opcode_type::RESULT)
+			pure = false;
+
+		size_t producer = instruction.opcode == opcode_type::STORE ? producers[first] : i;
+		producers.resize(first);
+		producers.push_back(producer);
+	}
+	if (targets.empty())
+		return;
+
+	std::map<size_t, expression_type> names;
+	for (auto const& binding : bindings)
+		names.emplace(binding.position, binding.name);
+
+	bool const formula = pure && targets.size() == 1 && program.back().opcode == opcode_type::ASSIGNMENT;
+	for (size_t target : targets)
+	{
+		auto name = names.find(target);
+		if (name == names.end())
+			continue;
+
+		DependencyGraph::name_list reads;
+		if (formula)
+			for (auto const& binding : bindings)
+				if (binding.position != target)
+					reads.push_back(binding.name);
+
+		if (!reads.empty() && dependencies_.define(name->second, reads))
+			formulas_[name->second] = program;
+		else
+		{
+			dependencies_.undefine(name->second);
+			formulas_.erase(name->second);
+		}
+		refresh(name->second);
+	}
+}
+
+/** Recompute the formulas that depend on a variable.
+	@param name [in] the variable that changed.
+	@note The formulas are run outside the result history, so result(n) numbering is unaffected.
+	*/
+void ExpressionEvaluator::refresh(expression_type const& name)
+{
+	DependencyGraph::name_list dependents = dependencies_.dependents(name);
+	if (dependents.empty())
+		return;
 
-	return evaluatedOperand;
+	RPNEvaluator formulaEvaluator;
+	formulaEvaluator.set_precision(rpn_.get_precision());
+	for (auto const& dependent : dependents)
+	{
+		formulaEvaluator.execute(formulas_[dependent]);
+		refreshed_.push_back(dependent);
+	}
 }
 /*=============================================================
 
 Revision History
 
+Version 0.10.0: 2026-10-18
+evaluate() of text reuses the compiled expression cached under its normalized text.
+
+Version 0.9.0: 2026-10-18
+compile() takes a string view.
+
+Version 0.8.0: 2026-10-18
+Attributes allocations to the tokenize, parse, compile and evaluate phases for allocation_tracking.
+
+Version 0.7.0: 2026-10-18
+Records per-phase timing and counters in stats() when enabled.
+
+Version 0.6.0: 2026-10-18
+Assignments are tracked in a DependencyGraph; dependent formulas are recomputed in topological order.
+
+Version 0.5.0: 2026-10-18
+compile() shares common subexpressions.
+
+Version 0.4.0: 2026-10-18
+compile() folds constant subexpressions.
+
+Version 0.3.0: 2026-10-18
+Added the Environment constructor.
+
+Version 0.2.0: 2026-10-18
+Added set_variable().
+
+Version 0.1.1: 2026-10-18
+Compiled expressions hold the lowered RPN program.
+
+Version 0.1.0: 2026-10-18
+Added compile() and evaluate(CompiledExpression).
+
 Version 0.0.0: 2010-10-31
 Alpha release.
 
@@ -0,0 +1,122 @@
+/** @file: factorial.cpp
+	@author Chris Pollock
+	@version 0.0.0
+	@date 2026-10-18
+	@note Compiles under Visual C++ 15.4.4
+
+	@brief Factorial implementation.
+	*/
+
+#include "../inc/factorial.hpp"
+#include "../inc/work_stealing_pool.hpp"
+#include <limits>
+#include <mutex>
+#include <utility>
+#include <vector>
+using namespace std;
+
+namespace {
+	using integer = boost::multiprecision::cpp_int;
+
+	// Below this n the tree is multiplied on the calling thread
+	uint64_t const PARALLEL_THRESHOLD = 20000;
+
+	// Ranges of at most this many factors are leaves of the tree
+	uint64_t const LEAF_FACTORS = 32;
+
+	// Leaf tasks per worker, so that a worker that finishes early has work to steal
+	size_t const TASKS_PER_WORKER = 4;
+
+	/** Product of the factors [first, last), by splitting the range in halves. */
+	integer product(uint64_t first, uint64_t last)
+	{
+		if (last - first > LEAF_FACTORS)
+		{
+			uint64_t const middle = first + (last - first) / 2;
+			integer result = product(first, middle);
+			result *= product(middle, last);
+			return result;
+		}
+
+		// Small factors are multiplied in 64 bits until the next one would overflow
+		integer result = 1;
+		uint64_t word = 1;
+		for (uint64_t i = first; i < last; ++i)
+		{
+			if (word > (numeric_limits<uint64_t>::max)() / i)
+			{
+				result *= word;
+				word = 1;
+			}
+			word *= i;
+		}
+		result *= word;
+		return result;
+	}
+
+	mutex poolMutex;	// one parallel factorial at a time
+
+	WorkStealingPool& pool()
+	{
+		static WorkStealingPool instance;
+		return instance;
+	}
+}
+
+
+
+/** Compute a factorial.
+	@return n!
+	@param n [in] the argument.  0! and 1! are 1.
+	*/
+boost::multiprecision::cpp_int factorial(uint64_t n) {
+	if (n < 2)
+		return 1;
+
+	unique_lock<mutex> lock(poolMutex, try_to_lock);
+	if (n < PARALLEL_THRESHOLD || !lock.owns_lock() || pool().size() < 2)
+		return product(2, n + 1);
+
+	// The leaves: equal ranges of the factors 2..n
+	size_t const tasks = pool().size() * TASKS_PER_WORKER;
+	uint64_t const factors = n - 1;
+	vector<integer> partial(tasks);
+	pool().run(tasks, [&](size_t task, size_t) {
+		partial[task] = product(2 + factors * task / tasks, 2 + factors * (task + 1) / tasks);
+	});
+
+	// Then the levels of the tree above them, each level's multiplications in parallel
+	while (partial.size() > 1)
+	{
+		vector<integer> next((partial.size() + 1) / 2);
+		pool().run(next.size(), [&](size_t task, size_t) {
+			next[task] = move(partial[2 * task]);
+			if (2 * task + 1 < partial.size())
+				next[task] *= partial[2 * task + 1];
+		});
+		partial = move(next);
+	}
+	return move(partial.front());
+}
+
+
+
+/*=============================================================
+
+Revision History
+
+Version 0.0.0: 2026-10-18
+Alpha release.
+
+=============================================================
+
+Copyright Garth Santor/Trinh Han
+
+The copyright to the computer program(s) herein
+is the property of Garth Santor/Trinh Han of Canada.
+The program(s) may be used and/or copied only with
+the written permission of Garth Santor/Trinh Han
+or in accordance with the terms and conditions
+stipulated in the agreement/contract under which
+the program(s) have been supplied.
+=============================================================*/
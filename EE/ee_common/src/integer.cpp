@@ -2,8 +2,8 @@
 	@author Garth Santor/Trinh Han
 	@author garth.santor@sympatico.ca
 	@author http://www.gats.ca/
-	@date 2012-11-16
-	@version 1.0.0
+	@date 2026-10-18
+	@version 1.1.0
 	@note Compiles under Visaul C++ v120
 
 	@brief Integer class implementation.
@@ -17,8 +17,10 @@
 
 
 // Integer to_string method body
-// lexical_cast casts the boost::multiprecision::cpp_int to a string
+// lexical_cast casts the inline value or the boost::multiprecision::cpp_int to a string
 Integer::string_type Integer::to_string() const {
+	if (is_small())
+		return string_type("Integer: ") + boost::lexical_cast<string_type>(get_small());
 	return string_type("Integer: ") + boost::lexical_cast<string_type>(get_value());
 }
 
@@ -27,6 +29,9 @@ Integer::string_type Integer::to_string() const {
 /*=============================================================
 
 Revision History
+Version 1.1.0: 2026-10-18
+to_string() of the inline value without a cpp_int conversion.
+
 Version 1.0.0: 2014-10-29
 C++ 11 refactor.
 Converted Integer::value_type to boost::multiprecision::cpp_int
@@ -0,0 +1,222 @@
+/** @file: keyword_table.cpp
+	@author Chris Pollock
+	@version 0.2.0
+	@date 2026-10-18
+	@note Compiles under Visual C++ 15.4.4
+
+	@brief KeywordTable class implementation.
+	*/
+
+#include "../inc/keyword_table.hpp"
+#include "../inc/boolean.hpp"
+#include "../inc/function.hpp"
+#include "../inc/integer.hpp"
+#include "../inc/operator.hpp"
+#include "../inc/pseudo_operation.hpp"
+#include "../inc/real.hpp"
+#include "../inc/variable.hpp"
+#include <cassert>
+#include <cctype>
+using namespace std;
+
+namespace {
+	// Multiplier found offline to be collision free for the keywords below.  If the keywords change
+	// and it no longer is, the constructor searches for another one.
+	uint32_t const PRECOMPUTED_MULTIPLIER = 34675;
+
+	unsigned char lower(char c) { return static_cast<unsigned char>(tolower(static_cast<unsigned char>(c))); }
+
+	// FNV-1a of the lower case name
+	uint32_t hash_of(char const* name, size_t length)
+	{
+		uint32_t hash = 2166136261u;
+		for (size_t i = 0; i < length; ++i)
+		{
+			hash ^= lower(name[i]);
+			hash *= 16777619u;
+		}
+		return hash;
+	}
+
+	bool equal_ignoring_case(char const* keyword, char const* name, size_t length)
+	{
+		for (size_t i = 0; i < length; ++i)
+			if (keyword[i] == '\0' || static_cast<unsigned char>(keyword[i]) != lower(name[i]))
+				return false;
+		return keyword[length] == '\0';
+	}
+}
+
+
+
+/** Describe a keyword.
+	@param name [in] the keyword, in lower case.
+	@param token [in] the keyword's token.  A Variable can be assigned, so each Tokenizer makes its own.
+	*/
+KeywordTable::Entry::Entry(char const* name, Token::pointer_type token)
+	: name(name)
+	, token(std::move(token))
+	, endsOperand(is<Operand>(this->token) || is<PostfixOperator>(this->token) || is<RightParenthesis>(this->token))
+	, isFunction(is<Function>(this->token))
+	, create(is<Variable>(this->token) ? &make<Variable> : nullptr) { }
+
+
+
+/** The keywords and their tokens.  Names are lower case; lookups ignore case. */
+KeywordTable::KeywordTable() : entries_({
+		// Functions
+		{ "abs", make<Abs>() },
+		{ "arccos", make<Arccos>() },
+		{ "arcsin", make<Arcsin>() },
+		{ "arctan", make<Arctan>() },
+		{ "ceil", make<Ceil>() },
+		{ "cos", make<Cos>() },
+		{ "exp", make<Exp>() },
+		{ "floor", make<Floor>() },
+		{ "lb", make<Lb>() },
+		{ "ln", make<Ln>() },
+		{ "log", make<Log>() },
+		{ "results", make<Result>() },
+		{ "sin", make<Sin>() },
+		{ "sqrt", make<Sqrt>() },
+		{ "tan", make<Tan>() },
+		{ "fib", make<Fib>() },
+		{ "pel", make<Pel>() },
+		{ "syl", make<Syl>() },
+		{ "arctan2", make<Arctan2>() },
+		{ "max", make<Max>() },
+		{ "min", make<Min>() },
+		{ "pow", make<Pow>() },
+
+		//Operators
+		{ "**", make<Power>() },
+		{ "=", make<Assignment>() },
+		{ "*", make<Multiplication>() },
+		{ "/", make<Division>() },
+		{ "%", make<Modulus>() },
+		{ "mod", make<Modulus>() },
+		{ "-", make<Negation>() },
+		{ "+", make<Identity>() },
+		{ "==", make<Equality>() },
+		{ "!=", make<Inequality>() },
+		{ ">", make<Greater>() },
+		{ ">=", make<GreaterEqual>() },
+		{ "<", make<Less>() },
+		{ "<=", make<LessEqual>() },
+		{ "and", make<And>() },
+		{ "nand", make<Nand>() },
+		{ "or", make<Or>() },
+		{ "nor", make<Nor>() },
+		{ "xor", make<Xor>() },
+		{ "xnor", make<Xnor>() },
+		{ "&", make<BitAnd>() },
+		{ "|", make<BitOr>() },
+		{ "<<", make<BitShiftLeft>() },
+		{ ">>", make<BitShiftRight>() },
+		{ "!", make<Factorial>() },
+		{ "not", make<Not>() },
+		{ "~", make<BitNot>() },
+
+		// Classes
+		{ "boolean", make<Boolean>() },
+		{ "true", make<True>() },
+		{ "false", make<False>() },
+		{ "oneargfunction", make<OneArgFunction>() },
+		{ "twoargfunction", make<TwoArgFunction>() },
+		{ "integer", make<Integer>() },
+		{ "operand", make<Operand>() },
+		{ "parenthesis", make<Parenthesis>() },
+		{ "(", make<LeftParenthesis>() },
+		{ ")", make<RightParenthesis>() },
+		{ "leftparenthesis", make<LeftParenthesis>() },
+		{ ",", make<ArgumentSeparator>() },
+		{ "real", make<Real>() },
+		{ "pi", Pi::instance() },
+		{ "e", E::instance() },
+		{ "token", make<Token>() },
+		{ "variable", make<Variable>() },
+		{ "result", make<Result>() },
+	}) {
+	assert(entries_.size() < EMPTY && "KeywordTable: too many keywords for the slot table");
+
+	if (!try_multiplier(PRECOMPUTED_MULTIPLIER))
+	{
+		uint32_t multiplier = 1;
+		while (!try_multiplier(multiplier))
+			multiplier += 2;
+	}
+}
+
+
+
+KeywordTable const& KeywordTable::instance() {
+	static KeywordTable const table;
+	return table;
+}
+
+
+
+// Multiplicative hashing: the top SLOT_BITS bits of hash * multiplier
+size_t KeywordTable::slot_of(char const* name, size_t length) const {
+	return (hash_of(name, length) * multiplier_) >> (32 - SLOT_BITS);
+}
+
+
+
+// Fills the slots using 'multiplier'.  Returns false if two keywords share a slot.
+bool KeywordTable::try_multiplier(uint32_t multiplier) {
+	multiplier_ = multiplier;
+	slots_.fill(static_cast<uint8_t>(EMPTY));
+	for (size_t i = 0; i < entries_.size(); ++i)
+	{
+		char const* name = entries_[i].name;
+		size_t slot = slot_of(name, char_traits<char>::length(name));
+		if (slots_[slot] != EMPTY)
+			return false;
+		slots_[slot] = static_cast<uint8_t>(i);
+	}
+	return true;
+}
+
+
+
+size_t KeywordTable::find_index(char const* name, size_t length) const {
+	size_t index = slots_[slot_of(name, length)];
+	if (index != EMPTY && equal_ignoring_case(entries_[index].name, name, length))
+		return index;
+	return NOT_FOUND;
+}
+
+
+
+Token::pointer_type KeywordTable::find(char const* name, size_t length) const {
+	size_t index = find_index(name, length);
+	return index == NOT_FOUND ? Token::pointer_type() : entries_[index].token;
+}
+
+
+/*=============================================================
+
+Revision History
+
+Version 0.2.0: 2026-10-18
+The Variable of the variable keyword is not shared: Entry records a factory for it.
+
+Version 0.1.0: 2026-10-18
+Added find_index() and the per-keyword ends_operand/is_function flags.
+
+Version 0.0.0: 2026-10-18
+Alpha release.
+
+=============================================================
+
+Copyright Garth Santor/Trinh Han
+
+The copyright to the computer program(s) herein
+is the property of Garth Santor/Trinh Han of Canada.
+The program(s) may be used and/or copied only with
+the written permission of Garth Santor/Trinh Han
+or in accordance with the terms and conditions
+stipulated in the agreement/contract under which
+the program(s) have been supplied.
+=============================================================*/
@@ -0,0 +1,80 @@
+/** @file: line_scanner.cpp
+	@author Chris Pollock
+	@version 0.0.0
+	@date 2026-10-18
+	@note Compiles under Visual C++ 15.4.4
+
+	@brief Newline scanning implementation.
+	*/
+
+#include "../inc/line_scanner.hpp"
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+	#define LINE_SCANNER_SSE2
+	#include <emmintrin.h>
+	#if defined(_MSC_VER)
+		#include <intrin.h>
+	#endif
+#endif
+
+using namespace std;
+
+namespace {
+#if defined(LINE_SCANNER_SSE2)
+	// Gets the index of the lowest set bit of a non-zero mask
+	inline unsigned lowest_bit(unsigned mask) {
+	#if defined(_MSC_VER)
+		unsigned long index;
+		_BitScanForward(&index, mask);
+		return index;
+	#else
+		return unsigned(__builtin_ctz(mask));
+	#endif
+	}
+#endif
+}
+
+
+
+void line_scanner::find_newlines(view_type text, vector<size_t>& out) {
+	char const* const data = text.data();
+	size_t const size = text.size();
+	size_t i = 0;
+
+#if defined(LINE_SCANNER_SSE2)
+	// One bit per byte that is a newline, 16 bytes at a time
+	__m128i const newline = _mm_set1_epi8('\n');
+	for (; i + 16 <= size; i += 16) {
+		__m128i const block = _mm_loadu_si128(reinterpret_cast<__m128i const*>(data + i));
+		unsigned mask = unsigned(_mm_movemask_epi8(_mm_cmpeq_epi8(block, newline)));
+		for (; mask != 0; mask &= mask - 1)
+			out.push_back(i + lowest_bit(mask));
+	}
+#endif
+
+	for (; i < size; ++i)
+		if (data[i] == '\n')
+			out.push_back(i);
+}
+
+
+
+/*=============================================================
+
+Revision History
+
+Version 0.0.0: 2026-10-18
+Alpha release.
+
+=============================================================
+
+Copyright Garth Santor/Trinh Han
+
+The copyright to the computer program(s) herein
+is the property of Garth Santor/Trinh Han of Canada.
+The program(s) may be used and/or copied only with
+the written permission of Garth Santor/Trinh Han
+or in accordance with the terms and conditions
+stipulated in the agreement/contract under which
+the program(s) have been supplied.
+=============================================================*/
@@ -0,0 +1,58 @@
+/** @file: mapped_file.cpp
+	@author Chris Pollock
+	@version 0.0.0
+	@date 2026-10-18
+	@note Compiles under Visual C++ 15.4.4
+
+	@brief MappedFile class implementation.
+	*/
+
+#include "../inc/mapped_file.hpp"
+#include <fstream>
+#include <stdexcept>
+using namespace std;
+using namespace boost::interprocess;
+
+
+
+MappedFile::MappedFile(string const& path) {
+	// An empty file cannot be mapped; it is left as an empty region
+	{
+		ifstream file(path, ios::binary | ios::ate);
+		if (!file)
+			throw runtime_error("Error: cannot open " + path);
+		if (file.tellg() == 0)
+			return;
+	}
+
+	try {
+		mapping_ = file_mapping(path.c_str(), read_only);
+		region_ = mapped_region(mapping_, read_only);
+	}
+	catch (interprocess_exception const& e) {
+		throw runtime_error("Error: cannot map " + path + ": " + e.what());
+	}
+	region_.advise(mapped_region::advice_sequential);
+}
+
+
+
+/*=============================================================
+
+Revision History
+
+Version 0.0.0: 2026-10-18
+Alpha release.
+
+=============================================================
+
+Copyright Garth Santor/Trinh Han
+
+The copyright to the computer program(s) herein
+is the property of Garth Santor/Trinh Han of Canada.
+The program(s) may be used and/or copied only with
+the written permission of Garth Santor/Trinh Han
+or in accordance with the terms and conditions
+stipulated in the agreement/contract under which
+the program(s) have been supplied.
+=============================================================*/
@@ -0,0 +1,121 @@
+/** @file: parallel_evaluator.cpp
+	@author Chris Pollock
+	@version 0.1.0
+	@date 2026-10-18
+	@note Compiles under Visual C++ 15.4.4
+
+	@brief ParallelEvaluator class implementation.
+	*/
+
+#include "../inc/parallel_evaluator.hpp"
+#include "../inc/variable.hpp"
+#include <algorithm>
+#include <cstdint>
+using namespace std;
+
+
+
+std::size_t const ParallelEvaluator::CHUNK_ROWS;
+
+
+
+ParallelEvaluator::ParallelEvaluator(size_t threads)
+	: pool_(threads)
+	, precision_(precision_type::DIGITS_1000)
+	, evaluators_(pool_.size()) { }
+
+
+
+/** Evaluate a list of jobs.
+	@return the results, in job order.
+	@param jobs [in] the jobs.  Each is bound and evaluated by the ExpressionEvaluator of the worker that runs it.
+	@note A job's bindings are set before its expression is evaluated and cleared after it.  A job that
+		assigns variables of its own, or fails, leaves its worker with a new evaluator for the next job,
+		so jobs never see each other's variables.
+	*/
+ParallelEvaluator::result_list_type ParallelEvaluator::evaluate(job_list_type const& jobs) {
+	result_list_type results(jobs.size());
+	for (auto& evaluator : evaluators_)
+		if (evaluator && evaluator->get_precision() != precision_)
+			evaluator->set_precision(precision_);
+
+	pool_.run(jobs.size(), [&](size_t task, size_t worker) {
+		Job const& job = jobs[task];
+		unique_ptr<ExpressionEvaluator>& evaluator = evaluators_[worker];
+		if (!evaluator)
+			evaluator = make_evaluator();
+
+		// Setting and clearing the bindings are one version of the variables each
+		uint64_t const expected = evaluator->get_environment()->get_store().version() + 2 * job.bindings.size();
+		try {
+			for (auto const& binding : job.bindings)
+				evaluator->set_variable(binding.name, binding.value);
+			result_type result = evaluator->evaluate(job.expression);
+			if (is<Variable>(result) && get_value<Variable>(result))
+				result = get_value<Variable>(result);
+			for (auto const& binding : job.bindings)
+				evaluator->set_variable(binding.name, nullptr);
+			results[task] = result;
+		}
+		catch (...) {
+			evaluator.reset();
+			throw;
+		}
+		if (evaluator->get_environment()->get_store().version() != expected)
+			evaluator.reset();
+	});
+
+	return results;
+}
+
+
+
+/** Make a worker's evaluator.
+	@return an evaluator at the current precision that keeps no result history.
+	*/
+unique_ptr<ExpressionEvaluator> ParallelEvaluator::make_evaluator() const {
+	unique_ptr<ExpressionEvaluator> evaluator(new ExpressionEvaluator);
+	evaluator->set_precision(precision_);
+	evaluator->set_history_limit(0);
+	return evaluator;
+}
+
+
+
+/** Evaluate a batch.
+	@param batch [in] the batch, with its columns bound.
+	@param out [out] the result column, one row per input row.
+	*/
+void ParallelEvaluator::evaluate(BatchEvaluator const& batch, Column& out) {
+	size_t const rows = batch.rows();
+	out.reset(batch.result_kind(), rows);
+
+	pool_.run((rows + CHUNK_ROWS - 1) / CHUNK_ROWS, [&](size_t task, size_t) {
+		size_t const first = task * CHUNK_ROWS;
+		batch.evaluate(first, (min)(first + CHUNK_ROWS, rows), out);
+	});
+}
+
+
+/*=============================================================
+
+Revision History
+
+Version 0.1.0: 2026-10-18
+Jobs are evaluated by one ExpressionEvaluator per worker instead of a new one per job.
+
+Version 0.0.0: 2026-10-18
+Alpha release.
+
+=============================================================
+
+Copyright Garth Santor/Trinh Han
+
+The copyright to the computer program(s) herein
+is the property of Garth Santor/Trinh Han of Canada.
+The program(s) may be used and/or copied only with
+the written permission of Garth Santor/Trinh Han
+or in accordance with the terms and conditions
+stipulated in the agreement/contract under which
+the program(s) have been supplied.
+=============================================================*/
@@ -0,0 +1,164 @@
+/** @file: parse_cache.cpp
+	@author Chris Pollock
+	@version 0.0.0
+	@date 2026-10-18
+	@note Compiles under Visual C++ 15.4.4
+
+	@brief ParseCache class implementation.
+	*/
+
+#include "../inc/parse_cache.hpp"
+#include <cctype>
+#include <cstring>
+using namespace std;
+
+namespace {
+	// Characters of literals, names and named operators
+	bool is_word(char c) { return isalnum(static_cast<unsigned char>(c)) || c == '.'; }
+
+	bool is_space(char c) { return isspace(static_cast<unsigned char>(c)) != 0; }
+
+	/** Tests if whitespace between 'before' and 'after' separates tokens that would otherwise be read as one.
+		'previous' is the character ahead of 'before', or '\0'.
+		*/
+	bool separates(char previous, char before, char after) {
+		// "x and y", "1 .5"
+		if (is_word(before) && is_word(after))
+			return true;
+		// "1e +5", "1e+ 5" (an exponent), "1. !" (the factorial of a Real) and "! x" (scanned from the space)
+		if ((before == 'e' || before == 'E') && (after == '+' || after == '-'))
+			return true;
+		if ((before == '+' || before == '-') && (previous == 'e' || previous == 'E') && isdigit(static_cast<unsigned char>(after)))
+			return true;
+		if (before == '.' || before == '!')
+			return true;
+		// "< =", "% -", "= (": the tokenizer may read two symbols as one, except after a token of one character
+		if (!is_word(before) && !is_word(after))
+			return strchr("()+-/", before) == nullptr && !(before == '*' && after != '*');
+		return false;
+	}
+}
+
+
+
+/** Look up an expression.
+	@return the cached expression, or nullptr if 'key' is not cached.
+	@param key [in] the normalized text of the expression.
+	@note A lookup while the capacity is zero is neither a hit nor a miss.
+	*/
+CompiledExpression const* ParseCache::find(string_type const& key) {
+	if (capacity_ == 0)
+		return nullptr;
+
+	auto const found = index_.find(key);
+	if (found == index_.end()) {
+		++misses_;
+		return nullptr;
+	}
+
+	++hits_;
+	entries_.splice(entries_.begin(), entries_, found->second);
+	return &found->second->second;
+}
+
+
+
+/** Cache an expression.
+	@return the cached copy of 'compiled'.
+	@param key [in] the normalized text of the expression.
+	@param compiled [in] the expression compiled from that text.
+	*/
+CompiledExpression const& ParseCache::insert(string_type const& key, CompiledExpression const& compiled) {
+	if (capacity_ == 0)
+		return compiled;
+
+	auto const found = index_.find(key);
+	if (found != index_.end()) {
+		found->second->second = compiled;
+		entries_.splice(entries_.begin(), entries_, found->second);
+		return found->second->second;
+	}
+
+	evict(capacity_ - 1);
+	entries_.emplace_front(key, compiled);
+	index_.emplace(key, entries_.begin());
+	return entries_.front().second;
+}
+
+
+
+/** Set the capacity.
+	@param capacity [in] the number of expressions kept; zero keeps none.
+	*/
+void ParseCache::set_capacity(size_t capacity) {
+	capacity_ = capacity;
+	evict(capacity_);
+}
+
+
+
+/** Drop every cached expression. */
+void ParseCache::clear() {
+	index_.clear();
+	entries_.clear();
+}
+
+
+
+/** Normalize the text of an expression.
+	@return 'text' with leading and trailing whitespace removed, and every other run of whitespace either
+		removed or replaced by a single space.
+	@param text [in] the expression.
+	@note Two texts with the same key tokenize to the same tokens.
+	*/
+ParseCache::string_type ParseCache::normalize(view_type text) {
+	string_type key;
+	key.reserve(text.size());
+
+	bool space = false;
+	for (char c : text) {
+		if (is_space(c)) {
+			space = !key.empty();
+			continue;
+		}
+		if (space && separates(key.size() > 1 ? key[key.size() - 2] : '\0', key.back(), c))
+			key += ' ';
+		space = false;
+		key += c;
+	}
+	return key;
+}
+
+
+
+/** Evict the least recently used expressions.
+	@param keep [in] the number of expressions left.
+	*/
+void ParseCache::evict(size_t keep) {
+	while (entries_.size() > keep) {
+		index_.erase(entries_.back().first);
+		entries_.pop_back();
+	}
+}
+
+
+
+/*=============================================================
+
+Revision History
+
+Version 0.0.0: 2026-10-18
+Alpha release.
+
+=============================================================
+
+Copyright Garth Santor/Trinh Han
+
+The copyright to the computer program(s) herein
+is the property of Garth Santor/Trinh Han of Canada.
+The program(s) may be used and/or copied only with
+the written permission of Garth Santor/Trinh Han
+or in accordance with the terms and conditions
+stipulated in the agreement/contract under which
+the program(s) have been supplied.
+=============================================================*/
@@ -1,8 +1,8 @@
 /** @file: parser.cpp
 	@author Garth Santor/Trinh Han
 	@author http://www.gats.ca/
-	@version 1.0.0
-	@date 2012-11-13
+	@version 1.1.0
+	@date 2026-10-18
 	@note Compiles under Visual C++ v120
 
 	@brief Parser class implementation.
@@ -22,6 +22,7 @@
 #include "../inc/real.hpp"
 #include "../inc/token.hpp"
 #include "../inc/pseudo_operation.hpp"
+#include <stdexcept>
 
 using namespace std;
 
@@ -182,11 +183,11 @@ TokenList Parser::parse(TokenList const& infixTokens) {
 
 	if (leftParenthesis == true && rightParenthesis == false)
 	{
-		throw exception("Error: Missing ')' bracket.");
+		throw runtime_error("Error: Missing ')' bracket.");
 	}
 	else if (leftParenthesis == false && rightParenthesis == true)
 	{
-		throw exception("Error: Missing '(' bracket.");
+		throw runtime_error("Error: Missing '(' bracket.");
 	}
 	// If there are no more tokens and the stack is not empty, then
 	// pop everything from the stack and push it to the vector
@@ -206,6 +207,9 @@ TokenList Parser::parse(TokenList const& infixTokens) {
 /*=============================================================
 
 Revision History
+Version 1.1.0: 2026-10-18
+Errors are thrown as std::runtime_error (std::exception(const char*) is a Visual C++ extension).
+
 Version 1.0.0: 2014-10-31
 Visual C++ 2013
 
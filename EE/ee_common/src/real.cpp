@@ -1,8 +1,8 @@
 /** @file: real.cpp
 	@author Garth Santor/Trinh Han
 	@author http://www.gats.ca/
-	@date 2012-11-13
-	@version 1.0.0
+	@date 2026-10-18
+	@version 1.2.0
 	@note Compiles under Visual C++ v120
 
 	@brief Real class implementation.
@@ -12,17 +12,130 @@
 	*/
 
 #include "../inc/real.hpp"
+#include <boost/lexical_cast.hpp>
+#include <iomanip>
+#include <limits>
+#include <sstream>
+
+namespace {
+	// Casts whichever alternative is held
+	struct caster : boost::static_visitor<Real::string_type> {
+		template <typename T> Real::string_type operator()(T const& value) const { return boost::lexical_cast<Real::string_type>(value); }
+	};
+
+	// Formats whichever alternative is held
+	struct formatter : boost::static_visitor<Real::string_type> {
+		std::streamsize digits;
+		explicit formatter(std::streamsize digits) : digits(digits) { }
+		template <typename T> Real::string_type operator()(T const& value) const {
+			std::ostringstream oss;
+			if (digits > 0)
+				oss << std::setprecision(digits);
+			oss << value;
+			return oss.str();
+		}
+	};
+
+	// Value sources for make_real()
+	struct PiSource { template <typename T> T get() const { return boost::math::constants::pi<T>(); } };
+	struct ESource { template <typename T> T get() const { return boost::math::constants::e<T>(); } };
+	struct RealSource {
+		Real const& real;
+		template <typename T> T get() const { return real.get_value_as<T>(); }
+	};
+
+	// Makes a Real held at the given precision tier, getting the value from the source in that tier's type
+	template <typename SOURCE>
+	Real::pointer_type make_real(precision_type precision, SOURCE const& source) {
+		switch (precision) {
+		case precision_type::DOUBLE:		return std::allocate_shared<Real>(TokenAllocator<Real>(), source.template get<Real::double_type>());
+		case precision_type::DIGITS_50:		return std::allocate_shared<Real>(TokenAllocator<Real>(), source.template get<Real::digits50_type>());
+		case precision_type::DIGITS_100:	return std::allocate_shared<Real>(TokenAllocator<Real>(), source.template get<Real::digits100_type>());
+		default:							return std::allocate_shared<Real>(TokenAllocator<Real>(), source.template get<Real::value_type>());
+		}
+	}
+
+	// A constant computed on first use at one precision tier (the full precision one is the CONSTANT token itself).
+	// Function-local statics make the first use thread-safe.
+	template <typename CONSTANT, typename SOURCE, precision_type PRECISION>
+	Real::pointer_type const& shared_constant() {
+		static Real::pointer_type const constant = PRECISION == precision_type::DIGITS_1000
+			? Real::pointer_type(std::allocate_shared<CONSTANT>(TokenAllocator<CONSTANT>()))
+			: make_real(PRECISION, SOURCE());
+		return constant;
+	}
+
+	template <typename CONSTANT, typename SOURCE>
+	Real::pointer_type const& shared_constant(precision_type precision) {
+		switch (precision) {
+		case precision_type::DOUBLE:		return shared_constant<CONSTANT, SOURCE, precision_type::DOUBLE>();
+		case precision_type::DIGITS_50:		return shared_constant<CONSTANT, SOURCE, precision_type::DIGITS_50>();
+		case precision_type::DIGITS_100:	return shared_constant<CONSTANT, SOURCE, precision_type::DIGITS_100>();
+		default:							return shared_constant<CONSTANT, SOURCE, precision_type::DIGITS_1000>();
+		}
+	}
+}
+
+
+
+precision_type precision_for_digits(unsigned digits) {
+	if (digits <= std::numeric_limits<Real::double_type>::max_digits10)
+		return precision_type::DOUBLE;
+	if (digits <= 50)
+		return precision_type::DIGITS_50;
+	if (digits <= 100)
+		return precision_type::DIGITS_100;
+	return precision_type::DIGITS_1000;
+}
+
+
 
 // Real to_string method body, 
-// lexical_cast casts the boost::multiprecision::number<boost::multiprecision::cpp_dec_float<1000, int32_t, void>>
-// which is the value type of the Real number to a string.
+// lexical_cast casts the value held at the current precision tier to a string.
 Real::string_type Real::to_string() const {
-	return string_type("Real: ") + boost::lexical_cast<string_type>(get_value());
+	return string_type("Real: ") + boost::apply_visitor(caster(), value_);
+}
+
+
+
+Real::string_type Real::format(std::streamsize digits) const {
+	return boost::apply_visitor(formatter(digits), value_);
+}
+
+
+
+Real::pointer_type Real::to_precision(precision_type precision) const {
+	return make_real(precision, RealSource{ *this });
+}
+
+
+
+// The constants are computed directly at the requested tier rather than rounded from 1000 digits
+Real::pointer_type const& Pi::instance(precision_type precision) {
+	return shared_constant<Pi, PiSource>(precision);
+}
+
+Real::pointer_type Pi::to_precision(precision_type precision) const {
+	return instance(precision);
+}
+
+Real::pointer_type const& E::instance(precision_type precision) {
+	return shared_constant<E, ESource>(precision);
+}
+
+Real::pointer_type E::to_precision(precision_type precision) const {
+	return instance(precision);
 }
 
 /*=============================================================
 
 Revision History
+Version 1.2.0: 2026-10-18
+Pi and E constants are computed once per precision tier and shared.
+
+Version 1.1.0: 2026-10-18
+to_string() of the precision tier value.  Added format(), to_precision() and precision_for_digits().
+
 Version 1.0.0: 2014-10-29
 C++ 11 refactor.
 Switched value_type to boost::multiprecision::cpp_dec_float_100
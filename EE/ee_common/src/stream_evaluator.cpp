@@ -0,0 +1,426 @@
+/** @file: stream_evaluator.cpp
+	@author Chris Pollock
+	@version 0.3.0
+	@date 2026-10-18
+	@note Compiles under Visual C++ 15.4.4
+
+	@brief StreamEvaluator class implementation.
+	*/
+
+#include "../inc/stream_evaluator.hpp"
+#include "../inc/allocation_tracking.hpp"
+#include "../inc/bounded_queue.hpp"
+#include "../inc/line_scanner.hpp"
+#include "../inc/variable.hpp"
+#include <algorithm>
+#include <atomic>
+#include <array>
+#include <chrono>
+#include <cmath>
+#include <cstdint>
+#include <exception>
+#include <istream>
+#include <map>
+#include <mutex>
+#include <ostream>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+using namespace std;
+
+namespace {
+	using clock_type = chrono::steady_clock;
+
+	// A line on its way through the pipeline: where it is in its chunk's text, and what became of it.
+	// Once a stage fails it, later stages pass it on untouched.
+	struct Line {
+		size_t					number;		// in the chunk, then (once evaluated) in the input
+		size_t					offset;
+		size_t					length;
+		clock_type::time_point	reached;	// when a compiler started on it; latency is measured from here
+		CompiledExpression		compiled;
+		Token::pointer_type		result;
+		bool					failed;
+		string					error;
+	};
+
+	size_t const WRITE_BUFFER_SIZE = 64 * 1024;
+
+	// Counts latencies in buckets of 1/8 of a doubling from 100 ns, so a run of any length takes the same memory.
+	// The mean and maximum are exact; the median and 99th percentile are the upper bound of their bucket (within 9%).
+	class LatencyHistogram {
+		static size_t const PER_DOUBLING = 8;
+		static size_t const BUCKETS = 40 * PER_DOUBLING + 1;
+		static constexpr double SMALLEST = 1e-7;	// seconds; bucket 0 holds everything up to it
+
+		array<uint64_t, BUCKETS>	buckets_;
+		uint64_t					count_;
+		double						total_;
+		double						max_;
+	public:
+		LatencyHistogram() : count_(0), total_(0), max_(0) { buckets_.fill(0); }
+
+		void add(double seconds) {
+			size_t bucket = 0;
+			if (seconds > SMALLEST)
+				bucket = min(BUCKETS - 1, static_cast<size_t>(log2(seconds / SMALLEST) * PER_DOUBLING) + 1);
+			++buckets_[bucket];
+			++count_;
+			total_ += seconds;
+			max_ = max(max_, seconds);
+		}
+
+		uint64_t	count() const { return count_; }
+		double		mean() const { return count_ != 0 ? total_ / count_ : 0; }
+		double		maximum() const { return max_; }
+
+		// The latency of the given 0-based rank in sorted order
+		double at(uint64_t rank) const {
+			uint64_t below = 0;
+			for (size_t bucket = 0; bucket < BUCKETS; ++bucket) {
+				below += buckets_[bucket];
+				if (below > rank)
+					return min(max_, SMALLEST * exp2(static_cast<double>(bucket) / PER_DOUBLING));
+			}
+			return max_;
+		}
+	};
+
+	// Collects text and writes it to a stream in blocks of WRITE_BUFFER_SIZE
+	class BufferedWriter {
+		ostream&	out_;
+		string		buffer_;
+	public:
+		explicit BufferedWriter(ostream& out) : out_(out) { buffer_.reserve(WRITE_BUFFER_SIZE); }
+
+		BufferedWriter& operator << (string const& text) {
+			buffer_ += text;
+			if (buffer_.size() >= WRITE_BUFFER_SIZE)
+				write();
+			return *this;
+		}
+
+		// Writes what is buffered and flushes the stream
+		void flush() {
+			write();
+			out_.flush();
+		}
+
+	private:
+		void write() {
+			out_.write(buffer_.data(), buffer_.size());
+			buffer_.clear();
+		}
+	};
+
+	// Cuts a chunk's text into its lines, skipping blank ones.  'newlines' is scratch space.
+	template <typename CHUNK>
+	void split(CHUNK& chunk, vector<size_t>& newlines) {
+		auto const text = chunk.get_text();
+		newlines.clear();
+		line_scanner::find_newlines(text, newlines);
+		chunk.lineCount = newlines.size() + (text.empty() || text.back() == '\n' ? 0 : 1);
+		chunk.lines.reserve(chunk.lineCount);
+
+		size_t first = 0;
+		for (size_t i = 0; i < chunk.lineCount; ++i) {
+			size_t const next = i < newlines.size() ? newlines[i] : text.size();
+			size_t last = next;
+			if (last > first && text[last - 1] == '\r')
+				--last;
+			if (text.substr(first, last - first).find_first_not_of(" \t") != decltype(text)::npos)
+				chunk.lines.push_back(Line{ i + 1, first, last - first, clock_type::time_point(), CompiledExpression(), nullptr, false, string() });
+			first = next + 1;
+		}
+	}
+
+	// Applies 'process' to each line of 'chunk' not yet failed.  An exception from a line fails that line only.
+	template <typename CHUNK, typename PROCESS>
+	void for_each_line(CHUNK& chunk, PROCESS process) {
+		for (auto& line : chunk.lines) {
+			if (line.failed)
+				continue;
+			try {
+				process(line);
+			}
+			catch (exception const& e) {
+				line.failed = true;
+				line.error = e.what();
+			}
+			catch (...) {
+				line.failed = true;
+				line.error = "Unknown exception";
+			}
+		}
+	}
+}
+
+
+
+// A block of whole lines of the input: either a view of text that outlives the run, or text of its own
+struct StreamEvaluator::Chunk {
+	size_t					sequence;	// restores the order of the chunks after the compilers
+	view_type				text;		// used when storage is empty
+	string					storage;
+	size_t					lineCount;	// blank lines included
+	vector<Line>			lines;
+
+	Chunk() : sequence(0), lineCount(0) { }
+
+	view_type	get_text() const { return storage.empty() ? text : view_type(storage); }
+	view_type	text_of(Line const& line) const { return get_text().substr(line.offset, line.length); }
+};
+
+
+
+StreamEvaluator::StreamEvaluator(ExpressionEvaluator& evaluator, formatter_type formatter, size_t compilers)
+	: evaluator_(evaluator)
+	, formatter_(move(formatter))
+	, compilers_(compilers != 0 ? compilers : max<size_t>(thread::hardware_concurrency(), 4) - 3)
+	, shardBytes_(SHARD_BYTES) { }
+
+
+
+/** Evaluate a stream of expressions.
+	@return the number of lines and errors, and the throughput and latency of the run.
+	@param in [in] the expressions, one per line.
+	@param out [in] the stream that results are written to.
+	@param errors [in] the stream that the errors of lines are written to.
+	@note Lines are read CHUNK_LINES at a time into a chunk's own text, so a slow stream is not waited on for more.
+	*/
+StreamEvaluator::Summary StreamEvaluator::run(istream& in, ostream& out, ostream& errors)
+{
+	return run([&in](function<bool(Chunk&&)> const& push) {
+		Chunk chunk;
+		string line;
+		for (size_t lines = 1; getline(in, line); ++lines) {
+			chunk.storage += line;
+			chunk.storage += '\n';
+			if (lines % CHUNK_LINES == 0) {
+				if (!push(move(chunk)))
+					return;
+				chunk = Chunk();
+			}
+		}
+		if (!chunk.storage.empty())
+			push(move(chunk));
+	}, out, errors);
+}
+
+
+
+/** Evaluate the expressions of a block of text.
+	@return the number of lines and errors, and the throughput and latency of the run.
+	@param text [in] the expressions, one per line.  Read in place.
+	@param out [in] the stream that results are written to.
+	@param errors [in] the stream that the errors of lines are written to.
+	@note The text is passed on in shards of get_shard_bytes(), each ending at a newline (or the end of the text).
+		Only the newline closing each shard is looked for here; the compiler given the shard finds the rest.
+	*/
+StreamEvaluator::Summary StreamEvaluator::run(view_type text, ostream& out, ostream& errors)
+{
+	size_t const shardBytes = shardBytes_;
+	return run([text, shardBytes](function<bool(Chunk&&)> const& push) {
+		for (size_t first = 0; first < text.size(); ) {
+			size_t last = text.size();
+			if (text.size() - first > shardBytes) {
+				size_t const newline = text.find('\n', first + shardBytes - 1);
+				if (newline != view_type::npos)
+					last = newline + 1;
+			}
+			Chunk chunk;
+			chunk.text = text.substr(first, last - first);
+			if (!push(move(chunk)))
+				return;
+			first = last;
+		}
+	}, out, errors);
+}
+
+
+
+/** Run the pipeline.
+	@return the number of lines and errors, and the throughput and latency of the run.
+	@param read [in] the reader, run on this thread.
+	@param out [in] the stream that results are written to.
+	@param errors [in] the stream that the errors of lines are written to.
+	*/
+StreamEvaluator::Summary StreamEvaluator::run(reader_type const& read, ostream& out, ostream& errors)
+{
+	using queue_type = BoundedQueue<Chunk>;
+	queue_type toCompile(QUEUE_CHUNKS), toEvaluate(QUEUE_CHUNKS), toFormat(QUEUE_CHUNKS);
+	queue_type* const queues[] = { &toCompile, &toEvaluate, &toFormat };
+
+	// The first exception that escapes a stage ends the run: closing every queue stops every stage
+	mutex errorMutex;
+	exception_ptr error;
+	auto fail = [&](exception_ptr e) {
+		{
+			lock_guard<mutex> lock(errorMutex);
+			if (!error)
+				error = e;
+		}
+		for (auto queue : queues)
+			queue->close();
+	};
+	auto guarded = [&](function<void()> body) {
+		return [body, &fail]() {
+			try { body(); }
+			catch (...) { fail(current_exception()); }
+		};
+	};
+
+	// Only the last HISTORY_RESULTS results are kept for result(n) during the run, so memory does not grow with the input
+	struct HistoryLimit {
+		ExpressionEvaluator&	evaluator;
+		size_t const			previous;
+		HistoryLimit(ExpressionEvaluator& e, size_t limit) : evaluator(e), previous(e.get_history_limit()) { e.set_history_limit(min(previous, limit)); }
+		~HistoryLimit() { evaluator.set_history_limit(previous); }
+	} historyLimit(evaluator_, HISTORY_RESULTS);
+
+	Summary summary = {};
+	LatencyHistogram latencies;
+	auto const start = clock_type::now();
+
+	vector<thread> threads;
+	try {
+		// Compilers: each has an evaluator of its own over the shared variables, used only to compile
+		atomic<size_t> compiling(compilers_);
+		for (size_t i = 0; i < compilers_; ++i)
+			threads.emplace_back(guarded([&] {
+				ExpressionEvaluator compiler(evaluator_.get_environment());
+				compiler.set_precision(evaluator_.get_precision());
+				vector<size_t> newlines;
+				Chunk chunk;
+				while (toCompile.pop(chunk)) {
+					split(chunk, newlines);
+					for_each_line(chunk, [&](Line& line) {
+						line.reached = clock_type::now();
+						line.compiled = compiler.compile(chunk.text_of(line));
+					});
+					if (!toEvaluate.push(move(chunk)))
+						break;
+				}
+				if (--compiling == 0)
+					toEvaluate.close();
+			}));
+
+		// Evaluator: takes the chunks in order, holding back those that overtook an earlier one
+		threads.emplace_back(guarded([&] {
+			allocation_tracking::PhaseScope phase(allocation_phase::EVALUATE);
+			map<size_t, Chunk> early;
+			size_t next = 0;
+			size_t linesBefore = 0;
+			Chunk chunk;
+			while (toEvaluate.pop(chunk)) {
+				early.emplace(chunk.sequence, move(chunk));
+				for (auto ready = early.find(next); ready != early.end(); ready = early.find(++next)) {
+					Chunk& current = ready->second;
+					for (auto& line : current.lines)
+						line.number += linesBefore;
+					linesBefore += current.lineCount;
+
+					for_each_line(current, [&](Line& line) {
+						line.result = evaluator_.evaluate(line.compiled);
+						line.compiled = CompiledExpression();
+						// A later line may assign the variable, so pass on its current value
+						if (is<Variable>(line.result)) {
+							line.result = get_value<Variable>(line.result);
+							if (!line.result)
+								throw runtime_error("Error: variable has no value.");
+						}
+					});
+					if (!toFormat.push(move(current)))
+						return;
+					early.erase(ready);
+				}
+			}
+			toFormat.close();
+		}));
+
+		// Formatter
+		threads.emplace_back(guarded([&] {
+			allocation_tracking::PhaseScope phase(allocation_phase::FORMAT);
+			BufferedWriter results(out), messages(errors);
+			Chunk chunk;
+			while (toFormat.pop(chunk)) {
+				for (auto& line : chunk.lines) {
+					string const number = "[" + to_string(line.number) + "] ";
+					if (!line.failed) {
+						try {
+							results << number + "= " + (formatter_ ? formatter_(line.result) : line.result->to_string()) + "\n";
+						}
+						catch (exception const& e) {
+							line.failed = true;
+							line.error = e.what();
+						}
+					}
+					if (line.failed) {
+						messages << number + line.error + "\n";
+						++summary.errors;
+					}
+					latencies.add(chrono::duration<double>(clock_type::now() - line.reached).count());
+				}
+			}
+			results.flush();
+			messages.flush();
+		}));
+
+		// Reader: this thread
+		size_t sequence = 0;
+		read([&](Chunk&& chunk) {
+			chunk.sequence = sequence++;
+			return toCompile.push(move(chunk));
+		});
+	}
+	catch (...) {
+		fail(current_exception());
+	}
+	toCompile.close();
+	for (auto& t : threads)
+		t.join();
+	if (error)
+		rethrow_exception(error);
+
+	summary.seconds = chrono::duration<double>(clock_type::now() - start).count();
+	summary.lines = static_cast<size_t>(latencies.count());
+	if (latencies.count() != 0) {
+		summary.meanLatency = latencies.mean();
+		summary.medianLatency = latencies.at(latencies.count() / 2);
+		summary.p99Latency = latencies.at(min(latencies.count() - 1, latencies.count() * 99 / 100));
+		summary.maxLatency = latencies.maximum();
+	}
+	return summary;
+}
+
+
+
+/*=============================================================
+
+Revision History
+
+Version 0.3.0: 2026-10-18
+Latency is timed per line, from a compiler starting on the line, instead of from its chunk being read.
+
+Version 0.2.0: 2026-10-18
+The result history is limited to HISTORY_RESULTS during a run, and latencies are counted in a fixed histogram,
+so memory does not grow with the number of lines.
+
+Version 0.1.0: 2026-10-18
+Added run(view_type).  Chunks carry text; compilers cut it into lines with line_scanner and tokenize them in place.
+
+Version 0.0.0: 2026-10-18
+Alpha release.
+
+=============================================================
+
+Copyright Garth Santor/Trinh Han
+
+The copyright to the computer program(s) herein
+is the property of Garth Santor/Trinh Han of Canada.
+The program(s) may be used and/or copied only with
+the written permission of Garth Santor/Trinh Han
+or in accordance with the terms and conditions
+stipulated in the agreement/contract under which
+the program(s) have been supplied.
+=============================================================*/
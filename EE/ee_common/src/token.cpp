@@ -1,8 +1,8 @@
 /** @file: token.cpp
 	@author Garth Santor/Trinh Han
 	@author http://www.gats.ca/
-	@date 2012-11-13
-	@version 0.0.0
+	@date 2026-10-18
+	@version 0.1.0
 	@note Compiles under Visual C++ v110
 
 	@brief Operation class implemenation.
@@ -12,11 +12,17 @@
 	*/
 
 #include "../inc/token.hpp"
+#include <boost/core/demangle.hpp>
 using namespace std;
 
 
+// The class name; Visual C++ names are "class X", other compilers' are mangled
 Token::string_type	Token::to_string() const {
-	return string_type("<") + string_type(typeid(*this).name()).substr(6) + string_type(">");
+	string_type name = boost::core::demangle(typeid(*this).name());
+	string_type const prefix("class ");
+	if (name.compare(0, prefix.size(), prefix) == 0)
+		name.erase(0, prefix.size());
+	return string_type("<") + name + string_type(">");
 }
 
 
@@ -24,6 +30,9 @@ Token::string_type	Token::to_string() const {
 
 Revision History
 
+Version 0.1.0: 2026-10-18
+to_string() demangles the class name portably.
+
 Version 0.0.0: 2012-11-13
 Alpha release.
 
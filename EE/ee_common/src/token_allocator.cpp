@@ -0,0 +1,183 @@
+/** @file: token_allocator.cpp
+	@author Chris Pollock
+	@version 0.1.0
+	@date 2026-10-18
+	@note Compiles under Visual C++ 15.4.4
+
+	@brief Pooled token allocation implementation.
+	*/
+
+#include "../inc/token_allocator.hpp"
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <mutex>
+#include <new>
+
+using namespace std;
+using namespace token_pool;
+
+namespace {
+	size_t const CLASS_COUNT = MAX_POOLED_SIZE / ALIGNMENT;
+	size_t const CHUNK_SIZE = 64 * 1024;
+	size_t const CACHE_BLOCKS = 512;	// a thread keeps at most this many free blocks of a size class
+
+	// A free block.  The first block of a list on the shared stack also links the next list.
+	struct FreeBlock {
+		FreeBlock* next;
+		FreeBlock* nextList;
+	};
+	static_assert(sizeof(FreeBlock) <= ALIGNMENT, "token_pool: a free block must fit the smallest size class");
+
+	struct FreeList {
+		FreeBlock*	head;
+		size_t		count;
+	};
+	using free_list_array = array<FreeList, CLASS_COUNT>;
+
+	// Lists of blocks spilled by threads (over CACHE_BLOCKS, or on exit), available to any thread
+	mutex							sharedMutex;
+	array<FreeBlock*, CLASS_COUNT>	shared = {};
+
+	atomic<size_t>	chunks(0);
+
+	// This thread's free lists.  Trivially destructible, so blocks released during thread (or program)
+	// shutdown can still be pushed here; they are simply not reused.
+	thread_local free_list_array freeLists = {};
+	thread_local bool reaped = false;
+
+	void share(size_t sizeClass, FreeBlock* list)
+	{
+		lock_guard<mutex> lock(sharedMutex);
+		list->nextList = shared[sizeClass];
+		shared[sizeClass] = list;
+	}
+
+	// Hands this thread's free blocks to the shared stack when the thread exits
+	struct Reaper {
+		~Reaper() {
+			reaped = true;
+			for (size_t sizeClass = 0; sizeClass < CLASS_COUNT; ++sizeClass)
+			{
+				FreeList& list = freeLists[sizeClass];
+				if (list.head != nullptr)
+					share(sizeClass, list.head);
+				list = FreeList{ nullptr, 0 };
+			}
+		}
+	};
+	thread_local Reaper reaper;
+
+	size_t class_of(size_t bytes) { return (bytes + ALIGNMENT - 1) / ALIGNMENT - 1; }
+
+	// Gets a list of free blocks: a list from the shared stack, or a new chunk cut into blocks
+	FreeList refill(size_t sizeClass)
+	{
+		(void)&reaper;	// registers this thread's reaper
+
+		FreeBlock* list = nullptr;
+		{
+			lock_guard<mutex> lock(sharedMutex);
+			list = shared[sizeClass];
+			if (list != nullptr)
+				shared[sizeClass] = list->nextList;
+		}
+		if (list != nullptr)
+		{
+			size_t count = 0;
+			for (FreeBlock* block = list; block != nullptr; block = block->next)
+				++count;
+			return FreeList{ list, count };
+		}
+
+		size_t const blockSize = (sizeClass + 1) * ALIGNMENT;
+		size_t const count = max<size_t>(CHUNK_SIZE / blockSize, 1);
+		char* chunk = static_cast<char*>(::operator new(count * blockSize));
+		++chunks;
+
+		for (size_t i = count; i-- > 0; )
+		{
+			FreeBlock* block = reinterpret_cast<FreeBlock*>(chunk + i * blockSize);
+			block->next = list;
+			list = block;
+		}
+		return FreeList{ list, count };
+	}
+}
+
+
+
+void* token_pool::allocate(size_t bytes) {
+	if (bytes == 0 || bytes > MAX_POOLED_SIZE)
+		return ::operator new(bytes);
+
+	size_t const sizeClass = class_of(bytes);
+	FreeList& list = freeLists[sizeClass];
+	if (list.head == nullptr)
+		list = refill(sizeClass);
+
+	FreeBlock* block = list.head;
+	list.head = block->next;
+	--list.count;
+	return block;
+}
+
+
+
+void token_pool::deallocate(void* block, size_t bytes) noexcept {
+	if (bytes == 0 || bytes > MAX_POOLED_SIZE)
+	{
+		::operator delete(block);
+		return;
+	}
+
+	size_t const sizeClass = class_of(bytes);
+	FreeList& list = freeLists[sizeClass];
+	FreeBlock* freed = static_cast<FreeBlock*>(block);
+	freed->next = list.head;
+	list.head = freed;
+	++list.count;
+
+	// Blocks freed by a thread that did not allocate them would otherwise pile up here:
+	// keep the most recently freed half and share the rest
+	if (list.count > CACHE_BLOCKS && !reaped)
+	{
+		FreeBlock* last = list.head;
+		for (size_t i = 1; i < CACHE_BLOCKS / 2; ++i)
+			last = last->next;
+		share(sizeClass, last->next);
+		last->next = nullptr;
+		list.count = CACHE_BLOCKS / 2;
+	}
+}
+
+
+
+size_t token_pool::chunks_allocated() noexcept {
+	return chunks.load(memory_order_relaxed);
+}
+
+
+/*=============================================================
+
+Revision History
+
+Version 0.1.0: 2026-10-18
+A thread keeps at most CACHE_BLOCKS free blocks of a size class and shares the rest, so blocks freed on
+another thread return to the allocating one.  Added chunks_allocated().
+
+Version 0.0.0: 2026-10-18
+Alpha release.
+
+=============================================================
+
+Copyright Garth Santor/Trinh Han
+
+The copyright to the computer program(s) herein
+is the property of Garth Santor/Trinh Han of Canada.
+The program(s) may be used and/or copied only with
+the written permission of Garth Santor/Trinh Han
+or in accordance with the terms and conditions
+stipulated in the agreement/contract under which
+the program(s) have been supplied.
+=============================================================*/
@@ -1,8 +1,8 @@
 /** @file: tokenizer.cpp
 	@author Garth Santor/Trinh Han
 	@author http://www.gats.ca/
-	@version 0.3.0
-	@date 2017-11-23
+	@version 0.11.0
+	@date 2026-10-18
 	@note Compiles under Visual C++ 15.4.4
 
 	@brief Tokenizer class implementation.
@@ -16,6 +16,8 @@
 #include "../inc/boolean.hpp"
 #include "../inc/function.hpp"
 #include "../inc/integer.hpp"
+#include "../inc/keyword_table.hpp"
+#include "../inc/lexeme.hpp"
 #include "../inc/operator.hpp"
 #include "../inc/pseudo_operation.hpp"
 #include "../inc/real.hpp"
@@ -25,240 +27,183 @@
 #include <boost/multiprecision/cpp_int.hpp>
 using namespace boost::multiprecision;
 
+#include <cassert>
+#include <cctype>
+#include <cstdint>
+#include <cstring>
 #include <exception>
 #include <limits>
 #include <sstream>
 #include <stack>
+#include <stdexcept>
 #include <string>
 #include <sstream>
 #include <vector>
 using namespace std;
 
-/** Default constructor loads the keywords_ dictionary(map). */
-Tokenizer::Tokenizer() {
-	// Functions
-	keywords_["abs"] = keywords_["Abs"] = keywords_["ABS"] = make<Abs>();
-	keywords_["arccos"] = keywords_["Arccos"] = keywords_["ARCCOS"] = make<Arccos>();
-	keywords_["arcsin"] = keywords_["Arcsin"] = keywords_["ARCSIN"] = make<Arcsin>();
-	keywords_["arctan"] = keywords_["Arctan"] = keywords_["ARCTAN"] = make<Arctan>();
-	keywords_["ceil"] = keywords_["Ceil"] = keywords_["CEIL"] = make<Ceil>();
-	keywords_["cos"] = keywords_["Cos"] = keywords_["COS"] = make<Cos>();
-	keywords_["exp"] = keywords_["Exp"] = keywords_["EXP"] = make<Exp>();
-	keywords_["floor"] = keywords_["Floor"] = keywords_["FLOOR"] = make<Floor>();
-	keywords_["lb"] = keywords_["Lb"] = keywords_["LB"] = make<Lb>();
-	keywords_["ln"] = keywords_["Ln"] = keywords_["LN"] = make<Ln>();
-	keywords_["log"] = keywords_["Log"] = keywords_["LOG"] = make<Log>();
-	keywords_["results"] = keywords_["Results"] = keywords_["RESULTS"] = make<Result>();
-	keywords_["sin"] = keywords_["Sin"] = keywords_["SIN"] = make<Sin>();
-	keywords_["sqrt"] = keywords_["Sqrt"] = keywords_["SQRT"] = make<Sqrt>();
-	keywords_["tan"] = keywords_["Tan"] = keywords_["TAN"] = make<Tan>();
-	keywords_["fib"] = keywords_["Fib"] = keywords_["FIB"] = make<Fib>();
-	keywords_["pel"] = keywords_["Pel"] = keywords_["PEL"] = make<Pel>();
-	keywords_["syl"] = keywords_["Syl"] = keywords_["SYL"] = make<Syl>();
-	keywords_["arctan2"] = keywords_["Arctan2"] = keywords_["ARCTAN2"] = make<Arctan2>();
-	keywords_["max"] = keywords_["Max"] = keywords_["MAX"] = make<Max>();
-	keywords_["min"] = keywords_["Min"] = keywords_["MIN"] = make<Min>();
-	keywords_["pow"] = keywords_["Pow"] = keywords_["POW"] = make<Pow>();
-	
-	//Operators
-	keywords_["**"] = make<Power>();
-	keywords_["="] = make<Assignment>();
-	keywords_["*"] = make<Multiplication>();
-	keywords_["/"] = make<Division>();
-	keywords_["%"] = keywords_["mod"] = keywords_["Mod"] = keywords_["MOD"] = make<Modulus>();
-	keywords_["-"] = make<Subtraction>();
-	keywords_["+"] = make<Addition>();
-	keywords_["=="] = make<Equality>();
-	keywords_["!="] = make<Inequality>();
-	keywords_[">"] = make<Greater>();
-	keywords_[">="] = make<GreaterEqual>();
-	keywords_["<"] = make<Less>();
-	keywords_["<="] = make<LessEqual>();
-	keywords_["and"] = keywords_["And"] = keywords_["AND"] = make<And>();
-	keywords_["nand"] = keywords_["Nand"] = keywords_["NAND"] = make<Nand>();
-	keywords_["or"] = keywords_["Or"] = make<Or>();
-	keywords_["nor"] = keywords_["Nor"] = keywords_["NOR"] = make<Nor>();
-	keywords_["xor"] = keywords_["Xor"] = keywords_["XOR"] = make<Xor>();
-	keywords_["xnor"] = keywords_["Xnor"] = keywords_["XNOR"] = make<Xnor>();
-	keywords_["&"] = make<BitAnd>();
-	keywords_["|"] = make<BitOr>();
-	keywords_["<<"] = make<BitShiftLeft>();
-	keywords_[">>"] = make<BitShiftRight>();
-	keywords_["!"] = make<Factorial>();
-	keywords_["+"] = make<Identity>();
-	keywords_["-"] = make<Negation>();
-	keywords_["not"] = keywords_["Not"] = keywords_["NOT"] = make<Not>();
-	keywords_["~"] = make<BitNot>();
-
-	// Classes
-	keywords_["boolean"] = keywords_["Boolean"] = keywords_["BOOLEAN"] = make<Boolean>();
-	keywords_["true"] = keywords_["True"] = keywords_["TRUE"] = make<True>();
-	keywords_["false"] = keywords_["False"] = keywords_["FALSE"] = make<False>();
-	keywords_["oneargfunction"] = keywords_["Oneargfunction"] = keywords_["ONEARGFUNCTION"] = make<OneArgFunction>();
-	keywords_["twoargfunction"] = keywords_["Twoargfunction"] = keywords_["TWOARGFUNCTION"] = make<TwoArgFunction>();
-	keywords_["integer"] = keywords_["Integer"] = keywords_["INTEGER"] = make<Integer>();
-	keywords_["operand"] = keywords_["Operand"] = keywords_["OPERAND"] = make<Operand>();
-	keywords_["parenthesis"] = keywords_["Parenthesis"] = keywords_["PARENTHESIS"] = make<Parenthesis>();
-	keywords_["("] =  make<LeftParenthesis>();
-	keywords_[")"] =  make<RightParenthesis>();
-	keywords_["leftparenthesis"] = keywords_["Leftparenthesis"] = keywords_["LEFTPARENTHESIS"] = make<LeftParenthesis>();
-	keywords_[","] =  make<ArgumentSeparator>();
-	keywords_["real"] = keywords_["Real"] = keywords_["REAL"] = make<Real>();
-	keywords_["pi"] = keywords_["Pi"] = keywords_["PI"] = make<Pi>();
-	keywords_["e"] = keywords_["E"] = make<E>();
-	keywords_["token"] = keywords_["Token"] = keywords_["TOKEN"] = make<Token>();
-	keywords_["variable"] = keywords_["Variable"] = keywords_["VARIABLE"] = make<Variable>();
-	keywords_["result"] = keywords_["Result"] = keywords_["RESULT"] = make<Result>();
+namespace {
+	// SWAR test that all 8 bytes of 'chunk' are the ASCII digits '0'..'9'
+	bool is_eight_digits(uint64_t chunk)
+	{
+		return ((chunk & 0xF0F0F0F0F0F0F0F0ULL) | (((chunk + 0x0606060606060606ULL) & 0xF0F0F0F0F0F0F0F0ULL) >> 4)) == 0x3333333333333333ULL;
+	}
 
-}
+	// SWAR conversion of 8 ASCII digits (first digit in the lowest byte) to their value
+	uint32_t parse_eight_digits(uint64_t chunk)
+	{
+		chunk = ((chunk & 0x0F0F0F0F0F0F0F0FULL) * 2561) >> 8;					// pairs of digits
+		chunk = ((chunk & 0x00FF00FF00FF00FFULL) * 6553601) >> 16;				// groups of 4
+		return static_cast<uint32_t>(((chunk & 0x0000FFFF0000FFFFULL) * 42949672960001ULL) >> 32);
+	}
 
-/** Get an identifier from the expression.
-	Assumes that the currentChar is pointing to a alphabetic character.
-*/
-Token::pointer_type Tokenizer::_get_identifier(Tokenizer::string_type::const_iterator& currentChar, Tokenizer::string_type const& expression) {
-	// accumulate identifier
-	string_type ident;
-	
-	// Grab all the characters if they are a alphabetic charater or a digit
-	// and concatenate them into the identity string
-	do
-		ident += *currentChar++;
-	while (currentChar != end(expression) && isalnum(*currentChar));
-	 
-
-	// check for predefined identifier in the keywords_ dictonary(map)
-	dictionary_type::iterator iter = keywords_.find(ident);
-	if (iter != end(keywords_))
+	uint64_t load_eight(char const* digits)
 	{
-			// Returns the Token::pointer type is found in keywords_ 
-			return iter->second;
+		uint64_t chunk;
+		memcpy(&chunk, digits, sizeof(chunk));
+#if defined(__BYTE_ORDER__) && __BYTE_ORDER__ == __ORDER_BIG_ENDIAN__
+		chunk = __builtin_bswap64(chunk);
+#endif
+		return chunk;
 	}
-	else 
+
+	// Skip a run of digits, 8 at a time where possible
+	char const* skip_digits(char const* pos, char const* last)
 	{
-		// If the identity is not in the keywords_, then search to see if 
-		// it has been made as a variable and is already in the variables_ (map)
-		iter = variables_.find(ident);
-
-		// If it is in the variables map_ then return that Token::pointer type
-		if (iter != end(variables_))
-			return iter->second;
-		else // If not in variables_ then make the key word the "ident" and the the value the "Token::pointer_type"
-			return variables_[ident] = make<Variable>();  
+		while (last - pos >= 8 && is_eight_digits(load_eight(pos)))
+			pos += 8;
+		while (pos != last && isdigit(*pos))
+			++pos;
+		return pos;
 	}
 
-	// If it is none of these then throw the bad character exception
-	throw XBadCharacter(expression, currentChar - begin(expression));
-}
+	// Value of up to 19 digits
+	uint64_t parse_digits(char const* first, char const* last)
+	{
+		uint64_t value = 0;
+		for (; last - first >= 8; first += 8)
+			value = value * 100000000 + parse_eight_digits(load_eight(first));
+		for (; first != last; ++first)
+			value = value * 10 + (*first - '0');
+		return value;
+	}
 
-/** Get a number token from the expression.
-	@return One of BinaryInteger, Integer, or Real.
-	@param currentChar [in,out] an iterator to the current character.  Assumes that the currentChar is pointing to a digit.
-	@param expression [in] the expression being scanned.
-*/
-Token::pointer_type Tokenizer::_get_number(Tokenizer::string_type::const_iterator& currentChar, Tokenizer::string_type const& expression) {
-	assert(isdigit(*currentChar) && "currentChar must pointer to a digit");
-
-	// Number that will be passed back with the Integer Token
-	Integer::value_type accumulatorNumber = 0;
-
-	// Flag to set to true if the number is a real numer when currentChar is a '.'
-	// Values to set to how many decimal places the number is and the number of times
-	// to divide that number by 10 to add the correct preceding zeros before adding
-	// to the accumulatorNumber
-	Real::value_type accumulatorRealNumber = 0.0;
-	bool isRealNum = false;
-	int decimalPlaces = 0;
-	int dividedBy = 0;
-	Real::value_type realNumLiteral = 0.0;
-
-	// Converts the currentChar to an char, then puts that char into a string
-	// so we can convert the string to an int. Then we add that into onto the
-	// accumlatorNumber so we can perform the operations to make the number the correct
-	// return number.
-	char num = *currentChar++;	
-	string str;
-	str = num;
-	int literalValue = stoi(str);
-	accumulatorNumber = literalValue;
-	accumulatorRealNumber = literalValue;
-
-	// While the currentChar is a number, does not equal the end of the expression AND
-	// there is no decimal in the number, multiple by 10 for every digit after the first digit encountered.
-	// Have a seperate accumulator for a Real number because we still need all the digits before the decimal
-	// when adding the digits to the right of the decimal
-	while (currentChar != end(expression) && isdigit(*currentChar) && isRealNum == false)
+	// Value of a run of digits: 19 digits per cpp_int step instead of one
+	Integer::value_type parse_integer(char const* first, char const* last)
 	{
-		accumulatorNumber *= 10;
-		accumulatorRealNumber *= 10;
-		num = *currentChar++;
-		str = num;
-		literalValue = stoi(str);
-		accumulatorNumber += literalValue;
-		accumulatorRealNumber += literalValue;
-	};
-
-	// If the currentChar is not the end of expression and it wasn't a digit from before
-	// then check to see if the char is a decimal '.', and if it is we can assume that it is a 
-	// real number/
-	if (currentChar != end(expression))
+		size_t const CHUNK = 19;
+		size_t length = last - first;
+		size_t head = length % CHUNK == 0 ? CHUNK : length % CHUNK;
+		if (length <= CHUNK)
+			return Integer::value_type(parse_digits(first, last));
+
+		Integer::value_type value = parse_digits(first, first + head);
+		Integer::value_type const scale = pow(Integer::value_type(10), unsigned(CHUNK));
+		for (first += head; first != last; first += CHUNK)
+		{
+			value *= scale;
+			value += parse_digits(first, first + CHUNK);
+		}
+		return value;
+	}
+
+	// Appends a lexeme covering [from, to) of the source text
+	void push(LexemeList& out, lexeme_kind kind, char const* first, char const* from, char const* to, uint32_t index = Lexeme::NO_INDEX)
 	{
-		num = *currentChar;
-		
-		if (num == '.')
-		{	
-			// Increment the currentChar past the decimal, we know it 
-			// has at least one decimal place and we will have to divide it by
-			// at least 10 once(dividedBy = 1) and set the flag to say that it is a real number
-			if (currentChar++ != end(expression))
-			{
-				num = *currentChar;
-
-				// Check to make sure that there is not a second decimal and that it is not 
-				// a alphabetic character or punctuation other than (!) which would mean factorial
-				if (num != '.' && (isdigit(num) || num =='!'))
-				{
-					decimalPlaces = 1;
-					dividedBy = decimalPlaces;
-					isRealNum = true;
-				}
-				else
-					throw XBadCharacter(expression, currentChar - begin(expression));
-			}
-			
-			// Even if there it is the end of expression we can still assume that it is a Real number
-			// with Zero's following the decimal, so we do not want to make it an integer.
-			isRealNum = true;
+		Lexeme lexeme;
+		lexeme.kind = kind;
+		lexeme.offset = static_cast<uint32_t>(from - first);
+		lexeme.length = static_cast<uint32_t>(to - from);
+		lexeme.index = index;
+		out.lexemes.push_back(lexeme);
+	}
+
+	// Tests if the last lexeme ends an operand (an Operand, a PostfixOperator or a RightParenthesis)
+	bool ends_operand(LexemeList const& out)
+	{
+		if (out.lexemes.empty())
+			return false;
+		Lexeme const& last = out.lexemes.back();
+		switch (last.kind)
+		{
+		case lexeme_kind::KEYWORD:			return KeywordTable::instance().ends_operand(last.index);
+		case lexeme_kind::VARIABLE:
+		case lexeme_kind::INTEGER:
+		case lexeme_kind::REAL:
+		case lexeme_kind::RIGHT_PARENTHESIS:
+		case lexeme_kind::FACTORIAL:		return true;
+		default:							return false;
 		}
 	}
 
-	// If the isRealNum flag as not been set to true, which means we did not encounter a decimal
-	// then make an Integer pointer Token
-	if ( isRealNum == false)
-		return make<Integer>(accumulatorNumber);
+	/** Scan an identifier: a keyword (ignoring case) or a variable name.
+		@return the position after the identifier.
+		Assumes that 'pos' is pointing to a alphabetic character.
+	*/
+	char const* scan_identifier(char const* first, char const* pos, char const* last, LexemeList& out)
+	{
+		char const* const start = pos;
+		do
+			++pos;
+		while (pos != last && isalnum(*pos));
+
+		size_t index = KeywordTable::instance().find_index(start, pos - start);
+		if (index != KeywordTable::NOT_FOUND)
+			push(out, lexeme_kind::KEYWORD, first, start, pos, static_cast<uint32_t>(index));
+		else
+			push(out, lexeme_kind::VARIABLE, first, start, pos);
+		return pos;
+	}
 
-	// If it is a Real number than grab all the digits after the decimal
-	// Then have to divide by 10 for every consecutive position to the right
-	// of the decimal to add the number in the correct position to the accumulator
-	while (currentChar != end(expression) && isdigit(*currentChar))
+	/** Scan a number.
+		Literals are digits [ '.' digits ] [ ('e'|'E') ['+'|'-'] digits ].  A literal with a fraction or an exponent is a Real.
+		Integers of up to 18 digits are converted here and kept in the integer pool; longer ones are converted from the source text.
+		@return the position after the literal.
+		Assumes that 'pos' is pointing to a digit.
+	*/
+	char const* scan_number(char const* first, char const* pos, char const* last, LexemeList& out)
 	{
-		num = *currentChar++;
-		str = num;
-		realNumLiteral = stoi(str);
+		assert(isdigit(*pos) && "pos must point to a digit");
+		char const* const start = pos;
+
+		// integer part
+		pos = skip_digits(start, last);
+		char const* const integerEnd = pos;
+		bool isRealNum = false;
 
-		while (dividedBy > 0)
+		// fraction: the '.' must be followed by a digit (or '!' for the factorial of a Real)
+		if (pos != last && *pos == '.')
 		{
-			realNumLiteral /= 10;
-			dividedBy--;
+			++pos;
+			if (pos == last || !(isdigit(*pos) || *pos == '!'))
+				throw Tokenizer::XBadCharacter(Tokenizer::string_type(first, last), pos - first);
+			pos = skip_digits(pos, last);
+			isRealNum = true;
 		}
 
-		accumulatorRealNumber += realNumLiteral;
+		// exponent: only taken when digits follow, otherwise the 'e' is left for the next token
+		if (pos != last && (*pos == 'e' || *pos == 'E'))
+		{
+			char const* exponent = pos + 1;
+			if (exponent != last && (*exponent == '+' || *exponent == '-'))
+				++exponent;
+			if (exponent != last && isdigit(*exponent))
+			{
+				pos = skip_digits(exponent, last);
+				isRealNum = true;
+			}
+		}
 
-		decimalPlaces++;
-		dividedBy = decimalPlaces;	
+		if (isRealNum)
+			push(out, lexeme_kind::REAL, first, start, pos);
+		else if (integerEnd - start <= 18)
+		{
+			push(out, lexeme_kind::INTEGER, first, start, pos, static_cast<uint32_t>(out.integers.size()));
+			out.integers.push_back(static_cast<Integer::small_type>(parse_digits(start, integerEnd)));
+		}
+		else
+			push(out, lexeme_kind::INTEGER, first, start, pos);
+		return pos;
 	}
-
-	// Return the a Real number Token with the value of the Real number
-	return make<Real>(accumulatorRealNumber);
 }
 
 
@@ -269,245 +214,274 @@ Token::pointer_type Tokenizer::_get_number(Tokenizer::string_type::const_iterato
 	@note Tokenizer dictionary may be updated if expression contains variables.
 	@note Will throws 'BadCharacter' if the expression contains an un-tokenizable character.
 	*/
-TokenList Tokenizer::tokenize( string_type const& expression ) {
-	TokenList tokenizedExpression;
-	auto currentChar = expression.cbegin();
-	//string_type accum = "";
-	
+TokenList Tokenizer::tokenize( view_type expression ) {
+	return to_tokens(lex(expression), expression);
+}
+
+
+
+/** Scan the expression into lexemes without allocating a token per lexeme.
+	@param expression [in] The expression to scan.  The lexemes refer to it by offset.
+	@param out [out] the lexemes of 'expression'.  Cleared first, so one list can be reused across expressions.
+	@note Will throws 'BadCharacter' if the expression contains an un-tokenizable character.
+	*/
+void Tokenizer::lex(view_type expression, LexemeList& out) const {
+	if (expression.size() > numeric_limits<uint32_t>::max())
+		throw runtime_error("Error: Expression too long.");
+
+	KeywordTable const& keywords = KeywordTable::instance();
+	char const* const first = expression.data();
+	char const* const last = first + expression.size();
+	char const* pos = first;
+	out.clear();
+
 	for(;;)
 	{
 		// strip whitespace
-		while (currentChar != end(expression) && isspace(*currentChar))
-			++currentChar;
+		while (pos != last && isspace(*pos))
+			++pos;
 
 		// check of end of expression
-		if (currentChar == end(expression)) break;
+		if (pos == last) break;
+
+		char const* op = pos;
 
 		// check for a number
-		if (isdigit(*currentChar)) 
+		if (isdigit(*pos))
 		{
-			tokenizedExpression.push_back(_get_number(currentChar, expression));
+			pos = scan_number(first, pos, last, out);
 			continue;
 		}
 
 		// check for assignment
-		if (*currentChar == '=')
+		if (*pos == '=')
 		{
-			if (++currentChar == end(expression))
-			{
-				throw exception("Error: Not enough operands.");
-			}
+			if (++pos == last)
+				throw runtime_error("Error: Not enough operands.");
 
 			// check for punctuation after the first '=', if none the make an Assignment Token.
 			// If there is punctuation following the first '=', check for a second '=' which would make 
 			// it an Equality Token
-			if (!iswpunct(*currentChar))
-				tokenizedExpression.push_back(make<Assignment>());
-			else if (*currentChar == '=')
+			if (!ispunct(static_cast<unsigned char>(*pos)))
+				push(out, lexeme_kind::ASSIGNMENT, first, op, pos);
+			else if (*pos == '=')
 			{
-				currentChar++;
-				tokenizedExpression.push_back(make<Equality>());
+				++pos;
+				push(out, lexeme_kind::EQUALITY, first, op, pos);
 			}
 			continue;
 		}
 
 		// check for Opening-Parenthesis
-		if (*currentChar == '(')
+		if (*pos == '(')
 		{
-			if (++currentChar == end(expression))
-			{
-				throw exception("Error: Missing ')' bracket.");
-			}
-			tokenizedExpression.push_back(make<LeftParenthesis>());
+			if (++pos == last)
+				throw runtime_error("Error: Missing ')' bracket.");
+			push(out, lexeme_kind::LEFT_PARENTHESIS, first, op, pos);
 			continue;
 		}
 
 		// check for Closing-Parenthesis
-		if (*currentChar == ')')
+		if (*pos == ')')
 		{
 			if (expression.size() == 1)
-			{
-				throw exception("Error: Missing '(' bracket.");
-			}
-			currentChar++;
-			tokenizedExpression.push_back(make<RightParenthesis>());
+				throw runtime_error("Error: Missing '(' bracket.");
+			++pos;
+			push(out, lexeme_kind::RIGHT_PARENTHESIS, first, op, pos);
 			continue;
 		}
 
-		// check for asterisk
-		if (*currentChar == '*')
+		// check for asterisk: '**' is a Power Token, otherwise it is a Multiplication Token
+		if (*pos == '*')
 		{
-			string_type str;
-
-			if(++currentChar != end(expression))
-			{	
-				str = *currentChar;
-			}
-			else if (currentChar == end(expression))
-			{
-				throw exception("Insufficient number of operands for operation");
-			}
-			
-			// check to see if the character after the first asterisk is also an asterisk,
-			// as this would make it a Power Token, otherwise it is a Multiplication Token
-			if (str[0] == '*')
-			{
-				tokenizedExpression.push_back(make<Power>());
-				currentChar++;
-			}		
+			if (++pos == last)
+				throw runtime_error("Insufficient number of operands for operation");
+			if (*pos == '*')
+				push(out, lexeme_kind::POWER, first, op, ++pos);
 			else
-				tokenizedExpression.push_back(make<Multiplication>());
+				push(out, lexeme_kind::MULTIPLICATION, first, op, pos);
 			continue;
 		}
 
 		// check for virgule
-		if (*currentChar == '/')
+		if (*pos == '/')
 		{
-			if (++currentChar != end(expression))
-			{
-				tokenizedExpression.push_back(make<Division>());
-				continue;
-			}
-			else if (currentChar == end(expression))
-			{
-				throw exception("Insufficient number of operands for operation");
-			}
+			if (++pos == last)
+				throw runtime_error("Insufficient number of operands for operation");
+			push(out, lexeme_kind::DIVISION, first, op, pos);
+			continue;
 		}
 
 		// check for Exclamation 
-		if (*currentChar == '!')
+		if (*pos == '!')
 		{
-			currentChar++;
+			++pos;
 
-			// If the Token vector is not empty than there should be an integer that will
-			// either have a Inequality operator comparing the integer after it or if no
-			// integer follows the '!' then it must be a Factorial operation.
-			if (!tokenizedExpression.empty())
-			{
-				if (currentChar != end(expression) && *currentChar == '=')
-				{
-					currentChar++;
-					tokenizedExpression.push_back(make<Inequality>());
-					continue;
-				}
-
-				if (is<RightParenthesis>(tokenizedExpression.back()) || is<Operand>(tokenizedExpression.back())
-					|| is<PostfixOperator>(tokenizedExpression.back()))
-				{
-					tokenizedExpression.push_back(make<Factorial>());
-					continue;
-				}
-			}
-			else // If the vector is empty then it is a bad expression
-				throw XFactorialExperssion(expression, currentChar - begin(expression));
-		}
+			// If there are no lexemes yet it is a bad expression.  Otherwise '!=' is an Inequality,
+			// and a '!' after an operand is a Factorial.  Anything else is scanned as what follows the '!'.
+			if (out.lexemes.empty())
+				throw XFactorialExperssion(string_type(first, last), pos - first);
 
-		// check if plus sign
-		if (*currentChar == '+')
-		{
-			if (++currentChar == end(expression))
+			if (pos != last && *pos == '=')
 			{
-				throw exception("Insufficient number of operands for operation");
+				push(out, lexeme_kind::INEQUALITY, first, op, ++pos);
+				continue;
 			}
 
-			// Check if the vector is empty, if it is empty then we know right away it is an Identity operator.
-			// If is not empty then we check for  '(', digit(operend), or ')' Tokens wich would mean it is an Addition
-			// Token, otherwise it is an Identity Token.
-			if (!tokenizedExpression.empty())
+			if (ends_operand(out))
 			{
-				if (is<RightParenthesis>(tokenizedExpression.back()) || is<Operand>(tokenizedExpression.back())
-					|| is<PostfixOperator>(tokenizedExpression.back()))
-				{
-					tokenizedExpression.push_back(make<Addition>());
-					continue;
-				}
-				else
-					tokenizedExpression.push_back(make<Identity>());
+				push(out, lexeme_kind::FACTORIAL, first, op, pos);
+				continue;
 			}
-			else
-				tokenizedExpression.push_back(make<Identity>());
-			continue;
+
+			if (pos == last)
+				throw XBadCharacter(string_type(first, last), pos - first);
+			op = pos;
 		}
 
-		// check if dash
-		if (*currentChar == '-')
+		// check if plus or dash: Addition or Subtraction after an operand, otherwise Identity or Negation
+		if (*pos == '+' || *pos == '-')
 		{
-			if (++currentChar == end(expression))
-			{
-				throw exception("Insufficient number of operands for operation");
-			}
+			bool const isPlus = *pos == '+';
+			if (++pos == last)
+				throw runtime_error("Insufficient number of operands for operation");
 
-			// Check if the vector is empty, if it is empty then we know right away it is an Negation operator.
-			// If is not empty then we check for  '(', digit(operend), or ')' Tokens wich would mean it is an Subtraction
-			// Token, otherwise it is an Negation Token.
-			if (!tokenizedExpression.empty())
-			{
-				if (is<RightParenthesis>(tokenizedExpression.back()) || is<Operand>(tokenizedExpression.back())
-					|| is<PostfixOperator>(tokenizedExpression.back()))
-				{
-					tokenizedExpression.push_back(make<Subtraction>());
-					continue;
-				}
-				else
-					tokenizedExpression.push_back(make<Negation>());
-			}
+			if (ends_operand(out))
+				push(out, isPlus ? lexeme_kind::ADDITION : lexeme_kind::SUBTRACTION, first, op, pos);
 			else
-				tokenizedExpression.push_back(make<Negation>());
+				push(out, isPlus ? lexeme_kind::IDENTITY : lexeme_kind::NEGATION, first, op, pos);
 			continue;
 		}
-		
+
 		// check for a alphabetic character
-		if (isalpha(*currentChar))
+		if (isalpha(*pos))
 		{
-			tokenizedExpression.push_back(_get_identifier(currentChar, expression));
-			//currentChar++;
+			pos = scan_identifier(first, pos, last, out);
 			continue;
 		}
 
 		// checks for anything that is not an alpha character or digit
 		// Will check in our keywords for any characters that are acceptable 
 		// (i.e. %), if it doesn't find it then it is a bad character
-		if (!isalnum(*currentChar))
+		if (!isalnum(*pos))
 		{
-			string_type nonAlphaOrDigit;
-			nonAlphaOrDigit += *currentChar++;
-			
-			if (currentChar != end(expression) && !iswspace(*currentChar) && !isalnum(*currentChar))
-			{
-				nonAlphaOrDigit += *currentChar;
-			}
-			else // this --currentChar ensures we grab the right location of the Bad Character
-				--currentChar;
-
+			++pos;
+			if (pos != last && !isspace(*pos) && !isalnum(*pos))
+				++pos;
 
 			// Check the keywords for the character (i.e %) for modulus
-			dictionary_type::iterator iter = keywords_.find(nonAlphaOrDigit);
-			if (iter != end(keywords_))
+			size_t index = keywords.find_index(op, pos - op);
+			if (index != KeywordTable::NOT_FOUND)
 			{
-				currentChar++;
-				tokenizedExpression.push_back(iter->second);
+				push(out, lexeme_kind::KEYWORD, first, op, pos, static_cast<uint32_t>(index));
 				continue;
 			}
 
-			// If not found in the key words then it is a Bad Character
-			throw XBadCharacter(expression, currentChar - begin(expression));
+			// If not found in the key words then it is a Bad Character (the last character tried)
+			throw XBadCharacter(string_type(first, last), pos - 1 - first);
 		}
-		
-		if (is<Function>(tokenizedExpression.back()) && *currentChar != '(')
-			throw XFunctionNotFollowedBy(expression, currentChar - begin(expression));
-		
+
+		if (!out.lexemes.empty() && out.lexemes.back().kind == lexeme_kind::KEYWORD
+			&& keywords.is_function(out.lexemes.back().index) && *pos != '(')
+			throw XFunctionNotFollowedBy(string_type(first, last), pos - first);
+
 		// Not a recognized token
-		throw XBadCharacter(expression, currentChar - begin(expression));
+		throw XBadCharacter(string_type(first, last), pos - first);
 	}
+}
 
-	// Return the vector of Tokens
-	return tokenizedExpression;
+
+
+/** Convert lexemes to tokens.
+	@return a TokenList with one token per lexeme.
+	@param lexemes [in] lexemes produced by lex().
+	@param expression [in] the expression 'lexemes' was scanned from.
+	@note Tokenizer dictionary may be updated if expression contains variables.
+	*/
+TokenList Tokenizer::to_tokens(LexemeList const& lexemes, view_type expression) {
+	KeywordTable const& keywords = KeywordTable::instance();
+	TokenList tokens;
+	tokens.reserve(lexemes.lexemes.size());
+
+	for (Lexeme const& lexeme : lexemes.lexemes)
+	{
+		char const* const text = expression.data() + lexeme.offset;
+		switch (lexeme.kind)
+		{
+		case lexeme_kind::KEYWORD:
+			if (keywords.is_shared(lexeme.index))
+				tokens.push_back(keywords.token(lexeme.index));
+			else
+			{
+				if (ownKeywords_.size() <= lexeme.index)
+					ownKeywords_.resize(keywords.size());
+				if (!ownKeywords_[lexeme.index])
+					ownKeywords_[lexeme.index] = keywords.create(lexeme.index);
+				tokens.push_back(ownKeywords_[lexeme.index]);
+			}
+			break;
+		case lexeme_kind::VARIABLE:
+			tokens.push_back(get_variable(view_type(text, lexeme.length)));
+			break;
+		case lexeme_kind::INTEGER:
+			if (lexeme.index != Lexeme::NO_INDEX)
+				tokens.push_back(make<Integer>(static_cast<Integer::small_type>(lexemes.integers[lexeme.index])));
+			else
+				tokens.push_back(make<Integer>(parse_integer(text, text + lexeme.length)));
+			break;
+		case lexeme_kind::REAL:
+			// cpp_dec_float parses the decimal literal exactly
+			tokens.push_back(make<Real>(Real::value_type(string_type(text, lexeme.length))));
+			break;
+		case lexeme_kind::ASSIGNMENT:			tokens.push_back(make<Assignment>()); break;
+		case lexeme_kind::EQUALITY:				tokens.push_back(make<Equality>()); break;
+		case lexeme_kind::INEQUALITY:			tokens.push_back(make<Inequality>()); break;
+		case lexeme_kind::LEFT_PARENTHESIS:		tokens.push_back(make<LeftParenthesis>()); break;
+		case lexeme_kind::RIGHT_PARENTHESIS:	tokens.push_back(make<RightParenthesis>()); break;
+		case lexeme_kind::POWER:				tokens.push_back(make<Power>()); break;
+		case lexeme_kind::MULTIPLICATION:		tokens.push_back(make<Multiplication>()); break;
+		case lexeme_kind::DIVISION:				tokens.push_back(make<Division>()); break;
+		case lexeme_kind::FACTORIAL:			tokens.push_back(make<Factorial>()); break;
+		case lexeme_kind::ADDITION:				tokens.push_back(make<Addition>()); break;
+		case lexeme_kind::IDENTITY:				tokens.push_back(make<Identity>()); break;
+		case lexeme_kind::SUBTRACTION:			tokens.push_back(make<Subtraction>()); break;
+		case lexeme_kind::NEGATION:				tokens.push_back(make<Negation>()); break;
+		}
+	}
+	return tokens;
 }
 
 /*=============================================================
 
 Revision History
 
+Version 0.11.0: 2026-10-18
+Keywords that are not KeywordTable::is_shared() get a token per Tokenizer, as before the shared table.
+
+Version 0.10.0: 2026-10-18
+tokenize() takes a string view.
+
+Version 0.9.0: 2026-10-18
+Errors are thrown as std::runtime_error (std::exception(const char*) is a Visual C++ extension).
+
+Version 0.8.0: 2026-10-18
+Variables are bound in the Tokenizer's Environment.
+
+Version 0.7.0: 2026-10-18
+Scanning split from token construction: lex() scans a string_view into compact Lexeme records
+(kind, source offset and length) and to_tokens() builds the TokenList from them.
+
+Version 0.6.0: 2026-10-18
+_get_number scans digits 8 at a time (SWAR), builds Integers 19 digits per step and Reals from the
+literal text.  Added exponent syntax (1.5e-300).
+
+Version 0.5.0: 2026-10-18
+Keywords are looked up in the shared, case-insensitive KeywordTable instead of a per-instance map.
+Single variables_ lookup per identifier.
+
+Version 0.4.0: 2026-10-18
+pi and e keywords use the shared constants.
+
 Version 0.3.0: 2017-11-23
 Added Python-style power operator '**'.
 
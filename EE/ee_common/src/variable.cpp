@@ -1,8 +1,8 @@
 /** @file: variable.cpp
 	@author Garth Santor/Trinh Han
 	@author http://www.gats.ca/
-	@date 2012-11-13
-	@version 0.1.1
+	@date 2026-10-18
+	@version 0.2.0
 	@note Compiles under Visual C++ v110
 
 	@brief Variable class implementation.
@@ -12,10 +12,26 @@
 	*/
 
 #include "../inc/variable.hpp"
+#include "../inc/variable_store.hpp"
 #include <boost/lexical_cast.hpp>
 
 
 
+Variable::value_type Variable::get_value() const {
+	return store_ ? store_->snapshot()->value(slot_) : value_;
+}
+
+
+
+void Variable::set_value(value_type value) {
+	if (store_)
+		store_->publish(slot_, value);
+	else
+		value_ = value;
+}
+
+
+
 Variable::string_type Variable::to_string() const {
 
 	if (get_value() == NULL)
@@ -31,6 +47,9 @@ Variable::string_type Variable::to_string() const {
 
 Revision History
 
+Version 0.2.0: 2026-10-18
+get_value()/set_value() go through the VariableStore of environment variables.
+
 Version 0.0.1: 2012-11-13
 C++ 11 cleanup
 
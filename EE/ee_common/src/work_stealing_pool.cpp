@@ -0,0 +1,208 @@
+/** @file: work_stealing_pool.cpp
+	@author Chris Pollock
+	@version 0.1.0
+	@date 2026-10-18
+	@note Compiles under Visual C++ 15.4.4
+
+	@brief WorkStealingPool class implementation.
+	*/
+
+#include "../inc/work_stealing_pool.hpp"
+#include <limits>
+#include <stdexcept>
+using namespace std;
+
+namespace {
+	uint64_t pack(uint64_t first, uint64_t last) { return first << 32 | last; }
+	size_t first_of(uint64_t range) { return static_cast<size_t>(range >> 32); }
+	size_t last_of(uint64_t range) { return static_cast<size_t>(range & 0xFFFFFFFF); }
+}
+
+
+
+WorkStealingPool::WorkStealingPool(size_t threads)
+	: generation_(0)
+	, running_(0)
+	, stopping_(false)
+	, task_(nullptr)
+	, errorTask_(0)
+{
+	if (threads == 0)
+		threads = (max)(1u, thread::hardware_concurrency());
+
+	shares_.reset(new Share[threads]);
+	for (size_t i = 0; i < threads; ++i)
+		shares_[i].range.store(0);
+
+	threads_.reserve(threads);
+	for (size_t i = 0; i < threads; ++i)
+		threads_.emplace_back(&WorkStealingPool::work, this, i);
+}
+
+
+
+WorkStealingPool::~WorkStealingPool()
+{
+	{
+		lock_guard<mutex> lock(mutex_);
+		stopping_ = true;
+	}
+	start_.notify_all();
+	for (auto& thread : threads_)
+		thread.join();
+}
+
+
+
+/** Run a parallel loop.
+	@param count [in] the number of tasks.
+	@param task [in] called once for each task index, on some worker.
+	*/
+void WorkStealingPool::run(size_t count, task_type const& task)
+{
+	if (count == 0)
+		return;
+	if (count > numeric_limits<uint32_t>::max())
+		throw runtime_error("Error: too many tasks for the work-stealing pool.");
+
+	// Contiguous shares, so neighbouring tasks (e.g. adjacent row ranges) run on the same worker
+	size_t const workers = size();
+	for (size_t i = 0; i < workers; ++i)
+		shares_[i].range.store(pack(count * i / workers, count * (i + 1) / workers));
+
+	error_ = nullptr;
+	errorTask_ = count;
+	{
+		unique_lock<mutex> lock(mutex_);
+		task_ = &task;
+		running_ = workers;
+		++generation_;
+		start_.notify_all();
+		finish_.wait(lock, [this] { return running_ == 0; });
+		task_ = nullptr;
+	}
+
+	if (error_)
+		rethrow_exception(error_);
+}
+
+
+
+/** Worker thread: runs each loop's tasks until no share has any left. */
+void WorkStealingPool::work(size_t worker)
+{
+	uint64_t seen = 0;
+	for (;;)
+	{
+		task_type const* task;
+		{
+			unique_lock<mutex> lock(mutex_);
+			start_.wait(lock, [&] { return stopping_ || generation_ != seen; });
+			if (stopping_)
+				return;
+			seen = generation_;
+			task = task_;
+		}
+
+		for (;;)
+		{
+			size_t index;
+			if (!take(worker, index))
+			{
+				if (!steal(worker))
+					break;
+				continue;
+			}
+
+			try {
+				(*task)(index, worker);
+			}
+			catch (...) {
+				lock_guard<mutex> lock(errorMutex_);
+				if (index < errorTask_)
+				{
+					errorTask_ = index;
+					error_ = current_exception();
+				}
+			}
+		}
+
+		{
+			lock_guard<mutex> lock(mutex_);
+			if (--running_ == 0)
+				finish_.notify_one();
+		}
+	}
+}
+
+
+
+/** Take the first task of the worker's own share. */
+bool WorkStealingPool::take(size_t worker, size_t& task)
+{
+	atomic<uint64_t>& range = shares_[worker].range;
+	uint64_t current = range.load(memory_order_acquire);
+	for (;;)
+	{
+		size_t const first = first_of(current), last = last_of(current);
+		if (first >= last)
+			return false;
+		if (range.compare_exchange_weak(current, pack(first + 1, last), memory_order_acq_rel))
+		{
+			task = first;
+			return true;
+		}
+	}
+}
+
+
+
+/** Move the back half of another worker's share into the worker's own (empty) share.
+	@return false if every share is empty.
+	*/
+bool WorkStealingPool::steal(size_t worker)
+{
+	size_t const workers = size();
+	for (size_t i = 1; i < workers; ++i)
+	{
+		atomic<uint64_t>& victim = shares_[(worker + i) % workers].range;
+		uint64_t current = victim.load(memory_order_acquire);
+		for (;;)
+		{
+			size_t const first = first_of(current), last = last_of(current);
+			if (first >= last)
+				break;
+			size_t const middle = first + (last - first) / 2;
+			if (victim.compare_exchange_weak(current, pack(first, middle), memory_order_acq_rel))
+			{
+				shares_[worker].range.store(pack(middle, last), memory_order_release);
+				return true;
+			}
+		}
+	}
+	return false;
+}
+
+
+/*=============================================================
+
+Revision History
+
+Version 0.1.0: 2026-10-18
+Errors are thrown as std::runtime_error (std::exception(const char*) is a Visual C++ extension).
+
+Version 0.0.0: 2026-10-18
+Alpha release.
+
+=============================================================
+
+Copyright Garth Santor/Trinh Han
+
+The copyright to the computer program(s) herein
+is the property of Garth Santor/Trinh Han of Canada.
+The program(s) may be used and/or copied only with
+the written permission of Garth Santor/Trinh Han
+or in accordance with the terms and conditions
+stipulated in the agreement/contract under which
+the program(s) have been supplied.
+=============================================================*/
@@ -26,6 +26,20 @@
 #define TEST_VARIABLE true
 #define TEST_RESULT true
 
+#define TEST_COMPILE true
+#define TEST_PRECISION true
+#define TEST_BATCH true
+#define TEST_PARALLEL true
+#define TEST_ENVIRONMENT true
+#define TEST_FOLD true
+#define TEST_SHARE true
+#define TEST_DEPENDENCY true
+#define TEST_STATS true
+#define TEST_ALLOCATION true
+#define TEST_STREAM true
+#define TEST_MAPPED true
+#define TEST_CACHE true
+
 #define TEST_TOKENS false
 #define TEST_TOKENIZER false
 #define TEST_PARSER false